@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/abaf.h>
+#include <dyn2b/solvers/aba_mixed.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/screw.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+/*
+ * Accuracy of the single-precision (dyn2b_abaf) and the mixed-precision
+ * (dyn2b_aba_mixed) articulated-body algorithm over the length of a serial
+ * chain. For each length n = 1, 2, 4, ..., BENCH_N_MAX and each configuration
+ * it computes the largest error of the joint accelerations relative to the
+ * largest joint acceleration of the double-precision reference (dyn2b_aba):
+ *
+ *   max_i |qdd_i - qdd_ref_i| / max_i |qdd_ref_i|
+ *
+ * and reports the median over SAMPLES configurations. All variants see the
+ * same inputs (rounded to single precision).
+ *
+ * The chains are the one of the solvers' benchmarks (revolute joints that
+ * cycle through the principal axes with unit offsets) without actuator
+ * inertia:
+ *
+ * - uniform: all links are the same
+ * - heavy_tip: each link is 10% heavier than its parent (e.g. an arm that
+ *   carries a payload), so that the articulated-body inertia behind each joint
+ *   is heavy in comparison to the joint's own inertia and the projections
+ *   cancel many digits
+ */
+
+// Number of configurations per chain length
+#define SAMPLES 32
+
+// cf. dyn2b_workspace_size_aba() and dyn2b_workspace_size_aba_mixed_abi()
+#define WS_SIZE     (77 * BENCH_N_MAX)
+#define WS_ABI_SIZE (27 * BENCH_N_MAX)
+
+static int parent[BENCH_N_MAX];
+static int jnt[BENCH_N_MAX];
+static double axis[DYN2B_AXIS3_SIZE * BENCH_N_MAX];
+static double x_tree[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static double rbi[DYN2B_RBI3_SIZE * BENCH_N_MAX];
+static double d[BENCH_N_MAX];
+static double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+static double q[BENCH_N_MAX];
+static double qd[BENCH_N_MAX];
+static double tau[BENCH_N_MAX];
+static double qdd[BENCH_N_MAX];
+static double ws[WS_SIZE];
+static double ws_abi[WS_ABI_SIZE];
+
+static float axisf[DYN2B_AXIS3_SIZE * BENCH_N_MAX];
+static float x_treef[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static float rbif[DYN2B_RBI3_SIZE * BENCH_N_MAX];
+static float df[BENCH_N_MAX];
+static float xdd_basef[DYN2B_TWIST3_SIZE];
+static float qf[BENCH_N_MAX];
+static float qdf[BENCH_N_MAX];
+static float tauf[BENCH_N_MAX];
+static float qddf[BENCH_N_MAX];
+static float wsf[WS_SIZE];
+
+
+// Round to single precision such that the reference sees the same inputs
+static void to_flt(
+        int n,
+        double *inout,
+        float *out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = (float)inout[i];
+        inout[i] = out[i];
+    }
+}
+
+
+// Error relative to the largest joint acceleration of the reference
+static double error(
+        int n,
+        const float *res,
+        const double *ref)
+{
+    double err = 0.0;
+    double scale = 0.0;
+    for (int i = 0; i < n; i++) {
+        err = fmax(err, fabs((double)res[i] - ref[i]));
+        scale = fmax(scale, fabs(ref[i]));
+    }
+
+    return err / scale;
+}
+
+
+static int compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static double median(double *err)
+{
+    qsort(err, SAMPLES, sizeof(double), compare);
+
+    return err[SAMPLES / 2];
+}
+
+
+// Serial chain whose link masses grow by the given ratio towards the tip
+static void chain(double ratio)
+{
+    memset(x_tree, 0, sizeof(x_tree));
+    for (int i = 0; i < BENCH_N_MAX; i++) {
+        const double m = pow(ratio, i);
+        const double inertia[DYN2B_RBI3_SIZE] = {
+            0.2 * m, 0.0, 0.0,  0.0, 0.3 * m, 0.0,  0.0, 0.0, 0.4 * m,
+            0.1 * m, 0.2 * m, 0.3 * m,
+            m
+        };
+
+        parent[i] = i - 1;
+        jnt[i] = DYN2B_JNT_REV_X + (i % 3);
+        double *x = &x_tree[DYN2B_POSE3_SIZE * i];
+        x[0] = 1.0; x[4] = 1.0; x[8] = 1.0;
+        x[DYN2B_POSE3_LIN_OFFSET + 2] = 1.0;
+        memcpy(&rbi[DYN2B_RBI3_SIZE * i], inertia, sizeof(inertia));
+        d[i] = 0.0;
+    }
+
+    to_flt(DYN2B_AXIS3_SIZE * BENCH_N_MAX, axis, axisf);
+    to_flt(DYN2B_POSE3_SIZE * BENCH_N_MAX, x_tree, x_treef);
+    to_flt(DYN2B_RBI3_SIZE * BENCH_N_MAX, rbi, rbif);
+    to_flt(BENCH_N_MAX, d, df);
+    to_flt(DYN2B_TWIST3_SIZE, xdd_base, xdd_basef);
+}
+
+
+static void sweep(const char *name)
+{
+    BENCH_SWEEP(n) {
+        double err_float[SAMPLES];
+        double err_mixed[SAMPLES];
+
+        for (int k = 0; k < SAMPLES; k++) {
+            for (int i = 0; i < n; i++) {
+                q[i] = sin(1.0 + i + 7.0 * k);
+                qd[i] = 0.5 * cos(2.0 + i + 3.0 * k);
+                tau[i] = sin(3.0 + 2.0 * i + 5.0 * k);
+            }
+            to_flt(n, q, qf);
+            to_flt(n, qd, qdf);
+            to_flt(n, tau, tauf);
+
+            dyn2b_aba(n, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+                    q, qd, tau, NULL, qdd, ws);
+
+            dyn2b_abaf(n, parent, jnt, axisf, x_treef, rbif, df, xdd_basef,
+                    qf, qdf, tauf, NULL, qddf, wsf);
+            err_float[k] = error(n, qddf, qdd);
+
+            dyn2b_aba_mixed(n, parent, jnt, axisf, x_treef, rbif, df,
+                    xdd_basef, qf, qdf, tauf, NULL, qddf, wsf, ws_abi);
+            err_mixed[k] = error(n, qddf, qdd);
+        }
+
+        printf("%s,%d,%.3e,%.3e\n", name, n,
+                median(err_float), median(err_mixed));
+    }
+}
+
+
+int main(void)
+{
+    printf("chain,n,err_float,err_mixed\n");
+
+    chain(1.0);
+    sweep("uniform");
+
+    chain(1.1);
+    sweep("heavy_tip");
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/array.h>
+
+#include "bench.h"
+
+
+static double in1[BENCH_N_MAX];
+static double in2[BENCH_N_MAX];
+static double out[BENCH_N_MAX];
+static double a = 0.5;
+
+
+static void run_cpy_arr(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cpy_arr(n, in1, out);
+    }
+}
+
+
+static void run_add_arr(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_add_arr(n, 0, in1, in2, out);
+    }
+}
+
+
+static void run_add_arr_i(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_add_arr_i(n, 0, in1, out);
+    }
+}
+
+
+static void run_sub_arr(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_sub_arr(n, in1, in2, out);
+    }
+}
+
+
+static void run_scl_arr(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_scl_arr(n, &a, in1, out);
+    }
+}
+
+
+static void run_inv_arr(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_inv_arr(n, in1, out);
+    }
+}
+
+
+void array_bench(void)
+{
+    bench_fill(BENCH_N_MAX, in1);
+    bench_fill(BENCH_N_MAX, in2);
+    bench_fill(BENCH_N_MAX, out);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_cpy_arr", n, 0.0, run_cpy_arr);
+        bench_run("dyn2b_add_arr", n, n, run_add_arr);
+        bench_run("dyn2b_add_arr_i", n, n, run_add_arr_i);
+        bench_run("dyn2b_sub_arr", n, n, run_sub_arr);
+        bench_run("dyn2b_scl_arr", n, n, run_scl_arr);
+        bench_run("dyn2b_inv_arr", n, n, run_inv_arr);
+    }
+}
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: LGPL-3.0
+#define _POSIX_C_SOURCE 199309L
+#include "bench.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define BENCH_HAVE_TSC
+#endif
+
+
+// Number of samples of which the fastest one is reported
+#define BENCH_SAMPLES 5
+
+
+enum bench_format {
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON
+};
+
+static enum bench_format format = BENCH_FORMAT_CSV;
+static double min_time = 0.01;      // [s] per sample
+static const char *filter = NULL;
+static int count = 0;               // number of reported results
+
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+
+static double ticks(void)
+{
+#ifdef BENCH_HAVE_TSC
+    return (double)__rdtsc();
+#else
+    return NAN;
+#endif
+}
+
+
+static void report(
+        const char *name,
+        int n,
+        long reps,
+        double ns,
+        double cycles,
+        double gflops)
+{
+    if (format == BENCH_FORMAT_CSV) {
+        if (count == 0) {
+            printf("name,n,reps,ns_per_call,cycles_per_call,gflops\n");
+        }
+        printf("%s,%d,%ld,%.3f,%.1f,%.4f\n", name, n, reps, ns, cycles, gflops);
+    } else {
+        printf("%s\n  {\"name\": \"%s\", \"n\": %d, \"reps\": %ld, "
+               "\"ns_per_call\": %.3f, ",
+               (count == 0) ? "[" : ",", name, n, reps, ns);
+        if (isnan(cycles)) {
+            printf("\"cycles_per_call\": null, ");
+        } else {
+            printf("\"cycles_per_call\": %.1f, ", cycles);
+        }
+        printf("\"gflops\": %.4f}", gflops);
+    }
+
+    fflush(stdout);
+    count++;
+}
+
+
+void bench_run(
+        const char *name,
+        int n,
+        double flop,
+        void (*fn)(int n, long reps))
+{
+    if (filter && !strstr(name, filter)) {
+        return;
+    }
+
+    // Calibrate the repetitions (also warms up caches and branch predictors)
+    long reps = 1;
+    for (;;) {
+        double t0 = now();
+        fn(n, reps);
+        double t1 = now();
+        if (t1 - t0 >= min_time || reps >= (1L << 30)) {
+            break;
+        }
+        reps *= 2;
+    }
+
+    double best_ns = INFINITY;
+    double best_cycles = INFINITY;
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        double c0 = ticks();
+        double t0 = now();
+        fn(n, reps);
+        double t1 = now();
+        double c1 = ticks();
+
+        double ns = 1e9 * (t1 - t0) / (double)reps;
+        double cycles = (c1 - c0) / (double)reps;
+        if (ns < best_ns) {
+            best_ns = ns;
+            best_cycles = cycles;
+        }
+    }
+
+    report(name, n, reps, best_ns, best_cycles, flop / best_ns);
+}
+
+
+void bench_fill(
+        int n,
+        double *out)
+{
+    // Linear congruential generator to stay independent of the C library
+    static uint64_t state = 12345;
+
+    for (int i = 0; i < n; i++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        out[i] = 0.5 + (double)(state >> 11) / 9007199254740992.0;
+    }
+}
+
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--format csv|json] [--min-time SECONDS] [--filter NAME]\n",
+            prog);
+}
+
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--format") && i + 1 < argc) {
+            const char *f = argv[++i];
+            if (!strcmp(f, "csv")) {
+                format = BENCH_FORMAT_CSV;
+            } else if (!strcmp(f, "json")) {
+                format = BENCH_FORMAT_JSON;
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "--min-time") && i + 1 < argc) {
+            if (sscanf(argv[++i], "%lf", &min_time) != 1 || min_time < 0.0) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+            filter = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    array_bench();
+    vector3_bench();
+    matrix_bench();
+    screw_bench();
+    mechanics_bench();
+    joint_bench();
+    inline_bench();
+#ifdef DYN2B_BENCH_FLOAT
+    float_bench();
+#endif
+#ifdef DYN2B_BENCH_SOLVERS
+    solvers_bench();
+#endif
+
+    if (format == BENCH_FORMAT_JSON) {
+        printf("%s]\n", (count == 0) ? "[" : "\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_BENCH_H
+#define DYN2B_BENCH_H
+
+/*
+ * Minimal micro-benchmark harness. Each benchmark provides a function that
+ * calls the operator under test `reps` times for a problem size `n`. The
+ * harness calibrates `reps` such that one sample takes at least the minimum
+ * sample time, keeps the fastest of several samples and reports
+ *
+ * - ns/call: wall-clock time (CLOCK_MONOTONIC) per call
+ * - cycles/call: time-stamp counter ticks per call (x86 only, otherwise NaN).
+ *   The TSC ticks at a constant reference frequency which may differ from the
+ *   actual core frequency under turbo or power scaling.
+ * - GFLOP/s: nominal floating-point operations (as counted for the unrolled
+ *   kernels, additions and multiplications separately, transcendental
+ *   functions not counted) divided by the time per call
+ */
+
+// Largest problem size of the n-wide operators
+#define BENCH_N_MAX 256
+
+// Sweep the problem size n = 1, 2, 4, ..., BENCH_N_MAX
+#define BENCH_SWEEP(n) for (int n = 1; n <= BENCH_N_MAX; n *= 2)
+
+
+/**
+ * Time a benchmark and report the result.
+ *
+ * @param[in] name Name of the benchmarked function.
+ * @param[in] n    Problem size (1 for fixed-size operators).
+ * @param[in] flop Nominal floating-point operations per call.
+ * @param[in] fn   Function that calls the operator `reps` times.
+ */
+void bench_run(
+        const char *name,
+        int n,
+        double flop,
+        void (*fn)(int n, long reps));
+
+/**
+ * Fill an array with deterministic values in the interval [0.5, 1.5).
+ */
+void bench_fill(
+        int n,
+        double *out);
+
+
+void array_bench(void);
+void vector3_bench(void);
+void matrix_bench(void);
+void screw_bench(void);
+void mechanics_bench(void);
+void joint_bench(void);
+void inline_bench(void);
+#ifdef DYN2B_BENCH_FLOAT
+void float_bench(void);
+#endif
+#ifdef DYN2B_BENCH_SOLVERS
+void solvers_bench(void);
+#endif
+
+#endif
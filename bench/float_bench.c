@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/screwf.h>
+#include <dyn2b/functions/jointf.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/joint.h>
+
+#include "bench.h"
+
+
+// Nominal flop counts (cf. bench.h, same as for the double-precision versions)
+#define FLOP_CRS_VEC3       9.0
+#define FLOP_GEMV3         15.0
+#define FLOP_GEMM3         45.0
+#define FLOP_CMP_POSE3     (FLOP_GEMM3 + FLOP_GEMV3 + 3.0)
+#define FLOP_TF_SCREW3     (2.0 * FLOP_GEMV3 + FLOP_CRS_VEC3 + 3.0)
+#define FLOP_TF_PROX_ABI3  (8.0 * FLOP_GEMM3 + 3.0 * 12.0 + 2.0 * 18.0)
+
+static float x1[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static float x2[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static float x3[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static float s1[DYN2B_SCREW3_SIZE * BENCH_N_MAX];
+static float s2[DYN2B_SCREW3_SIZE * BENCH_N_MAX];
+static float abi1[DYN2B_ABI3_SIZE * BENCH_N_MAX];
+static float abi2[DYN2B_ABI3_SIZE * BENCH_N_MAX];
+
+
+static void fill(
+        int n,
+        float *out)
+{
+    static double tmp[DYN2B_ABI3_SIZE * BENCH_N_MAX];
+
+    bench_fill(n, tmp);
+    for (int i = 0; i < n; i++) {
+        out[i] = (float)tmp[i];
+    }
+}
+
+
+static void run_cmp_pose3f(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cmp_pose3f(x1, x2, x3);
+    }
+}
+
+
+static void run_cmp_pose3_batchf(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cmp_pose3_batchf(n, n, x1, x2, x3);
+    }
+}
+
+
+static void run_tf_prox_screw3f(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_screw3f(n, x1, s1, s2);
+    }
+}
+
+
+static void run_tf_prox_screw3_batchf(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_screw3_batchf(n, n, x1, s1, s2);
+    }
+}
+
+
+static void run_tf_prox_abi3_batchf(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_abi3_batchf(n, n, x1, abi1, abi2);
+    }
+}
+
+
+void float_bench(void)
+{
+    fill(DYN2B_POSE3_SIZE * BENCH_N_MAX, x1);
+    fill(DYN2B_POSE3_SIZE * BENCH_N_MAX, x2);
+    fill(DYN2B_SCREW3_SIZE * BENCH_N_MAX, s1);
+    fill(DYN2B_ABI3_SIZE * BENCH_N_MAX, abi1);
+
+    bench_run("dyn2b_cmp_pose3f", 1, FLOP_CMP_POSE3, run_cmp_pose3f);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_cmp_pose3_batchf", n,
+                FLOP_CMP_POSE3 * n, run_cmp_pose3_batchf);
+        bench_run("dyn2b_tf_prox_screw3f", n,
+                FLOP_TF_SCREW3 * n, run_tf_prox_screw3f);
+        bench_run("dyn2b_tf_prox_screw3_batchf", n,
+                FLOP_TF_SCREW3 * n, run_tf_prox_screw3_batchf);
+        bench_run("dyn2b_tf_prox_abi3_batchf", n,
+                FLOP_TF_PROX_ABI3 * n, run_tf_prox_abi3_batchf);
+    }
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-3.0
+// Compiled with DYN2B_INLINE (cf. CMakeLists.txt): the same tiny operators as
+// in vector3_bench.c and joint_bench.c but from the header-only definitions,
+// reported with an "_inline" suffix
+#include <dyn2b/functions/vector3.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/screw.h>
+
+#include "bench.h"
+
+#ifndef DYN2B_INLINE
+#  error "inline_bench.c must be compiled with DYN2B_INLINE"
+#endif
+
+
+// Once inlined, the compiler could hoist the loop-invariant operator out of the
+// repetitions. The empty statement pretends to read and modify all memory in
+// each repetition without emitting any instruction.
+#if defined(__GNUC__)
+#  define CLOBBER() __asm__ volatile("" : : : "memory")
+#else
+#  define CLOBBER()
+#endif
+
+static double in1[3 * BENCH_N_MAX];
+static double in2[3 * BENCH_N_MAX];
+static double out[3 * BENCH_N_MAX];
+static double skw[9];
+static double q[BENCH_N_MAX];
+static double xd[DYN2B_TWIST3_SIZE];
+static double w_in[DYN2B_WRENCH3_SIZE * BENCH_N_MAX];
+
+
+static void run_crs_vec3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_crs_vec3(n, in1, 3, in2, 3, out, 3);
+        CLOBBER();
+    }
+}
+
+
+static void run_skw_vec3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_skw_vec3(in1, skw);
+        CLOBBER();
+    }
+}
+
+
+static void run_rev_z_to_twist3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rev_z_to_twist3(q, xd);
+        CLOBBER();
+    }
+}
+
+
+static void run_rev_x_from_wrench3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rev_x_from_wrench3(n, w_in, q);
+        CLOBBER();
+    }
+}
+
+
+void inline_bench(void)
+{
+    bench_fill(3 * BENCH_N_MAX, in1);
+    bench_fill(3 * BENCH_N_MAX, in2);
+    bench_fill(BENCH_N_MAX, q);
+    bench_fill(DYN2B_WRENCH3_SIZE * BENCH_N_MAX, w_in);
+
+    bench_run("dyn2b_skw_vec3_inline", 1, 3.0, run_skw_vec3);
+    bench_run("dyn2b_rev_z_to_twist3_inline", 1, 0.0, run_rev_z_to_twist3);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_crs_vec3_inline", n, 9.0 * n, run_crs_vec3);
+        bench_run("dyn2b_rev_x_from_wrench3_inline", n,
+                0.0, run_rev_x_from_wrench3);
+    }
+}
@@ -0,0 +1,589 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/dual.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/screw.h>
+#include <string.h>
+
+#include "bench.h"
+
+
+// Nominal flop counts (cf. bench.h)
+#define FLOP_GEMV3         15.0
+#define FLOP_GEMM3         45.0
+#define FLOP_TF_PROX_ABI3  (8.0 * FLOP_GEMM3 + 3.0 * 12.0 + 2.0 * 18.0)
+#define FLOP_ABI_TO_WRENCH3 (4.0 * FLOP_GEMV3 + 6.0)
+#define FLOP_PROJ_ABI3     (9.0 * 9.0 + 1.0)
+#define FLOP_PROJ_WRENCH3  (3.0 * 6.0)
+#define FLOP_TF_PROX_ABI3P (FLOP_TF_PROX_ABI3 - 3.0 * 15.0 - 3.0 * 18.0)
+// Rotation matrix of the quaternion (cf. screw_bench.c)
+#define FLOP_TF_PROX_ABI3Q (38.0 + FLOP_TF_PROX_ABI3)
+#define FLOP_PROJ_ABI3P    (7.0 * 9.0 + 1.0)
+#define FLOP_AXIS_PROJ_ABI3 (2.0 * FLOP_GEMV3 + 6.0 + 6.0 + 3.0 * 18.0)
+#define FLOP_AXIS_PROJ_WRENCH3 (6.0 + 12.0)
+
+// Largest number of degrees of freedom of the generic joint
+#define DOF_MAX 6
+
+// Number of degrees of freedom of the generic joint in the n-sweep
+#define DOF 2
+
+static double q[BENCH_N_MAX];
+static double x[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static double x_comp[DYN2B_POSE3_SIZE];
+static double xq[DYN2B_POSE3Q_SIZE];
+static double xd[DYN2B_TWIST3_SIZE * BENCH_N_MAX];
+static double w_in[DYN2B_WRENCH3_SIZE * BENCH_N_MAX];
+static double w_out[DYN2B_WRENCH3_SIZE * BENCH_N_MAX];
+static double rbi[DYN2B_RBI3_SIZE] = {
+    // I
+    2.0, 0.1, 0.2,
+    0.1, 3.0, 0.3,
+    0.2, 0.3, 4.0,
+    // h
+    0.1, 0.2, 0.3,
+    // m
+    5.0
+};
+static double rbip[DYN2B_RBI3P_SIZE] = {
+    // I
+    2.0, 0.1, 3.0, 0.2, 0.3, 4.0,
+    // h
+    0.1, 0.2, 0.3,
+    // m
+    5.0
+};
+static double abi_in[DYN2B_ABI3_SIZE * BENCH_N_MAX];
+static double abi_out[DYN2B_ABI3_SIZE * BENCH_N_MAX];
+static double abip_in[DYN2B_ABI3P_SIZE];
+static double abip_out[DYN2B_ABI3P_SIZE];
+static double abi_mat[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
+static double jac[DYN2B_SCREW3_SIZE * DOF_MAX];
+static double d[DOF_MAX * DOF_MAX];
+static double d_inv[DOF_MAX * DOF_MAX];
+static double proj[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
+static double ws[(2 * DOF_MAX + DYN2B_TWIST3_SIZE) * BENCH_N_MAX];
+static double jpc[DYN2B_JPC3_SIZE(DOF_MAX)];
+static double qdd[DOF_MAX];
+
+
+// Composition with the pose of the revolute joints (cosine and sine) and the
+// prismatic joints (joint position)
+#define BENCH_CMP_POSE3_REV(jnt) \
+    dyn2b_##jnt##_cmp_pose3(x, q[0], q[1], x_comp)
+#define BENCH_CMP_POSE3_TRANS(jnt) \
+    dyn2b_##jnt##_cmp_pose3(x, q, x_comp)
+#define BENCH_CMP_POSE3(jnt, type, k) \
+    static void run_##jnt##_cmp_pose3(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            BENCH_CMP_POSE3_##type(jnt); \
+        } \
+    }
+
+DYN2B_JNT_ALIGNED(BENCH_CMP_POSE3)
+
+
+// Joint-specific operators of the revolute and prismatic joints
+#define BENCH_JOINT(jnt) \
+    static void run_##jnt##_to_pose3(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_to_pose3(q, x); \
+        } \
+    } \
+    \
+    static void run_##jnt##_to_twist3(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_to_twist3(q, xd); \
+        } \
+    } \
+    \
+    static void run_##jnt##_from_wrench3(int n, long reps) \
+    { \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_from_wrench3(n, w_in, q); \
+        } \
+    } \
+    \
+    static void run_##jnt##_proj_abi3(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_proj_abi3(d, abi_in, abi_out); \
+        } \
+    } \
+    \
+    static void run_##jnt##_proj_wrench3(int n, long reps) \
+    { \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_proj_wrench3(n, d, abi_in, w_in, w_out); \
+        } \
+    } \
+    \
+    static void run_##jnt##_proj_abi3p(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_proj_abi3p(d, abip_in, abip_out); \
+        } \
+    } \
+    \
+    static void run_##jnt##_proj_wrench3p(int n, long reps) \
+    { \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_proj_wrench3p(n, d, abip_in, w_in, w_out); \
+        } \
+    } \
+    \
+    static void bench_##jnt(void) \
+    { \
+        bench_run("dyn2b_" #jnt "_to_pose3", 1, \
+                0.0, run_##jnt##_to_pose3); \
+        bench_run("dyn2b_" #jnt "_cmp_pose3", 1, \
+                0.0, run_##jnt##_cmp_pose3); \
+        bench_run("dyn2b_" #jnt "_to_twist3", 1, \
+                0.0, run_##jnt##_to_twist3); \
+        bench_run("dyn2b_" #jnt "_proj_abi3", 1, \
+                FLOP_PROJ_ABI3, run_##jnt##_proj_abi3); \
+        bench_run("dyn2b_" #jnt "_proj_abi3p", 1, \
+                FLOP_PROJ_ABI3P, run_##jnt##_proj_abi3p); \
+        BENCH_SWEEP(n) { \
+            bench_run("dyn2b_" #jnt "_from_wrench3", n, \
+                    0.0, run_##jnt##_from_wrench3); \
+            bench_run("dyn2b_" #jnt "_proj_wrench3", n, \
+                    FLOP_PROJ_WRENCH3 * n, run_##jnt##_proj_wrench3); \
+            bench_run("dyn2b_" #jnt "_proj_wrench3p", n, \
+                    FLOP_PROJ_WRENCH3 * n, run_##jnt##_proj_wrench3p); \
+        } \
+    }
+
+BENCH_JOINT(rev_x)
+BENCH_JOINT(rev_y)
+BENCH_JOINT(rev_z)
+BENCH_JOINT(trans_x)
+BENCH_JOINT(trans_y)
+BENCH_JOINT(trans_z)
+
+
+// Revolute and prismatic joints with an arbitrary axis
+static double axis[DYN2B_AXIS3_SIZE];
+static double q_dual[DYN2B_DUAL_SIZE(1)];
+static double x_dual[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)];
+static double xd_dual[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+
+#define BENCH_AXIS(jnt) \
+    static void run_##jnt##_to_pose3(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_to_pose3(axis, q, x); \
+        } \
+    } \
+    \
+    static void run_##jnt##_to_twist3(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_to_twist3(axis, q, xd); \
+        } \
+    } \
+    \
+    static void run_##jnt##_to_pose3_dual(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_to_pose3_dual(axis, q_dual, x_dual); \
+        } \
+    } \
+    \
+    static void run_##jnt##_to_twist3_dual(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_to_twist3_dual(axis, q_dual, xd_dual); \
+        } \
+    } \
+    \
+    static void run_##jnt##_from_wrench3(int n, long reps) \
+    { \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_from_wrench3(n, axis, w_in, q); \
+        } \
+    } \
+    \
+    static void run_##jnt##_proj_abi3(int n, long reps) \
+    { \
+        (void)n; \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_proj_abi3(axis, d, abi_in, abi_out); \
+        } \
+    } \
+    \
+    static void run_##jnt##_proj_wrench3(int n, long reps) \
+    { \
+        for (long i = 0; i < reps; i++) { \
+            dyn2b_##jnt##_proj_wrench3(n, axis, d, abi_in, w_in, w_out); \
+        } \
+    } \
+    \
+    static void bench_##jnt(void) \
+    { \
+        bench_run("dyn2b_" #jnt "_to_pose3", 1, \
+                0.0, run_##jnt##_to_pose3); \
+        bench_run("dyn2b_" #jnt "_to_twist3", 1, \
+                0.0, run_##jnt##_to_twist3); \
+        bench_run("dyn2b_" #jnt "_to_pose3_dual", 1, \
+                0.0, run_##jnt##_to_pose3_dual); \
+        bench_run("dyn2b_" #jnt "_to_twist3_dual", 1, \
+                0.0, run_##jnt##_to_twist3_dual); \
+        bench_run("dyn2b_" #jnt "_proj_abi3", 1, \
+                FLOP_AXIS_PROJ_ABI3, run_##jnt##_proj_abi3); \
+        BENCH_SWEEP(n) { \
+            bench_run("dyn2b_" #jnt "_from_wrench3", n, \
+                    5.0 * n, run_##jnt##_from_wrench3); \
+            bench_run("dyn2b_" #jnt "_proj_wrench3", n, \
+                    FLOP_AXIS_PROJ_WRENCH3 * n, run_##jnt##_proj_wrench3); \
+        } \
+    }
+
+BENCH_AXIS(rev)
+BENCH_AXIS(trans)
+
+
+static void run_to_abi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_to_abi3(rbi, abi_out);
+    }
+}
+
+
+static void run_tf_prox_abi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_abi3(x, abi_in, abi_out);
+    }
+}
+
+
+static void run_tf_prox_abi3q(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_abi3q(xq, abi_in, abi_out);
+    }
+}
+
+
+static void run_tf_prox_abi3_batch(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_abi3_batch(n, n, x, abi_in, abi_out);
+    }
+}
+
+
+static void run_tf_prox_abi3p(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_abi3p(x, abip_in, abip_out);
+    }
+}
+
+
+static void run_abi_to_wrench3p(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_abi_to_wrench3p(n, abip_in, xd, w_out);
+    }
+}
+
+
+static void run_pck_abi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_pck_abi3(abi_in, abip_out);
+    }
+}
+
+
+static void run_to_axis3(int n, long reps)
+{
+    (void)n;
+
+    double dir[3] = { 1.0, 2.0, 3.0 };
+    for (long i = 0; i < reps; i++) {
+        dyn2b_to_axis3(dir, axis);
+    }
+}
+
+
+static void run_to_abi3p(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_to_abi3p(rbip, abip_out);
+    }
+}
+
+
+static void run_unp_abi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_unp_abi3(abip_in, abi_out);
+    }
+}
+
+
+static void run_abi_to_wrench3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_abi_to_wrench3(n, abi_in, xd, w_out);
+    }
+}
+
+
+static void run_to_mat_abi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_to_mat_abi3(abi_in, abi_mat);
+    dyn2b_pck_abi3(abi_in, abip_in);
+    }
+}
+
+
+static void run_to_tup_abi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_to_tup_abi3(abi_mat, abi_out);
+    }
+}
+
+
+// The generic joint's operators take the number of degrees of freedom as n
+static void run_jnt_inv_abi3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_inv_abi3(n, jac, abi_mat, d, d_inv);
+    }
+}
+
+
+static void run_jnt_fct_abi3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_fct_abi3(n, jac, abi_mat, d, d_inv);
+    }
+}
+
+
+static void run_jnt_to_proj3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_to_proj3(n, jac, d, abi_in, proj);
+    }
+}
+
+
+static void run_jnt_proj_abi3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_proj_abi3(n, jac, d, abi_in, abi_out);
+    }
+}
+
+
+static void run_jnt_proj_wrench3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_proj_wrench3(n, DOF, jac, d, abi_in, w_in, w_out);
+    }
+}
+
+
+static void run_jnt_proj_wrench3_ws(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_proj_wrench3_ws(n, DOF, jac, d, abi_in, w_in, w_out, ws);
+    }
+}
+
+
+static void run_jnt_to_jpc3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_to_jpc3(n, jac, d, abi_in, jpc);
+    }
+}
+
+
+static void run_jnt_proj_abi3_jpc(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_proj_abi3_jpc(n, jpc, abi_in, abi_out);
+    }
+}
+
+
+static void run_jnt_acc3_jpc(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_acc3_jpc(n, jpc, q, xd, qdd);
+    }
+}
+
+
+static void run_jnt_proj_wrench3_jpc(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_proj_wrench3_jpc(n, DOF, jac, jpc, w_in, w_out, ws);
+    }
+}
+
+
+// Identity actuator inertia for a joint with dof degrees of freedom
+static void set_d(int dof)
+{
+    memset(d, 0, sizeof(d));
+    for (int i = 0; i < dof; i++) {
+        d[(dof * i) + i] = 1.0;
+    }
+}
+
+
+static double flop_jnt_inv_abi3(int dof)
+{
+    // M S, S^T (M S), (.)^{-1}
+    return 72.0 * dof + 12.0 * dof * dof + 1.0 * dof * dof * dof;
+}
+
+
+static double flop_jnt_to_proj3(int dof)
+{
+    // D^{-1}, S D^{-1}, (S D^{-1}) S^T, 1 - M (.)
+    return flop_jnt_inv_abi3(dof) + 12.0 * dof * dof + 72.0 * dof + 432.0;
+}
+
+
+static double flop_jnt_to_jpc3(int dof)
+{
+    // U = M S, D = d + S^T U, D^{-1}, U D^{-1}
+    return 66.0 * dof + 12.0 * dof * dof + 1.0 * dof * dof * dof
+            + 12.0 * dof * dof;
+}
+
+
+static double flop_jnt_proj_abi3(int dof)
+{
+    // Context, M - (U D^{-1}) U^T
+    return flop_jnt_to_jpc3(dof) + 54.0 * dof;
+}
+
+
+void joint_bench(void)
+{
+    bench_fill(BENCH_N_MAX, q);
+    bench_fill(DYN2B_POSE3_SIZE * BENCH_N_MAX, x);
+    bench_fill(DYN2B_TWIST3_SIZE * BENCH_N_MAX, xd);
+    bench_fill(DYN2B_WRENCH3_SIZE * BENCH_N_MAX, w_in);
+    bench_fill(DYN2B_DUAL_SIZE(1), q_dual);
+    bench_fill(DYN2B_POSE3Q_SIZE, xq);
+
+    // Symmetric, positive-definite inertia
+    for (int i = 0; i < BENCH_N_MAX; i++) {
+        dyn2b_to_abi3(rbi, &abi_in[DYN2B_ABI3_SIZE * i]);
+    }
+    dyn2b_to_mat_abi3(abi_in, abi_mat);
+    dyn2b_pck_abi3(abi_in, abip_in);
+    memset(jac, 0, sizeof(jac));
+    for (int i = 0; i < DOF_MAX; i++) {
+        jac[(DYN2B_SCREW3_SIZE * i) + i] = 1.0;
+    }
+
+    set_d(1);
+    bench_rev_x();
+    bench_rev_y();
+    bench_rev_z();
+    bench_trans_x();
+    bench_trans_y();
+    bench_trans_z();
+
+    bench_run("dyn2b_to_axis3", 1, 0.0, run_to_axis3);
+    bench_rev();
+    bench_trans();
+
+    bench_run("dyn2b_to_abi3", 1, 3.0, run_to_abi3);
+    bench_run("dyn2b_tf_prox_abi3", 1, FLOP_TF_PROX_ABI3, run_tf_prox_abi3);
+    bench_run("dyn2b_tf_prox_abi3q", 1,
+            FLOP_TF_PROX_ABI3Q, run_tf_prox_abi3q);
+    bench_run("dyn2b_to_mat_abi3", 1, 0.0, run_to_mat_abi3);
+    bench_run("dyn2b_to_tup_abi3", 1, 0.0, run_to_tup_abi3);
+    bench_run("dyn2b_pck_abi3", 1, 0.0, run_pck_abi3);
+    bench_run("dyn2b_unp_abi3", 1, 0.0, run_unp_abi3);
+    bench_run("dyn2b_to_abi3p", 1, 0.0, run_to_abi3p);
+    bench_run("dyn2b_tf_prox_abi3p", 1, FLOP_TF_PROX_ABI3P, run_tf_prox_abi3p);
+
+    set_d(DOF);
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_tf_prox_abi3_batch", n,
+                FLOP_TF_PROX_ABI3 * n, run_tf_prox_abi3_batch);
+        bench_run("dyn2b_abi_to_wrench3", n,
+                FLOP_ABI_TO_WRENCH3 * n, run_abi_to_wrench3);
+        bench_run("dyn2b_abi_to_wrench3p", n,
+                FLOP_ABI_TO_WRENCH3 * n, run_abi_to_wrench3p);
+        bench_run("dyn2b_jnt_proj_wrench3", n,
+                flop_jnt_inv_abi3(DOF)
+                        + (24.0 * DOF + 2.0 * DOF * DOF + 72.0) * n,
+                run_jnt_proj_wrench3);
+        bench_run("dyn2b_jnt_proj_wrench3_ws", n,
+                flop_jnt_inv_abi3(DOF)
+                        + (24.0 * DOF + 2.0 * DOF * DOF + 72.0) * n,
+                run_jnt_proj_wrench3_ws);
+    }
+
+    dyn2b_jnt_to_jpc3(DOF, jac, d, abi_in, jpc);
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_jnt_proj_wrench3_jpc", n,
+                (24.0 * DOF) * n, run_jnt_proj_wrench3_jpc);
+    }
+
+    for (int dof = 1; dof <= DOF_MAX; dof++) {
+        set_d(dof);
+        bench_run("dyn2b_jnt_inv_abi3", dof,
+                flop_jnt_inv_abi3(dof), run_jnt_inv_abi3);
+        bench_run("dyn2b_jnt_fct_abi3", dof,
+                flop_jnt_inv_abi3(dof), run_jnt_fct_abi3);
+        bench_run("dyn2b_jnt_to_proj3", dof,
+                flop_jnt_to_proj3(dof), run_jnt_to_proj3);
+        bench_run("dyn2b_jnt_proj_abi3", dof,
+                flop_jnt_proj_abi3(dof), run_jnt_proj_abi3);
+        bench_run("dyn2b_jnt_to_jpc3", dof,
+                flop_jnt_to_jpc3(dof), run_jnt_to_jpc3);
+        bench_run("dyn2b_jnt_proj_abi3_jpc", dof,
+                54.0 * dof, run_jnt_proj_abi3_jpc);
+        bench_run("dyn2b_jnt_acc3_jpc", dof,
+                2.0 * dof * dof + 13.0 * dof, run_jnt_acc3_jpc);
+    }
+}
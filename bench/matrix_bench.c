@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/matrix.h>
+
+#include "bench.h"
+
+
+// Matrices with 6 rows (e.g. a collection of n screws)
+#define M 6
+
+static double in1[M * BENCH_N_MAX];
+static double in2[M * BENCH_N_MAX];
+static double out[M * BENCH_N_MAX];
+
+// Symmetric, positive-definite matrix for the factorization (n <= M)
+static double spd[M * M];
+static double fct[M * M];
+
+
+static void run_cpy_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cpy_mat(n, M, in1, M, out, M);
+    }
+}
+
+
+static void run_mad_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_mad_mat(n, M, 2.0, in1, M, in2, M, out, M);
+    }
+}
+
+
+static void run_ldl_fct_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_ldl_fct_mat(n, spd, M, fct);
+    }
+}
+
+
+static void run_ldl_slv_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_ldl_slv_mat(n, M, fct, in1, M, out, M);
+    }
+}
+
+
+void matrix_bench(void)
+{
+    bench_fill(M * BENCH_N_MAX, in1);
+    bench_fill(M * BENCH_N_MAX, in2);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_cpy_mat", n, 0.0, run_cpy_mat);
+        bench_run("dyn2b_mad_mat", n, 2.0 * M * n, run_mad_mat);
+    }
+
+    for (int c = 0; c < M; c++) {
+        for (int r = 0; r < M; r++) {
+            spd[(M * c) + r] = (r == c) ? 2.0 * M : 1.0;
+        }
+    }
+
+    for (int n = 1; n <= M; n++) {
+        dyn2b_ldl_fct_mat(n, spd, M, fct);
+        bench_run("dyn2b_ldl_fct_mat", n,
+                n * n * n / 3.0 + n, run_ldl_fct_mat);
+        // M right-hand sides (e.g. the transposed joint Jacobian)
+        bench_run("dyn2b_ldl_slv_mat", n,
+                M * (2.0 * n * n + n), run_ldl_slv_mat);
+    }
+}
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/mechanics.h>
+#include <dyn2b/types/dual.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/screw.h>
+
+#include "bench.h"
+
+
+// Nominal flop counts (cf. bench.h)
+#define FLOP_TF_DIST_ACC3   (42.0 + 36.0)
+#define FLOP_RBI_TO_WRENCH3 (2.0 * 9.0 + 18.0 + 6.0)
+#define FLOP_NRT_WRENCH3    (FLOP_RBI_TO_WRENCH3 + 30.0)
+// Per velocity variation: inertia times variation, cross product and
+// cross-add (cf. dyn2b_nrt_wrench3_dxd())
+#define FLOP_NRT_WRENCH3_DXD (FLOP_RBI_TO_WRENCH3 + 30.0 + 36.0)
+#define FLOP_EOM_WRENCH3    (2.0 * FLOP_RBI_TO_WRENCH3 + 30.0 + 6.0)
+#define FLOP_TF_PROX_RBI3   (4.0 * 45.0 + 15.0 + 6.0 + 2.0 * 9.0)
+
+// Dual versions: value plus the product rule per tangent direction, the
+// inertia is constant (cf. screw_bench.c)
+#define FLOP_TF_DIST_ACC3_DUAL (FLOP_TF_DIST_ACC3 \
+                                + DYN2B_DUAL_K * (2.0 * FLOP_TF_DIST_ACC3 + 9.0))
+#define FLOP_RBI_TO_WRENCH3_DUAL ((1.0 + DYN2B_DUAL_K) * FLOP_RBI_TO_WRENCH3)
+#define FLOP_NRT_WRENCH3_DUAL (FLOP_NRT_WRENCH3 \
+                               + DYN2B_DUAL_K * FLOP_NRT_WRENCH3_DXD)
+#define FLOP_EOM_WRENCH3_DUAL (FLOP_EOM_WRENCH3 \
+                               + DYN2B_DUAL_K * (FLOP_RBI_TO_WRENCH3 \
+                                                 + FLOP_NRT_WRENCH3_DXD + 6.0))
+
+static double x[DYN2B_POSE3_SIZE];
+static double xd_abs[DYN2B_TWIST3_SIZE];
+static double xd_rel[DYN2B_TWIST3_SIZE];
+static double xdd_prox[DYN2B_TWIST3_SIZE];
+static double xdd_dist[DYN2B_TWIST3_SIZE];
+static double rbi[DYN2B_RBI3_SIZE];
+static double rbip[DYN2B_RBI3P_SIZE];
+static double rbi_prox[DYN2B_RBI3_SIZE];
+static double w[DYN2B_WRENCH3_SIZE];
+static double x_dual[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)];
+static double xd_abs_dual[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+static double xd_rel_dual[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+static double xdd_prox_dual[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+static double xdd_dist_dual[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+static double w_dual[DYN2B_DUAL_SIZE(DYN2B_WRENCH3_SIZE)];
+static double xd_drv[DYN2B_TWIST3_SIZE * BENCH_N_MAX];
+static double w_drv[DYN2B_WRENCH3_SIZE * BENCH_N_MAX];
+
+
+static void run_tf_dist_acc3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_acc3(x, xd_abs, xd_rel, xdd_prox, xdd_dist);
+    }
+}
+
+
+static void run_rbi_to_wrench3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rbi_to_wrench3(rbi, xdd_prox, w);
+    }
+}
+
+
+static void run_nrt_wrench3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_nrt_wrench3(rbi, xd_abs, w);
+    }
+}
+
+
+static void run_nrt_wrench3_dxd(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_nrt_wrench3_dxd(n, rbi, xd_abs, xd_drv, w_drv);
+    }
+}
+
+
+static void run_eom_wrench3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_eom_wrench3(rbi, xd_abs, xdd_prox, w);
+    }
+}
+
+
+static void run_pck_rbi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_pck_rbi3(rbi, rbip);
+    }
+}
+
+
+static void run_unp_rbi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_unp_rbi3(rbip, rbi_prox);
+    }
+}
+
+
+static void run_rbi_to_wrench3p(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rbi_to_wrench3p(rbip, xdd_prox, w);
+    }
+}
+
+
+static void run_nrt_wrench3p(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_nrt_wrench3p(rbip, xd_abs, w);
+    }
+}
+
+
+static void run_tf_prox_rbi3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_rbi3(x, rbi, rbi_prox);
+    }
+}
+
+
+static void run_tf_dist_acc3_dual(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_acc3_dual(x_dual, xd_abs_dual, xd_rel_dual,
+                xdd_prox_dual, xdd_dist_dual);
+    }
+}
+
+
+static void run_rbi_to_wrench3_dual(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rbi_to_wrench3_dual(rbi, xdd_prox_dual, w_dual);
+    }
+}
+
+
+static void run_nrt_wrench3_dual(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_nrt_wrench3_dual(rbi, xd_abs_dual, w_dual);
+    }
+}
+
+
+static void run_eom_wrench3_dual(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_eom_wrench3_dual(rbi, xd_abs_dual, xdd_prox_dual, w_dual);
+    }
+}
+
+
+void mechanics_bench(void)
+{
+    bench_fill(DYN2B_POSE3_SIZE, x);
+    bench_fill(DYN2B_TWIST3_SIZE, xd_abs);
+    bench_fill(DYN2B_TWIST3_SIZE, xd_rel);
+    bench_fill(DYN2B_TWIST3_SIZE, xdd_prox);
+    bench_fill(DYN2B_RBI3_SIZE, rbi);
+    bench_fill(DYN2B_TWIST3_SIZE * BENCH_N_MAX, xd_drv);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE), x_dual);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE), xd_abs_dual);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE), xd_rel_dual);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE), xdd_prox_dual);
+    dyn2b_pck_rbi3(rbi, rbip);
+
+    bench_run("dyn2b_tf_dist_acc3", 1, FLOP_TF_DIST_ACC3, run_tf_dist_acc3);
+    bench_run("dyn2b_rbi_to_wrench3", 1,
+            FLOP_RBI_TO_WRENCH3, run_rbi_to_wrench3);
+    bench_run("dyn2b_nrt_wrench3", 1, FLOP_NRT_WRENCH3, run_nrt_wrench3);
+    bench_run("dyn2b_eom_wrench3", 1, FLOP_EOM_WRENCH3, run_eom_wrench3);
+    bench_run("dyn2b_tf_prox_rbi3", 1, FLOP_TF_PROX_RBI3, run_tf_prox_rbi3);
+    bench_run("dyn2b_pck_rbi3", 1, 0.0, run_pck_rbi3);
+    bench_run("dyn2b_unp_rbi3", 1, 0.0, run_unp_rbi3);
+    bench_run("dyn2b_rbi_to_wrench3p", 1,
+            FLOP_RBI_TO_WRENCH3, run_rbi_to_wrench3p);
+    bench_run("dyn2b_nrt_wrench3p", 1, FLOP_NRT_WRENCH3, run_nrt_wrench3p);
+    bench_run("dyn2b_tf_dist_acc3_dual", 1,
+            FLOP_TF_DIST_ACC3_DUAL, run_tf_dist_acc3_dual);
+    bench_run("dyn2b_rbi_to_wrench3_dual", 1,
+            FLOP_RBI_TO_WRENCH3_DUAL, run_rbi_to_wrench3_dual);
+    bench_run("dyn2b_nrt_wrench3_dual", 1,
+            FLOP_NRT_WRENCH3_DUAL, run_nrt_wrench3_dual);
+    bench_run("dyn2b_eom_wrench3_dual", 1,
+            FLOP_EOM_WRENCH3_DUAL, run_eom_wrench3_dual);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_nrt_wrench3_dxd", n,
+                FLOP_RBI_TO_WRENCH3 + FLOP_NRT_WRENCH3_DXD * n,
+                run_nrt_wrench3_dxd);
+    }
+}
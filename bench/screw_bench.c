@@ -0,0 +1,329 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/dual.h>
+
+#include "bench.h"
+
+
+// Nominal flop counts (cf. bench.h)
+#define FLOP_CRS_VEC3       9.0
+#define FLOP_GEMV3         15.0
+#define FLOP_GEMM3         45.0
+#define FLOP_CMP_POSE3     (FLOP_GEMM3 + FLOP_GEMV3 + 3.0)
+// Quaternion product (28) and rotation of the position (33)
+#define FLOP_CMP_POSE3Q    61.0
+// Shepperd's method (one branch, sqrt not counted), the rotation matrix of a
+// quaternion including its scaling by the norm and the renormalization
+#define FLOP_TO_POSE3Q     13.0
+#define FLOP_TO_MAT_POSE3Q 38.0
+#define FLOP_NRM_POSE3Q    12.0
+#define FLOP_CRS_SCREW3    (3.0 * FLOP_CRS_VEC3 + 3.0)
+#define FLOP_CAD_SCREW3    (FLOP_CRS_SCREW3 + 6.0)
+#define FLOP_ROT_SCREW3    (2.0 * FLOP_GEMV3)
+#define FLOP_TF_SCREW3     (FLOP_ROT_SCREW3 + FLOP_CRS_VEC3 + 3.0)
+
+// Dual versions: value plus the product rule per tangent direction
+#define FLOP_CMP_POSE3_DUAL (FLOP_CMP_POSE3 \
+                             + DYN2B_DUAL_K * 2.0 * FLOP_CMP_POSE3)
+#define FLOP_TF_SCREW3_DUAL (FLOP_TF_SCREW3 \
+                             + DYN2B_DUAL_K * (2.0 * FLOP_TF_SCREW3 + 9.0))
+#define FLOP_CRS_SCREW3_DUAL (FLOP_CRS_SCREW3 \
+                              + DYN2B_DUAL_K * (2.0 * FLOP_CRS_SCREW3 + 6.0))
+
+static double x1[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static double x2[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static double x3[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static double s1[DYN2B_SCREW3_SIZE * BENCH_N_MAX];
+static double s2[DYN2B_SCREW3_SIZE * BENCH_N_MAX];
+static double s3[DYN2B_SCREW3_SIZE * BENCH_N_MAX];
+static double s4[DYN2B_SCREW3_SIZE * BENCH_N_MAX];
+static double dot[BENCH_N_MAX * BENCH_N_MAX];
+static double ws[3 * BENCH_N_MAX];
+static double xd1[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)];
+static double xd2[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)];
+static double xd3[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)];
+static double sd1[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE * BENCH_N_MAX)];
+static double sd2[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE * BENCH_N_MAX)];
+static double sd3[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE)];
+static double xq1[DYN2B_POSE3Q_SIZE];
+static double xq2[DYN2B_POSE3Q_SIZE];
+static double xq3[DYN2B_POSE3Q_SIZE];
+static double xr[DYN2B_POSE3_SIZE];
+
+
+static void run_cmp_pose3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cmp_pose3(x1, x2, x3);
+    }
+}
+
+
+static void run_cmp_pose3q(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cmp_pose3q(xq1, xq2, xq3);
+    }
+}
+
+
+static void run_to_pose3q(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_to_pose3q(xr, xq3);
+    }
+}
+
+
+static void run_to_mat_pose3q(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_to_mat_pose3q(xq1, x3);
+    }
+}
+
+
+static void run_nrm_pose3q(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_nrm_pose3q(xq3);
+    }
+}
+
+
+static void run_cmp_pose3_batch(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cmp_pose3_batch(n, n, x1, x2, x3);
+    }
+}
+
+
+static void run_dot_screw3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_dot_screw3(n, n, s1, s2, dot);
+    }
+}
+
+
+static void run_crs_screw3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_crs_screw3(s1, s2, s4);
+    }
+}
+
+
+static void run_cad_screw3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cad_screw3(s1, s2, s3, s4);
+    }
+}
+
+
+static void run_rot_dist_screw3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rot_dist_screw3(n, x1, s1, s4);
+    }
+}
+
+
+static void run_tf_dist_screw3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_screw3(n, x1, s1, s4);
+    }
+}
+
+
+static void run_tf_dist_screw3_ws(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_screw3_ws(n, x1, s1, s4, ws);
+    }
+}
+
+
+static void run_tf_dist_screw3q(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_screw3q(n, xq1, s1, s4);
+    }
+}
+
+
+static void run_tf_dist_screw3_batch(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_screw3_batch(n, n, x1, s1, s4);
+    }
+}
+
+
+static void run_tf_dist_screw3_dq(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_screw3_dq(n, s3, s1, s4);
+    }
+}
+
+
+static void run_rot_prox_screw3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rot_prox_screw3(n, x1, s1, s4);
+    }
+}
+
+
+static void run_tf_prox_screw3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_screw3(n, x1, s1, s4);
+    }
+}
+
+
+static void run_tf_prox_screw3q(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_screw3q(n, xq1, s1, s4);
+    }
+}
+
+
+static void run_tf_prox_screw3_dq(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_screw3_dq(n, x1, s3, s1, s4);
+    }
+}
+
+
+static void run_tf_prox_screw3_batch(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_screw3_batch(n, n, x1, s1, s4);
+    }
+}
+
+
+static void run_cmp_pose3_dual(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cmp_pose3_dual(xd1, xd2, xd3);
+    }
+}
+
+
+static void run_crs_screw3_dual(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_crs_screw3_dual(sd1, sd2, sd3);
+    }
+}
+
+
+static void run_tf_dist_screw3_dual(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_dist_screw3_dual(n, xd1, sd1, sd2);
+    }
+}
+
+
+static void run_tf_prox_screw3_dual(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_tf_prox_screw3_dual(n, xd1, sd1, sd2);
+    }
+}
+
+
+void screw_bench(void)
+{
+    bench_fill(DYN2B_POSE3_SIZE * BENCH_N_MAX, x1);
+    bench_fill(DYN2B_POSE3_SIZE * BENCH_N_MAX, x2);
+    bench_fill(DYN2B_SCREW3_SIZE * BENCH_N_MAX, s1);
+    bench_fill(DYN2B_SCREW3_SIZE * BENCH_N_MAX, s2);
+    bench_fill(DYN2B_SCREW3_SIZE * BENCH_N_MAX, s3);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE), xd1);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE), xd2);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE * BENCH_N_MAX), sd1);
+    bench_fill(DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE * BENCH_N_MAX), sd2);
+    bench_fill(DYN2B_POSE3Q_SIZE, xq1);
+    bench_fill(DYN2B_POSE3Q_SIZE, xq2);
+    bench_fill(DYN2B_POSE3Q_SIZE, xq3);
+    dyn2b_to_mat_pose3q(xq1, xr);
+
+    bench_run("dyn2b_cmp_pose3", 1, FLOP_CMP_POSE3, run_cmp_pose3);
+    bench_run("dyn2b_cmp_pose3q", 1, FLOP_CMP_POSE3Q, run_cmp_pose3q);
+    bench_run("dyn2b_to_pose3q", 1, FLOP_TO_POSE3Q, run_to_pose3q);
+    bench_run("dyn2b_to_mat_pose3q", 1,
+            FLOP_TO_MAT_POSE3Q, run_to_mat_pose3q);
+    bench_run("dyn2b_nrm_pose3q", 1, FLOP_NRM_POSE3Q, run_nrm_pose3q);
+    bench_run("dyn2b_crs_screw3", 1, FLOP_CRS_SCREW3, run_crs_screw3);
+    bench_run("dyn2b_cad_screw3", 1, FLOP_CAD_SCREW3, run_cad_screw3);
+    bench_run("dyn2b_cmp_pose3_dual", 1, FLOP_CMP_POSE3_DUAL,
+            run_cmp_pose3_dual);
+    bench_run("dyn2b_crs_screw3_dual", 1, FLOP_CRS_SCREW3_DUAL,
+            run_crs_screw3_dual);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_cmp_pose3_batch", n,
+                FLOP_CMP_POSE3 * n, run_cmp_pose3_batch);
+        bench_run("dyn2b_dot_screw3", n,
+                11.0 * n * n, run_dot_screw3);
+        bench_run("dyn2b_rot_dist_screw3", n,
+                FLOP_ROT_SCREW3 * n, run_rot_dist_screw3);
+        bench_run("dyn2b_tf_dist_screw3", n,
+                FLOP_TF_SCREW3 * n, run_tf_dist_screw3);
+        bench_run("dyn2b_tf_dist_screw3_ws", n,
+                FLOP_TF_SCREW3 * n, run_tf_dist_screw3_ws);
+        bench_run("dyn2b_tf_dist_screw3q", n,
+                FLOP_TO_MAT_POSE3Q + FLOP_TF_SCREW3 * n,
+                run_tf_dist_screw3q);
+        bench_run("dyn2b_tf_dist_screw3_batch", n,
+                FLOP_TF_SCREW3 * n, run_tf_dist_screw3_batch);
+        bench_run("dyn2b_tf_dist_screw3_dq", n,
+                FLOP_CRS_SCREW3 * n, run_tf_dist_screw3_dq);
+        bench_run("dyn2b_rot_prox_screw3", n,
+                FLOP_ROT_SCREW3 * n, run_rot_prox_screw3);
+        bench_run("dyn2b_tf_prox_screw3", n,
+                FLOP_TF_SCREW3 * n, run_tf_prox_screw3);
+        bench_run("dyn2b_tf_prox_screw3q", n,
+                FLOP_TO_MAT_POSE3Q + FLOP_TF_SCREW3 * n,
+                run_tf_prox_screw3q);
+        bench_run("dyn2b_tf_prox_screw3_batch", n,
+                FLOP_TF_SCREW3 * n, run_tf_prox_screw3_batch);
+        bench_run("dyn2b_tf_prox_screw3_dq", n,
+                (FLOP_CRS_SCREW3 + FLOP_TF_SCREW3) * n,
+                run_tf_prox_screw3_dq);
+        bench_run("dyn2b_tf_dist_screw3_dual", n,
+                FLOP_TF_SCREW3_DUAL * n, run_tf_dist_screw3_dual);
+        bench_run("dyn2b_tf_prox_screw3_dual", n,
+                FLOP_TF_SCREW3_DUAL * n, run_tf_prox_screw3_dual);
+    }
+}
@@ -0,0 +1,455 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/fk.h>
+#include <dyn2b/solvers/rnea.h>
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/achd.h>
+#include <dyn2b/solvers/crba.h>
+#include <dyn2b/solvers/rnea_drv.h>
+#include <dyn2b/solvers/tree.h>
+#ifdef DYN2B_BENCH_FLOAT
+#  include <dyn2b/solvers/abaf.h>
+#  include <dyn2b/solvers/aba_mixed.h>
+#endif
+#include <dyn2b/functions/matrix.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/screw.h>
+#include <string.h>
+
+#include "bench.h"
+
+
+// Nominal flop counts per body (cf. bench.h): compose the pose, transform the
+// velocity, the acceleration (dyn2b_tf_dist_acc3) and the wrench, evaluate the
+// equations of motion (dyn2b_eom_wrench3) and accumulate in the parent
+#define FLOP_CMP_POSE3      (45.0 + 18.0)
+#define FLOP_TF_SCREW3      (2.0 * 15.0 + 12.0)
+#define FLOP_RNEA_BODY      (FLOP_CMP_POSE3 + 2.0 * FLOP_TF_SCREW3 + 78.0 \
+                                + 120.0 + 3.0 * 6.0)
+
+// Nominal flop counts per body of the ABA sweeps: the velocity sweep replaces
+// the equations of motion by the bias wrench (dyn2b_nrt_wrench3), the inertia
+// sweep projects (cf. joint_bench.c) and transforms the articulated-body
+// inertia (dyn2b_tf_prox_abi3) and the acceleration sweep solves for the
+// joint acceleration
+#define FLOP_ABI_TO_WRENCH3 (4.0 * 15.0 + 6.0)
+#define FLOP_ABA_VEL_BODY   (FLOP_CMP_POSE3 + 2.0 * FLOP_TF_SCREW3 + 78.0 \
+                                + 72.0)
+#define FLOP_ABA_ABI_BODY   (2.0 * FLOP_ABI_TO_WRENCH3 + (9.0 * 9.0 + 1.0) \
+                                + 3.0 * 6.0 + (8.0 * 45.0 + 3.0 * 12.0 \
+                                + 2.0 * 18.0) + FLOP_TF_SCREW3 + 27.0 + 6.0 \
+                                + 3.0 * 6.0)
+#define FLOP_ABA_ACC_BODY   (FLOP_TF_SCREW3 + 6.0 + 12.0 + 2.0 + 6.0)
+#define FLOP_ABA_BODY       (FLOP_ABA_VEL_BODY + FLOP_ABA_ABI_BODY \
+                                + FLOP_ABA_ACC_BODY)
+
+// Nominal flop counts per body of the ACHD with nc constraints: the ABA plus
+// projecting (dyn2b_*_proj_wrench3), transforming (dyn2b_tf_prox_screw3) and
+// pairing (dyn2b_dot_screw3) the 6 x nc block of unit constraint wrenches
+#define FLOP_ACHD_BODY(nc)  (FLOP_ABA_BODY + 99.0 * (nc) + 13.0 * (nc) * (nc))
+
+// Nominal flop counts per body of the CRBA without the projections onto the
+// ancestors' joints: compose the pose, transform the composite inertia
+// (dyn2b_tf_prox_rbi3) and map the joint's motion into a wrench
+#define FLOP_CRBA_BODY      (FLOP_CMP_POSE3 + (4.0 * 45.0 + 39.0) + 13.0 \
+                                + 42.0)
+
+// Nominal flop counts of the RNEA derivatives: per body, compose the pose
+// with respect to the base, transform the joint twist and the inertia
+// (dyn2b_tf_prox_rbi3), evaluate the equations of motion, build the 6 x 3 bias
+// matrix (dyn2b_nrt_wrench3_dxd) and accumulate the composite quantities; per
+// pair of a body and an ancestor-or-self, the eight pairings of wrenches with
+// twists
+#define FLOP_RNEA_DRV_BODY  (2.0 * FLOP_CMP_POSE3 + FLOP_TF_SCREW3 \
+                                + (4.0 * 45.0 + 39.0) + 120.0 + 3.0 * 30.0 \
+                                + 3.0 * (2.0 * 66.0 + 2.0 * 30.0 + 6.0) \
+                                + 4.0 * 66.0 + 2.0 * 36.0 + 3.0 * 11.0 \
+                                + 13.0 + 18.0 + 6.0)
+#define FLOP_RNEA_DRV_PAIR  (8.0 * 11.0 + 4.0)
+
+// Humanoid-like tree: a floating base as a chain of six joints with four
+// limbs of six joints each
+#define NB_HUMANOID 30
+
+// Largest number of constraints: full-rank constraints on two bodies
+#define NC_MAX 12
+
+static int parent[BENCH_N_MAX];
+static int jnt[BENCH_N_MAX];
+static double axis[DYN2B_AXIS3_SIZE * BENCH_N_MAX];
+static double x_tree[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static double rbi[DYN2B_RBI3_SIZE * BENCH_N_MAX];
+static double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+static double q[BENCH_N_MAX];
+static double qd[BENCH_N_MAX];
+static double qdd[BENCH_N_MAX];
+static double tau[BENCH_N_MAX];
+static double d[BENCH_N_MAX];
+static int con_body[NC_MAX];
+static double alpha[DYN2B_WRENCH3_SIZE * NC_MAX];
+static double beta[NC_MAX];
+static double nu[NC_MAX];
+static int nc;
+
+static int parent_humanoid[NB_HUMANOID];
+static double h[BENCH_N_MAX * BENCH_N_MAX];
+static double h_fct[NB_HUMANOID * NB_HUMANOID];
+static double dtau_dq[NB_HUMANOID * NB_HUMANOID];
+static double dtau_dqd[NB_HUMANOID * NB_HUMANOID];
+static double x_fk[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+
+// cf. dyn2b_workspace_size_achd() which includes dyn2b_workspace_size_aba()
+static double ws[(77 + 7 * NC_MAX) * BENCH_N_MAX + 37 * NC_MAX];
+
+#ifdef DYN2B_BENCH_FLOAT
+// Single-precision copies of the chain and the state (cf. aba_accuracy.c)
+static float axisf[DYN2B_AXIS3_SIZE * BENCH_N_MAX];
+static float x_treef[DYN2B_POSE3_SIZE * BENCH_N_MAX];
+static float rbif[DYN2B_RBI3_SIZE * BENCH_N_MAX];
+static float xdd_basef[DYN2B_TWIST3_SIZE];
+static float qf[BENCH_N_MAX];
+static float qdf[BENCH_N_MAX];
+static float qddf[BENCH_N_MAX];
+static float tauf[BENCH_N_MAX];
+static float df[BENCH_N_MAX];
+static float wsf[77 * BENCH_N_MAX];
+static double ws_abi[27 * BENCH_N_MAX];
+#endif
+
+
+
+// One libm sine and cosine per joint, i.e. what dyn2b_jnt_to_pose3 replaces
+static void run_jnt_to_pose3_per_joint(int n, long reps)
+{
+    static void (*const to_pose3[])(const double *, double *) = {
+        [DYN2B_JNT_REV_X] = dyn2b_rev_x_to_pose3,
+        [DYN2B_JNT_REV_Y] = dyn2b_rev_y_to_pose3,
+        [DYN2B_JNT_REV_Z] = dyn2b_rev_z_to_pose3
+    };
+
+    for (long i = 0; i < reps; i++) {
+        for (int k = 0; k < n; k++) {
+            to_pose3[jnt[k]](&q[k], &x_fk[DYN2B_POSE3_SIZE * k]);
+        }
+    }
+}
+
+
+static void run_jnt_to_pose3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_jnt_to_pose3(n, jnt, axis, q, x_fk);
+    }
+}
+
+
+static void run_fk(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_fk(n, parent, jnt, axis, x_tree, q, x_fk);
+    }
+}
+
+
+static void run_rnea(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rnea(n, parent, jnt, axis, x_tree, rbi, xdd_base,
+                q, qd, qdd, NULL, tau, ws);
+    }
+}
+
+
+
+static void run_aba(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_aba(n, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+                q, qd, tau, NULL, qdd, ws);
+    }
+}
+
+
+#ifdef DYN2B_BENCH_FLOAT
+static void to_flt(int n, const double *in, float *out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = (float)in[i];
+    }
+}
+
+
+static void run_abaf(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_abaf(n, parent, jnt, axisf, x_treef, rbif, df, xdd_basef,
+                qf, qdf, tauf, NULL, qddf, wsf);
+    }
+}
+
+
+static void run_aba_mixed(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_aba_mixed(n, parent, jnt, axisf, x_treef, rbif, df, xdd_basef,
+                qf, qdf, tauf, NULL, qddf, wsf, ws_abi);
+    }
+}
+#endif
+
+
+static void run_aba_vel(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_aba_vel(n, parent, jnt, axis, x_tree, rbi, q, qd, NULL, ws);
+    }
+}
+
+
+static void run_aba_abi(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_aba_abi(n, parent, jnt, axis, rbi, d, tau, ws);
+    }
+}
+
+
+static void run_aba_acc(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_aba_acc(n, parent, jnt, axis, xdd_base, qdd, ws);
+    }
+}
+
+
+
+static void run_achd(int n, long reps)
+{
+    // Constrain the tip and, beyond six constraints, the middle of the chain
+    for (int k = 0; k < nc; k++) {
+        con_body[k] = (k < 6) ? n - 1 : (n / 2) - 1;
+    }
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_achd(n, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+                q, qd, tau, NULL, nc, con_body, alpha, beta, qdd, nu, ws);
+    }
+}
+
+
+
+// Nominal flop count of dyn2b_ltdl_fct_mat: one multiply-add for each pair of
+// ancestors j of i of k and one division per row
+static double flop_ltdl_fct(int n, const int *par)
+{
+    double flop = n;
+    for (int k = 0; k < n; k++) {
+        for (int i = par[k]; i >= 0; i = par[i]) {
+            for (int j = i; j >= 0; j = par[j]) {
+                flop += 2.0;
+            }
+            flop += 1.0;
+        }
+    }
+    return flop;
+}
+
+
+// Nominal flop count of dyn2b_ltdl_slv_mat with one right-hand side: two
+// multiply-adds for each ancestor and one multiplication per row
+static double flop_ltdl_slv(int n, const int *par)
+{
+    double flop = n;
+    for (int k = 0; k < n; k++) {
+        for (int i = par[k]; i >= 0; i = par[i]) {
+            flop += 4.0;
+        }
+    }
+    return flop;
+}
+
+
+static void run_crba(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_crba(n, parent, jnt, axis, x_tree, rbi, d, q, h, ws);
+    }
+}
+
+
+// Nominal flop count of dyn2b_rnea_drv
+static double flop_rnea_drv(int n, const int *par)
+{
+    double flop = FLOP_RNEA_DRV_BODY * n;
+    for (int k = 0; k < n; k++) {
+        for (int i = k; i >= 0; i = par[i]) {
+            flop += FLOP_RNEA_DRV_PAIR;
+        }
+    }
+    return flop;
+}
+
+
+static void run_rnea_drv(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_rnea_drv(n, parent_humanoid, jnt, axis, x_tree, rbi, xdd_base,
+                q, qd, qdd, NULL, tau, dtau_dq, dtau_dqd, h, ws);
+    }
+}
+
+
+static void run_ltdl_fct_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_ltdl_fct_mat(n, parent_humanoid, h, n, h_fct);
+    }
+}
+
+
+static void run_ltdl_slv_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_ltdl_slv_mat(n, 1, parent_humanoid, h_fct, tau, n, qdd, n);
+    }
+}
+
+
+static void run_ldl_fct_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_ldl_fct_mat(n, h, n, h_fct);
+    }
+}
+
+
+static void run_ldl_slv_mat(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_ldl_slv_mat(n, 1, h_fct, tau, n, qdd, n);
+    }
+}
+
+
+void solvers_bench(void)
+{
+    bench_fill(BENCH_N_MAX, q);
+    bench_fill(BENCH_N_MAX, qd);
+    bench_fill(BENCH_N_MAX, qdd);
+    bench_fill(BENCH_N_MAX, tau);
+    bench_fill(BENCH_N_MAX, d);
+    bench_fill(NC_MAX, beta);
+
+    // Unit forces and moments along the coordinate axes
+    memset(alpha, 0, sizeof(alpha));
+    for (int k = 0; k < NC_MAX; k++) {
+        alpha[(DYN2B_WRENCH3_SIZE * k) + (k % 6)] = 1.0;
+    }
+
+    // Serial chain that cycles through the revolute joints about the
+    // principal axes, with a unit offset between consecutive joints
+    memset(x_tree, 0, sizeof(x_tree));
+    for (int i = 0; i < BENCH_N_MAX; i++) {
+        const double inertia[DYN2B_RBI3_SIZE] = {
+            0.2, 0.0, 0.0,  0.0, 0.3, 0.0,  0.0, 0.0, 0.4,
+            0.1, 0.2, 0.3,
+            1.0
+        };
+
+        parent[i] = i - 1;
+        jnt[i] = DYN2B_JNT_REV_X + (i % 3);
+        double *x = &x_tree[DYN2B_POSE3_SIZE * i];
+        x[0] = 1.0; x[4] = 1.0; x[8] = 1.0;
+        x[DYN2B_POSE3_LIN_OFFSET + 2] = 1.0;
+        memcpy(&rbi[DYN2B_RBI3_SIZE * i], inertia, sizeof(inertia));
+    }
+
+    // The joint poses alone (sines and cosines of the whole configuration in
+    // one pass vs. one call each) and composed with the tree
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_jnt_to_pose3_per_joint", n, 0.0,
+                run_jnt_to_pose3_per_joint);
+        bench_run("dyn2b_jnt_to_pose3", n, 0.0, run_jnt_to_pose3);
+        bench_run("dyn2b_fk", n, FLOP_CMP_POSE3 * n, run_fk);
+    }
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_rnea", n, FLOP_RNEA_BODY * n, run_rnea);
+        bench_run("dyn2b_aba", n, FLOP_ABA_BODY * n, run_aba);
+    }
+
+#ifdef DYN2B_BENCH_FLOAT
+    // Single- and mixed-precision ABA (cf. dyn2b_aba_accuracy for their
+    // accuracy)
+    to_flt(DYN2B_AXIS3_SIZE * BENCH_N_MAX, axis, axisf);
+    to_flt(DYN2B_POSE3_SIZE * BENCH_N_MAX, x_tree, x_treef);
+    to_flt(DYN2B_RBI3_SIZE * BENCH_N_MAX, rbi, rbif);
+    to_flt(DYN2B_TWIST3_SIZE, xdd_base, xdd_basef);
+    to_flt(BENCH_N_MAX, q, qf);
+    to_flt(BENCH_N_MAX, qd, qdf);
+    to_flt(BENCH_N_MAX, tau, tauf);
+    to_flt(BENCH_N_MAX, d, df);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_abaf", n, FLOP_ABA_BODY * n, run_abaf);
+        bench_run("dyn2b_aba_mixed", n, FLOP_ABA_BODY * n, run_aba_mixed);
+    }
+#endif
+
+    // The sweeps of the ABA individually; each sweep starts from the
+    // workspace as left by the previous one
+    BENCH_SWEEP(n) {
+        run_aba(n, 1);
+        bench_run("dyn2b_aba_vel", n, FLOP_ABA_VEL_BODY * n, run_aba_vel);
+        bench_run("dyn2b_aba_abi", n, FLOP_ABA_ABI_BODY * n, run_aba_abi);
+        bench_run("dyn2b_aba_acc", n, FLOP_ABA_ACC_BODY * n, run_aba_acc);
+    }
+
+    // The constraints are only independent if there are at least as many
+    // joints as constraints
+    for (nc = 6; nc <= NC_MAX; nc += 6) {
+        BENCH_SWEEP(n) {
+            if (n < nc) {
+                continue;
+            }
+            bench_run(nc == 6 ? "dyn2b_achd_6" : "dyn2b_achd_12", n,
+                    FLOP_ACHD_BODY(nc) * n, run_achd);
+        }
+    }
+
+    // The flop count of the CRBA's projections depends on the depth
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_crba", n,
+                FLOP_CRBA_BODY * n + 2.0 * 54.0 * (n * (n - 1) / 2.0),
+                run_crba);
+    }
+
+    // Sparse vs. dense factorization of the humanoid's joint-space inertia
+    // matrix; the sparse one only visits the entries of each limb and the
+    // floating base
+    for (int i = 0; i < NB_HUMANOID; i++) {
+        parent_humanoid[i] = (i < 6 || i % 6 != 0) ? i - 1 : 5;
+    }
+
+    dyn2b_crba(NB_HUMANOID, parent_humanoid, jnt, axis, x_tree, rbi, d, q,
+            h, ws);
+
+    dyn2b_ltdl_fct_mat(NB_HUMANOID, parent_humanoid, h, NB_HUMANOID, h_fct);
+    bench_run("dyn2b_ltdl_fct_mat", NB_HUMANOID,
+            flop_ltdl_fct(NB_HUMANOID, parent_humanoid), run_ltdl_fct_mat);
+    bench_run("dyn2b_ltdl_slv_mat", NB_HUMANOID,
+            flop_ltdl_slv(NB_HUMANOID, parent_humanoid), run_ltdl_slv_mat);
+    dyn2b_ldl_fct_mat(NB_HUMANOID, h, NB_HUMANOID, h_fct);
+    bench_run("dyn2b_ldl_fct_mat", NB_HUMANOID,
+            NB_HUMANOID * NB_HUMANOID * NB_HUMANOID / 3.0 + NB_HUMANOID,
+            run_ldl_fct_mat);
+    bench_run("dyn2b_ldl_slv_mat", NB_HUMANOID,
+            2.0 * NB_HUMANOID * NB_HUMANOID + NB_HUMANOID, run_ldl_slv_mat);
+
+    // All derivatives of the humanoid's inverse dynamics (cf. dyn2b_rnea for
+    // finite differences which require 2 n sweeps each for the position and
+    // velocity derivatives)
+    bench_run("dyn2b_rnea_drv", NB_HUMANOID,
+            flop_rnea_drv(NB_HUMANOID, parent_humanoid), run_rnea_drv);
+}
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/vector3.h>
+
+#include "bench.h"
+
+
+static double in1[3 * BENCH_N_MAX];
+static double in2[3 * BENCH_N_MAX];
+static double in3[3 * BENCH_N_MAX];
+static double out[3 * BENCH_N_MAX];
+static double skw[9];
+
+
+static void run_crs_vec3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_crs_vec3(n, in1, 3, in2, 3, out, 3);
+    }
+}
+
+
+static void run_cad_vec3(int n, long reps)
+{
+    for (long i = 0; i < reps; i++) {
+        dyn2b_cad_vec3(n, in1, 3, in2, 3, in3, 3, out, 3);
+    }
+}
+
+
+static void run_skw_vec3(int n, long reps)
+{
+    (void)n;
+
+    for (long i = 0; i < reps; i++) {
+        dyn2b_skw_vec3(in1, skw);
+    }
+}
+
+
+void vector3_bench(void)
+{
+    bench_fill(3 * BENCH_N_MAX, in1);
+    bench_fill(3 * BENCH_N_MAX, in2);
+    bench_fill(3 * BENCH_N_MAX, in3);
+
+    bench_run("dyn2b_skw_vec3", 1, 3.0, run_skw_vec3);
+
+    BENCH_SWEEP(n) {
+        bench_run("dyn2b_crs_vec3", n, 9.0 * n, run_crs_vec3);
+        bench_run("dyn2b_cad_vec3", n, 12.0 * n, run_cad_vec3);
+    }
+}
@@ -2,6 +2,8 @@
 #ifndef DYN2B_FUNCTIONS_DYN2B_H
 #define DYN2B_FUNCTIONS_DYN2B_H
 
+#include <dyn2b/inline/api.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -22,7 +24,7 @@ extern "C" {
  * @param[in] in The source array with \f$n\f$ entries.
  * @param[out] out The destination array with \f$n\f$ entries.
  */
-void dyn2b_cpy_arr(
+DYN2B_INLINE_API void dyn2b_cpy_arr(
         int n,
         const double *restrict in,
         double *restrict out);
@@ -40,7 +42,7 @@ void dyn2b_cpy_arr(
  * @param[in] in2 The second source array with \f$n\f$ entries.
  * @param[out] out The destination array with \f$offset + n\f$ entries.
  */
-void dyn2b_add_arr(
+DYN2B_INLINE_API void dyn2b_add_arr(
         int n,
         int offset,
         const double *restrict in1,
@@ -60,7 +62,7 @@ void dyn2b_add_arr(
  * @param[in] in The first source array with \f$n\f$ entries.
  * @param[out] out The destination array with \f$offset + n\f$ entries.
  */
-void dyn2b_add_arr_i(
+DYN2B_INLINE_API void dyn2b_add_arr_i(
         int n,
         int offset,
         const double *restrict in,  // [n]
@@ -77,7 +79,7 @@ void dyn2b_add_arr_i(
  * @param[in] in2 The second source array ("subtrahend") with \f$n\f$ entries.
  * @param[out] out The destination array ("difference") with \f$n\f$ entries.
  */
-void dyn2b_sub_arr(
+DYN2B_INLINE_API void dyn2b_sub_arr(
         int n,
         const double *restrict in1,
         const double *restrict in2,
@@ -94,7 +96,7 @@ void dyn2b_sub_arr(
  * @param[in] in The source array with \f$n\f$ entries.
  * @param[out] out The destination array with \f$n\f$ entries.
  */
-void dyn2b_scl_arr(
+DYN2B_INLINE_API void dyn2b_scl_arr(
         int n,
         const double *restrict a,
         const double *restrict in,
@@ -110,7 +112,7 @@ void dyn2b_scl_arr(
  * @param[in] in The source array with \f$n\f$ entries.
  * @param[out] out The destination array with \f$n\f$ entries.
  */
-void dyn2b_inv_arr(
+DYN2B_INLINE_API void dyn2b_inv_arr(
         int n,
         const double *restrict in,
         double *restrict out);
@@ -120,4 +122,9 @@ void dyn2b_inv_arr(
 }
 #endif
 
+// Definitions of the header-only mode
+#ifdef DYN2B_INLINE
+#  include <dyn2b/inline/array.h>
+#endif
+
 #endif
@@ -2,6 +2,8 @@
 #ifndef DYN2B_FUNCTIONS_JOINT_H
 #define DYN2B_FUNCTIONS_JOINT_H
 
+#include <dyn2b/inline/api.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -32,7 +34,7 @@ extern "C" {
  *                  respect to the joint's proximal frame \f$\{P\}\f$.
  *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
  */
-void dyn2b_rev_x_to_pose3(
+DYN2B_INLINE_API void dyn2b_rev_x_to_pose3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -48,7 +50,7 @@ void dyn2b_rev_x_to_pose3(
  *                  respect to the joint's proximal frame \f$\{P\}\f$.
  *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
  */
-void dyn2b_rev_y_to_pose3(
+DYN2B_INLINE_API void dyn2b_rev_y_to_pose3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -64,7 +66,7 @@ void dyn2b_rev_y_to_pose3(
  *                  respect to the joint's proximal frame \f$\{P\}\f$.
  *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
  */
-void dyn2b_rev_z_to_pose3(
+DYN2B_INLINE_API void dyn2b_rev_z_to_pose3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -80,7 +82,7 @@ void dyn2b_rev_z_to_pose3(
  *                  respect to the joint's proximal frame \f$\{P\}\f$.
  *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
  */
-void dyn2b_trans_x_to_pose3(
+DYN2B_INLINE_API void dyn2b_trans_x_to_pose3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -96,7 +98,7 @@ void dyn2b_trans_x_to_pose3(
  *                  respect to the joint's proximal frame \f$\{P\}\f$.
  *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
  */
-void dyn2b_trans_y_to_pose3(
+DYN2B_INLINE_API void dyn2b_trans_y_to_pose3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -112,11 +114,179 @@ void dyn2b_trans_y_to_pose3(
  *                  respect to the joint's proximal frame \f$\{P\}\f$.
  *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
  */
-void dyn2b_trans_z_to_pose3(
+DYN2B_INLINE_API void dyn2b_trans_z_to_pose3(
         const double *restrict jnt,
         double *restrict cart);
 
 
+/**
+ * Compose a pose with the forward position kinematics of a revolute-x joint.
+ *
+ * \f[
+ * {}^W\boldsymbol{X}_D = {}^W\boldsymbol{X}_P {}^P\boldsymbol{X}_D(q)
+ * \f]
+ *
+ * Equivalent to dyn2b_rev_x_to_pose3() followed by dyn2b_cmp_pose3() but
+ * only the two columns of the orientation that the joint rotates are computed
+ * and the caller provides the cosine and sine.
+ *
+ * `x_comp = x_prox fpk(q)`
+ *
+ * @param[in] x_prox The pose \f${}^W\boldsymbol{X}_P\f$ of the joint's
+ *                   proximal frame \f$\{P\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 1]\f$
+ * @param[in] cq The cosine \f$\cos(q)\f$ of the joint position.
+ * @param[in] sq The sine \f$\sin(q)\f$ of the joint position.
+ * @param[out] x_comp The pose \f${}^W\boldsymbol{X}_D\f$ of the joint's
+ *                    distal frame \f$\{D\}\f$.
+ *                    Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+DYN2B_INLINE_API void dyn2b_rev_x_cmp_pose3(
+        const double *restrict x_prox,
+        double cq,
+        double sq,
+        double *restrict x_comp);
+
+
+/**
+ * Compose a pose with the forward position kinematics of a revolute-y joint.
+ *
+ * \f[
+ * {}^W\boldsymbol{X}_D = {}^W\boldsymbol{X}_P {}^P\boldsymbol{X}_D(q)
+ * \f]
+ *
+ * Equivalent to dyn2b_rev_y_to_pose3() followed by dyn2b_cmp_pose3() but
+ * only the two columns of the orientation that the joint rotates are computed
+ * and the caller provides the cosine and sine.
+ *
+ * `x_comp = x_prox fpk(q)`
+ *
+ * @param[in] x_prox The pose \f${}^W\boldsymbol{X}_P\f$ of the joint's
+ *                   proximal frame \f$\{P\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 1]\f$
+ * @param[in] cq The cosine \f$\cos(q)\f$ of the joint position.
+ * @param[in] sq The sine \f$\sin(q)\f$ of the joint position.
+ * @param[out] x_comp The pose \f${}^W\boldsymbol{X}_D\f$ of the joint's
+ *                    distal frame \f$\{D\}\f$.
+ *                    Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+DYN2B_INLINE_API void dyn2b_rev_y_cmp_pose3(
+        const double *restrict x_prox,
+        double cq,
+        double sq,
+        double *restrict x_comp);
+
+
+/**
+ * Compose a pose with the forward position kinematics of a revolute-z joint.
+ *
+ * \f[
+ * {}^W\boldsymbol{X}_D = {}^W\boldsymbol{X}_P {}^P\boldsymbol{X}_D(q)
+ * \f]
+ *
+ * Equivalent to dyn2b_rev_z_to_pose3() followed by dyn2b_cmp_pose3() but
+ * only the two columns of the orientation that the joint rotates are computed
+ * and the caller provides the cosine and sine.
+ *
+ * `x_comp = x_prox fpk(q)`
+ *
+ * @param[in] x_prox The pose \f${}^W\boldsymbol{X}_P\f$ of the joint's
+ *                   proximal frame \f$\{P\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 1]\f$
+ * @param[in] cq The cosine \f$\cos(q)\f$ of the joint position.
+ * @param[in] sq The sine \f$\sin(q)\f$ of the joint position.
+ * @param[out] x_comp The pose \f${}^W\boldsymbol{X}_D\f$ of the joint's
+ *                    distal frame \f$\{D\}\f$.
+ *                    Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+DYN2B_INLINE_API void dyn2b_rev_z_cmp_pose3(
+        const double *restrict x_prox,
+        double cq,
+        double sq,
+        double *restrict x_comp);
+
+
+/**
+ * Compose a pose with the forward position kinematics of a prismatic-x joint.
+ *
+ * \f[
+ * {}^W\boldsymbol{X}_D = {}^W\boldsymbol{X}_P {}^P\boldsymbol{X}_D(q)
+ * \f]
+ *
+ * Equivalent to dyn2b_trans_x_to_pose3() followed by dyn2b_cmp_pose3() but
+ * the orientation is copied and the position only moves along the joint axis.
+ *
+ * `x_comp = x_prox fpk(jnt)`
+ *
+ * @param[in] x_prox The pose \f${}^W\boldsymbol{X}_P\f$ of the joint's
+ *                   proximal frame \f$\{P\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 1]\f$
+ * @param[in] jnt The joint position.
+ *                Size: \f$[1 \times 1]\f$
+ * @param[out] x_comp The pose \f${}^W\boldsymbol{X}_D\f$ of the joint's
+ *                    distal frame \f$\{D\}\f$.
+ *                    Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+DYN2B_INLINE_API void dyn2b_trans_x_cmp_pose3(
+        const double *restrict x_prox,
+        const double *restrict jnt,
+        double *restrict x_comp);
+
+
+/**
+ * Compose a pose with the forward position kinematics of a prismatic-y joint.
+ *
+ * \f[
+ * {}^W\boldsymbol{X}_D = {}^W\boldsymbol{X}_P {}^P\boldsymbol{X}_D(q)
+ * \f]
+ *
+ * Equivalent to dyn2b_trans_y_to_pose3() followed by dyn2b_cmp_pose3() but
+ * the orientation is copied and the position only moves along the joint axis.
+ *
+ * `x_comp = x_prox fpk(jnt)`
+ *
+ * @param[in] x_prox The pose \f${}^W\boldsymbol{X}_P\f$ of the joint's
+ *                   proximal frame \f$\{P\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 1]\f$
+ * @param[in] jnt The joint position.
+ *                Size: \f$[1 \times 1]\f$
+ * @param[out] x_comp The pose \f${}^W\boldsymbol{X}_D\f$ of the joint's
+ *                    distal frame \f$\{D\}\f$.
+ *                    Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+DYN2B_INLINE_API void dyn2b_trans_y_cmp_pose3(
+        const double *restrict x_prox,
+        const double *restrict jnt,
+        double *restrict x_comp);
+
+
+/**
+ * Compose a pose with the forward position kinematics of a prismatic-z joint.
+ *
+ * \f[
+ * {}^W\boldsymbol{X}_D = {}^W\boldsymbol{X}_P {}^P\boldsymbol{X}_D(q)
+ * \f]
+ *
+ * Equivalent to dyn2b_trans_z_to_pose3() followed by dyn2b_cmp_pose3() but
+ * the orientation is copied and the position only moves along the joint axis.
+ *
+ * `x_comp = x_prox fpk(jnt)`
+ *
+ * @param[in] x_prox The pose \f${}^W\boldsymbol{X}_P\f$ of the joint's
+ *                   proximal frame \f$\{P\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 1]\f$
+ * @param[in] jnt The joint position.
+ *                Size: \f$[1 \times 1]\f$
+ * @param[out] x_comp The pose \f${}^W\boldsymbol{X}_D\f$ of the joint's
+ *                    distal frame \f$\{D\}\f$.
+ *                    Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+DYN2B_INLINE_API void dyn2b_trans_z_cmp_pose3(
+        const double *restrict x_prox,
+        const double *restrict jnt,
+        double *restrict x_comp);
+
+
 /**
  * Compute the velocity or acceleration twist for a revolute-x joint.
  *
@@ -131,7 +301,7 @@ void dyn2b_trans_z_to_pose3(
  *                  point.
  *                  Size: \f$[6 \times 1]\f$
  */
-void dyn2b_rev_x_to_twist3(
+DYN2B_INLINE_API void dyn2b_rev_x_to_twist3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -150,7 +320,7 @@ void dyn2b_rev_x_to_twist3(
  *                  point.
  *                  Size: \f$[6 \times 1]\f$
  */
-void dyn2b_rev_y_to_twist3(
+DYN2B_INLINE_API void dyn2b_rev_y_to_twist3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -169,7 +339,7 @@ void dyn2b_rev_y_to_twist3(
  *                  point.
  *                  Size: \f$[6 \times 1]\f$
  */
-void dyn2b_rev_z_to_twist3(
+DYN2B_INLINE_API void dyn2b_rev_z_to_twist3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -188,7 +358,7 @@ void dyn2b_rev_z_to_twist3(
  *                  point.
  *                  Size: \f$[6 \times 1]\f$
  */
-void dyn2b_trans_x_to_twist3(
+DYN2B_INLINE_API void dyn2b_trans_x_to_twist3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -207,7 +377,7 @@ void dyn2b_trans_x_to_twist3(
  *                  point.
  *                  Size: \f$[6 \times 1]\f$
  */
-void dyn2b_trans_y_to_twist3(
+DYN2B_INLINE_API void dyn2b_trans_y_to_twist3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -226,7 +396,7 @@ void dyn2b_trans_y_to_twist3(
  *                  point.
  *                  Size: \f$[6 \times 1]\f$
  */
-void dyn2b_trans_z_to_twist3(
+DYN2B_INLINE_API void dyn2b_trans_z_to_twist3(
         const double *restrict jnt,
         double *restrict cart);
 
@@ -245,7 +415,7 @@ void dyn2b_trans_z_to_twist3(
  * @param[out] jnt The joint force.
  *                 Size: \f$[1 \times n]\f$
  */
-void dyn2b_rev_x_from_wrench3(
+DYN2B_INLINE_API void dyn2b_rev_x_from_wrench3(
         int n,
         const double *restrict cart,
         double *restrict jnt);
@@ -265,7 +435,7 @@ void dyn2b_rev_x_from_wrench3(
  * @param[out] jnt The joint force.
  *                 Size: \f$[1 \times n]\f$
  */
-void dyn2b_rev_y_from_wrench3(
+DYN2B_INLINE_API void dyn2b_rev_y_from_wrench3(
         int n,
         const double *restrict cart,
         double *restrict jnt);
@@ -285,7 +455,7 @@ void dyn2b_rev_y_from_wrench3(
  * @param[out] jnt The joint force.
  *                 Size: \f$[1 \times n]\f$
  */
-void dyn2b_rev_z_from_wrench3(
+DYN2B_INLINE_API void dyn2b_rev_z_from_wrench3(
         int n,
         const double *restrict cart,
         double *restrict jnt);
@@ -305,7 +475,7 @@ void dyn2b_rev_z_from_wrench3(
  * @param[out] jnt The joint force.
  *                 Size: \f$[1 \times n]\f$
  */
-void dyn2b_trans_x_from_wrench3(
+DYN2B_INLINE_API void dyn2b_trans_x_from_wrench3(
         int n,
         const double *restrict cart,
         double *restrict jnt);
@@ -325,7 +495,7 @@ void dyn2b_trans_x_from_wrench3(
  * @param[out] jnt The joint force.
  *                 Size: \f$[1 \times n]\f$
  */
-void dyn2b_trans_y_from_wrench3(
+DYN2B_INLINE_API void dyn2b_trans_y_from_wrench3(
         int n,
         const double *restrict cart,
         double *restrict jnt);
@@ -345,7 +515,7 @@ void dyn2b_trans_y_from_wrench3(
  * @param[out] jnt The joint force.
  *                 Size: \f$[1 \times n]\f$
  */
-void dyn2b_trans_z_from_wrench3(
+DYN2B_INLINE_API void dyn2b_trans_z_from_wrench3(
         int n,
         const double *restrict cart,
         double *restrict jnt);
@@ -417,6 +587,63 @@ void dyn2b_tf_prox_abi3(
         double *restrict abi_prox);
 
 
+/**
+ * Transform articulated-body inertia from a distal frame \f$D\f$ to a proximal
+ * frame \f$P\f$ given by a quaternion pose (quaternion version of
+ * dyn2b_tf_prox_abi3()).
+ *
+ * @param[in] x Quaternion pose \f${}^D\boldsymbol{X}_P\f$ of distal frame
+ *              \f$\{D\}\f$ with respect to proximal frame \f$\{P\}\f$.
+ *              Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ * @param[in] abi_dist Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ as
+ *                     seen by distal frame \f$\{D\}\f$.
+ *                     Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] abi_prox Articulated-body inertia \f${}^P\boldsymbol{I}^A\f$ as
+ *                      seen by proximal frame \f$\{P\}\f$.
+ *                      Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ */
+void dyn2b_tf_prox_abi3q(
+        const double *restrict x,
+        const double *restrict abi_dist,
+        double *restrict abi_prox);
+
+
+/**
+ * Transform many articulated-body inertias, each with its own pose, from a
+ * distal frame \f$D\f$ to a proximal frame \f$P\f$ (batched version of
+ * dyn2b_tf_prox_abi3()).
+ *
+ * \f[
+ * {}^P\boldsymbol{I}^A_i
+ * = {}^P\boldsymbol{X}_{D,i}~{}^D\boldsymbol{I}^A_i~{}^P\boldsymbol{X}_{D,i}^{-1}
+ * \f]
+ *
+ * The \f$k\f$-th entry of the \f$i\f$-th instance is located at index
+ * \f$k \cdot ld + i\f$ of the respective buffer (structure of arrays).
+ *
+ * @param[in] n Number of instances.
+ * @param[in] ld The leading dimension of all buffers, i.e. the number of
+ *               elements between two consecutive entries of one instance
+ *               (\f$ld \ge n\f$).
+ * @param[in] x Screw transformations \f${}^D\boldsymbol{X}_{P,i}\f$.
+ *              Size: \f$[(3 \times 3 + 3 \times 1) \times ld]\f$.
+ * @param[in] abi_dist Articulated-body inertias \f${}^D\boldsymbol{I}^A_i\f$
+ *                     as seen by the distal frames.
+ *                     Size: \f$[(3 \times 3 + 3 \times 3 + 3 \times 3) \times
+ *                     ld]\f$.
+ * @param[out] abi_prox Articulated-body inertias \f${}^P\boldsymbol{I}^A_i\f$
+ *                      as seen by the proximal frames.
+ *                      Size: \f$[(3 \times 3 + 3 \times 3 + 3 \times 3) \times
+ *                      ld]\f$.
+ */
+void dyn2b_tf_prox_abi3_batch(
+        int n,
+        int ld,
+        const double *restrict x,
+        const double *restrict abi_dist,
+        double *restrict abi_prox);
+
+
 /**
  * Map a collection of screw acceleration twists into a collection of wrenches
  * using an articulated-body inertia.
@@ -1063,142 +1290,862 @@ void dyn2b_to_tup_abi3(
 
 
 /**
- * Explictly compute the inverse of a generic joint's (specified by the joint's
- * Jacobian matrix) inertia. This combines (i) the inertia felt from Cartesian
- * space due to the links; and (ii) the inertia felt from an actuator.
+ * Pack an articulated-body inertia, i.e. only keep the upper triangles of the
+ * symmetric blocks \f$\bar{\boldsymbol{I}}\f$ and \f$\boldsymbol{M}\f$
+ * (cf. DYN2B_ABI3P_* and DYN2B_SYM3_IDX).
+ *
+ * @param[in] in Articulated-body inertia.
+ *               Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] out Packed articulated-body inertia.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ */
+void dyn2b_pck_abi3(
+        const double *restrict in,
+        double *restrict out);
+
+
+/**
+ * Unpack an articulated-body inertia (inverse of dyn2b_pck_abi3()).
  *
- * \f[
- * D^{-1}
- * = (d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S})^{-1}
- * \f]
+ * @param[in] in Packed articulated-body inertia.
+ *               Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] out Articulated-body inertia.
+ *                 Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ */
+void dyn2b_unp_abi3(
+        const double *restrict in,
+        double *restrict out);
+
+
+/**
+ * Initialize a packed articulated-body inertia from a packed rigid-body
+ * inertia (packed version of dyn2b_to_abi3()).
  *
- * where \f$\boldsymbol{S}\f$ is the joint's Jacobian matrix (or motion
- * sub-space matrix) and \f$d\f$ is the inertia that the joint feels from the
- * actuator, possibly through a gearbox.
+ * @param[in] rbi Packed rigid-body inertia
+ *                \f$(\bar{\boldsymbol{I}}, \boldsymbol{h}, m)\f$.
+ *                Size: \f$[6 + 3 \times 1 + 1]\f$.
+ * @param[out] abi Packed articulated-body inertia
+ *                 \f$(\bar{\boldsymbol{I}}, \boldsymbol{H}, \boldsymbol{M})\f$.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ */
+void dyn2b_to_abi3p(
+        const double *restrict rbi,
+        double *restrict abi);
+
+
+/**
+ * Transform a packed articulated-body inertia from a distal frame \f$D\f$ to
+ * a proximal frame \f$P\f$ (packed version of dyn2b_tf_prox_abi3()). Only the
+ * upper triangles of the symmetric blocks are computed.
+ *
+ * @param[in] x Pose of the distal frame \f$\{D\}\f$ with respect to the
+ *              proximal frame \f$\{P\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 1]\f$.
+ * @param[in] abi_dist Packed articulated-body inertia in the distal frame.
+ *                     Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] abi_prox Packed articulated-body inertia in the proximal frame.
+ *                      Size: \f$[6 + 3 \times 3 + 6]\f$.
+ */
+void dyn2b_tf_prox_abi3p(
+        const double *restrict x,
+        const double *restrict abi_dist,
+        double *restrict abi_prox);
+
+
+/**
+ * Compute the wrenches that result from a packed articulated-body inertia and
+ * a collection of acceleration twists (packed version of
+ * dyn2b_abi_to_wrench3()).
+ *
+ * @param[in] n Number of acceleration twists.
+ * @param[in] abi Packed articulated-body inertia.
+ *                Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[in] xdd Acceleration twists.
+ *                Size: \f$[6 \times n]\f$.
+ * @param[out] w Wrenches.
+ *               Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_abi_to_wrench3p(
+        int n,
+        const double *restrict abi,
+        const double *restrict xdd,
+        double *restrict w);
+
+
+/**
+ * Project a packed articulated-body inertia over a revolute-x joint
+ * (packed version of dyn2b_rev_x_proj_abi3()).
  *
- * @param[in] dof Number of joint's motion degrees of freedom.
- * @param[in] jac The joint Jacobian (or motion subspace matrix)
- *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
- *                \f$\{D\}\f$.
- *                Size: \f$[6 \times \text{dof}]\f$.
- * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
- *              joint's distal sub-tree as seen by the joint's distal frame
- *              \f$\{D\}\f$. This inertia is represented as a dense matrix.
- *              Size: \f$[6 \times 6]\f$.
  * @param[in] d The joint inertia \f$d\f$.
- *              Size: \f$[\text{dof} \times \text{dof}]\f$.
- * @param[out] dstms The inverse inertia \f$D^{-1}\f$.
- *                   Size: \f$[\text{dof} \times \text{dof}]\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Packed articulated-body inertia.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] m_out Packed apparent inertia.
+ *                   Size: \f$[6 + 3 \times 3 + 6]\f$.
  */
-void dyn2b_jnt_inv_abi3(
-        int dof,
-        const double *restrict jac,
-        const double *restrict m,
+void dyn2b_rev_x_proj_abi3p(
         const double *restrict d,
-        double *restrict dstms);
+        const double *restrict m_in,
+        double *restrict m_out);
 
 
 /**
- * Compute an explicit projection matrix for a generic joint (specified by the
- * joint's Jacobian matrix). This results in the so-called apparent inertia:
- * after the projection (on the other side of the joint) the articulated-body
- * inertia seems to reduce because of the joint.
- *
- * \f[
- * \boldsymbol{P}^T
- * = \boldsymbol{1} - {}^D\boldsymbol{I}^A~
- *   {}^D\boldsymbol{S}~D^{-1}~{}^D\boldsymbol{S}^T
- * \f]
- *
- * with
- *
- * \f[
- * D = d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}
- * \f]
+ * Project a packed articulated-body inertia over a revolute-y joint
+ * (packed version of dyn2b_rev_y_proj_abi3()).
  *
- * where \f$\boldsymbol{S}\f$ is the joint's Jacobian matrix (or motion
- * sub-space matrix) and \f$d\f$ is the inertia that the joint feels from the
- * actuator, possibly through a gearbox.
- *
- * @param[in] dof Number of joint's motion degrees of freedom.
- * @param[in] jac The joint Jacobian (or motion subspace matrix)
- *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
- *                \f$\{D\}\f$.
- *                Size: \f$[6 \times \text{dof}]\f$.
  * @param[in] d The joint inertia \f$d\f$.
- *              Size: \f$[\text{dof} \times \text{dof}]\f$.
- * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
- *              joint's distal sub-tree as seen by the joint's distal frame
- *              \f$\{D\}\f$.
- *              Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
- * @param[out] proj The projection matrix \f$\boldsymbol{P}^T\f$.
- *                  Size: \f$[6 \times 6]\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Packed articulated-body inertia.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] m_out Packed apparent inertia.
+ *                   Size: \f$[6 + 3 \times 3 + 6]\f$.
  */
-void dyn2b_jnt_to_proj3(
-        int dof,
-        const double *restrict jac,
+void dyn2b_rev_y_proj_abi3p(
         const double *restrict d,
-        const double *restrict m,
-        double *restrict proj);
+        const double *restrict m_in,
+        double *restrict m_out);
 
 
 /**
- * Project an articulated-body inertia over a generic joint (specified by the
- * joint's Jacobian matrix). This results in the so-called apparent inertia:
- * after the projection (on the other side of the joint) the articulated-body
- * inertia seems to reduce because of the joint.
- *
- * \f[
- * {}^D\boldsymbol{I}^a = \boldsymbol{P}^T~{}^D\boldsymbol{I}^A
- * \f]
+ * Project a packed articulated-body inertia over a revolute-z joint
+ * (packed version of dyn2b_rev_z_proj_abi3()).
  *
- * with
- *
- * \f[
- * \boldsymbol{P}^T
- * = \boldsymbol{1} - {}^D\boldsymbol{I}^A~
- *   {}^D\boldsymbol{S}~D^{-1}~{}^D\boldsymbol{S}^T
- * \f]
- *
- * and
- *
- * \f[
- * D = d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}
- * \f]
- *
- * where \f$\boldsymbol{S}\f$ is the joint's Jacobian matrix (or motion
- * sub-space matrix) and \f$d\f$ is the inertia that the joint feels from the
- * actuator, possibly through a gearbox.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Packed articulated-body inertia.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] m_out Packed apparent inertia.
+ *                   Size: \f$[6 + 3 \times 3 + 6]\f$.
+ */
+void dyn2b_rev_z_proj_abi3p(
+        const double *restrict d,
+        const double *restrict m_in,
+        double *restrict m_out);
+
+
+/**
+ * Project a packed articulated-body inertia over a prismatic-x joint
+ * (packed version of dyn2b_trans_x_proj_abi3()).
  *
- * @param[in] dof Number of joint's motion degrees of freedom.
- * @param[in] jac The joint Jacobian (or motion subspace matrix)
- *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
- *                \f$\{D\}\f$.
- *                Size: \f$[6 \times \text{dof}]\f$.
  * @param[in] d The joint inertia \f$d\f$.
- *              Size: \f$[\text{dof} \times \text{dof}]\f$.
- * @param[in] m_in Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
- *                 joint's distal sub-tree as seen by the joint's distal frame
- *                 \f$\{D\}\f$.
- *                 Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
- * @param[out] m_out Apparent inertia \f${}^D\boldsymbol{I}^a\f$ of the joint's
- *                   distal sub-tree as seen by the joint's distal frame
- *                   \f$\{D\}\f$.
- *                   Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Packed articulated-body inertia.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] m_out Packed apparent inertia.
+ *                   Size: \f$[6 + 3 \times 3 + 6]\f$.
  */
-void dyn2b_jnt_proj_abi3(
-        int dof,
-        const double *restrict jac,
+void dyn2b_trans_x_proj_abi3p(
         const double *restrict d,
         const double *restrict m_in,
         double *restrict m_out);
 
 
 /**
- * Project a collection of articulated-body wrenches over a generic joint
- * (specified by the joint's Jacobian matrix). This results in the so-called
- * apparent wrench: the projection represents how much force is used to
- * accelerate the joint.
+ * Project a packed articulated-body inertia over a prismatic-y joint
+ * (packed version of dyn2b_trans_y_proj_abi3()).
+ *
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Packed articulated-body inertia.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] m_out Packed apparent inertia.
+ *                   Size: \f$[6 + 3 \times 3 + 6]\f$.
+ */
+void dyn2b_trans_y_proj_abi3p(
+        const double *restrict d,
+        const double *restrict m_in,
+        double *restrict m_out);
+
+
+/**
+ * Project a packed articulated-body inertia over a prismatic-z joint
+ * (packed version of dyn2b_trans_z_proj_abi3()).
+ *
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Packed articulated-body inertia.
+ *                 Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[out] m_out Packed apparent inertia.
+ *                   Size: \f$[6 + 3 \times 3 + 6]\f$.
+ */
+void dyn2b_trans_z_proj_abi3p(
+        const double *restrict d,
+        const double *restrict m_in,
+        double *restrict m_out);
+
+
+/**
+ * Project a collection of articulated-body wrenches over a revolute-x
+ * joint with a packed articulated-body inertia (packed version of
+ * dyn2b_rev_x_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Packed articulated-body inertia.
+ *              Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[in] f_in Articulated-body wrenches.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrenches.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_rev_x_proj_wrench3p(
+        int n,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Project a collection of articulated-body wrenches over a revolute-y
+ * joint with a packed articulated-body inertia (packed version of
+ * dyn2b_rev_y_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Packed articulated-body inertia.
+ *              Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[in] f_in Articulated-body wrenches.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrenches.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_rev_y_proj_wrench3p(
+        int n,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Project a collection of articulated-body wrenches over a revolute-z
+ * joint with a packed articulated-body inertia (packed version of
+ * dyn2b_rev_z_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Packed articulated-body inertia.
+ *              Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[in] f_in Articulated-body wrenches.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrenches.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_rev_z_proj_wrench3p(
+        int n,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Project a collection of articulated-body wrenches over a prismatic-x
+ * joint with a packed articulated-body inertia (packed version of
+ * dyn2b_trans_x_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Packed articulated-body inertia.
+ *              Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[in] f_in Articulated-body wrenches.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrenches.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_trans_x_proj_wrench3p(
+        int n,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Project a collection of articulated-body wrenches over a prismatic-y
+ * joint with a packed articulated-body inertia (packed version of
+ * dyn2b_trans_y_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Packed articulated-body inertia.
+ *              Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[in] f_in Articulated-body wrenches.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrenches.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_trans_y_proj_wrench3p(
+        int n,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Project a collection of articulated-body wrenches over a prismatic-z
+ * joint with a packed articulated-body inertia (packed version of
+ * dyn2b_trans_z_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Packed articulated-body inertia.
+ *              Size: \f$[6 + 3 \times 3 + 6]\f$.
+ * @param[in] f_in Articulated-body wrenches.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrenches.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_trans_z_proj_wrench3p(
+        int n,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Initialize the data of a joint axis (cf. DYN2B_AXIS3_*) that the joints with
+ * an arbitrary axis require, i.e. the normalized direction \f$\boldsymbol{a}\f$
+ * and its outer product \f$\boldsymbol{a}\boldsymbol{a}^T\f$. This only needs
+ * to happen once per joint, not in every evaluation.
+ *
+ * @param[in] dir The axis direction which is not required to be normalized.
+ *                Size: \f$[3 \times 1]\f$.
+ * @param[out] axis The joint axis.
+ *                  Size: \f$[3 \times 1 + 6]\f$.
+ */
+void dyn2b_to_axis3(
+        const double *restrict dir,
+        double *restrict axis);
+
+
+/**
+ * Compute the forward position kinematics of a revolute joint about an
+ * arbitrary axis (Rodrigues' formula).
+ *
+ * \f[
+ * \boldsymbol{R}
+ * = \cos(q)~\boldsymbol{1} + \sin(q)~[\boldsymbol{a}]_\times
+ *   + (1 - \cos(q))~\boldsymbol{a}\boldsymbol{a}^T
+ * \f]
+ *
+ * `cart = fpk(jnt)`
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The joint position measured in radians.
+ *                Size: \f$[1 \times 1]\f$
+ * @param[out] cart The pose of the joint's distal frame \f$\{D\}\f$ with
+ *                  respect to the joint's proximal frame \f$\{P\}\f$.
+ *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+void dyn2b_rev_to_pose3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute the forward position kinematics of a prismatic joint along an
+ * arbitrary axis.
+ *
+ * `cart = fpk(jnt)`
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The joint position.
+ *                Size: \f$[1 \times 1]\f$
+ * @param[out] cart The pose of the joint's distal frame \f$\{D\}\f$ with
+ *                  respect to the joint's proximal frame \f$\{P\}\f$.
+ *                  Size: \f$[3 \times 3 + 3 \times 1]\f$
+ */
+void dyn2b_trans_to_pose3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute the velocity or acceleration twist for a revolute joint about an
+ * arbitrary axis.
+ *
+ * `cart = fvk(jnt)` or `cart = fak(jnt)`
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The joint velocity or acceleration.
+ *                Size: \f$[1 \times 1]\f$
+ * @param[out] cart The velocity or acceleration twist of the joint's distal
+ *                  body \f$\mathcal{D}\f$ with respect to the joint's proximal
+ *                  body \f$\mathcal{P}\f$ as seen by the joint's distal frame
+ *                  \f$\{D\}\f$ and that frame's origin \f$d\f$ as the reference
+ *                  point.
+ *                  Size: \f$[6 \times 1]\f$
+ */
+void dyn2b_rev_to_twist3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute the velocity or acceleration twist for a prismatic joint along an
+ * arbitrary axis.
+ *
+ * `cart = fvk(jnt)` or `cart = fak(jnt)`
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The joint velocity or acceleration.
+ *                Size: \f$[1 \times 1]\f$
+ * @param[out] cart The velocity or acceleration twist of the joint's distal
+ *                  body \f$\mathcal{D}\f$ with respect to the joint's proximal
+ *                  body \f$\mathcal{P}\f$ as seen by the joint's distal frame
+ *                  \f$\{D\}\f$ and that frame's origin \f$d\f$ as the reference
+ *                  point.
+ *                  Size: \f$[6 \times 1]\f$
+ */
+void dyn2b_trans_to_twist3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute the forward position kinematics of a revolute joint about an
+ * arbitrary axis for a dual joint position (dual version of
+ * dyn2b_rev_to_pose3(), cf. the `_dual` functions in screw.h).
+ *
+ * \f[
+ * \delta\boldsymbol{R} = [\boldsymbol{a}]_\times \boldsymbol{R}~\delta q,
+ * \quad \delta\boldsymbol{r} = \boldsymbol{0}
+ * \f]
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The dual joint position measured in radians.
+ *                Size: DYN2B_DUAL_SIZE(1)
+ * @param[out] cart The dual pose of the joint's distal frame \f$\{D\}\f$ with
+ *                  respect to the joint's proximal frame \f$\{P\}\f$.
+ *                  Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)
+ */
+void dyn2b_rev_to_pose3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute the forward position kinematics of a prismatic joint along an
+ * arbitrary axis for a dual joint position (dual version of
+ * dyn2b_trans_to_pose3()).
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The dual joint position.
+ *                Size: DYN2B_DUAL_SIZE(1)
+ * @param[out] cart The dual pose of the joint's distal frame \f$\{D\}\f$ with
+ *                  respect to the joint's proximal frame \f$\{P\}\f$.
+ *                  Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)
+ */
+void dyn2b_trans_to_pose3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute the velocity or acceleration twist for a revolute joint about an
+ * arbitrary axis for a dual joint velocity or acceleration (dual version of
+ * dyn2b_rev_to_twist3()).
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The dual joint velocity or acceleration.
+ *                Size: DYN2B_DUAL_SIZE(1)
+ * @param[out] cart The dual velocity or acceleration twist of the joint's
+ *                  distal body with respect to the joint's proximal body as
+ *                  seen by the joint's distal frame \f$\{D\}\f$.
+ *                  Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)
+ */
+void dyn2b_rev_to_twist3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute the velocity or acceleration twist for a prismatic joint along an
+ * arbitrary axis for a dual joint velocity or acceleration (dual version of
+ * dyn2b_trans_to_twist3()).
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] jnt The dual joint velocity or acceleration.
+ *                Size: DYN2B_DUAL_SIZE(1)
+ * @param[out] cart The dual velocity or acceleration twist of the joint's
+ *                  distal body with respect to the joint's proximal body as
+ *                  seen by the joint's distal frame \f$\{D\}\f$.
+ *                  Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)
+ */
+void dyn2b_trans_to_twist3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart);
+
+
+/**
+ * Compute joint torques from a collection of wrenches for a revolute joint
+ * about an arbitrary axis.
+ *
+ * `jnt = ifk(cart)`
+ *
+ * @param[in] n Number of wrenches to transform.
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] cart The wrench applied to the joint's distal body
+ *                 \f$\mathcal{D}\f$ as seen by the joint's distal frame
+ *                 \f$\{D\}\f$ and that frame's origin \f$d\f$ as the reference
+ *                 point.
+ *                 Size: \f$[6 \times n]\f$
+ * @param[out] jnt The joint force.
+ *                 Size: \f$[1 \times n]\f$
+ */
+void dyn2b_rev_from_wrench3(
+        int n,
+        const double *restrict axis,
+        const double *restrict cart,
+        double *restrict jnt);
+
+
+/**
+ * Compute joint forces from a collection of wrenches for a prismatic joint
+ * along an arbitrary axis.
+ *
+ * `jnt = ifk(cart)`
+ *
+ * @param[in] n Number of wrenches to transform.
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] cart The wrench applied to the joint's distal body
+ *                 \f$\mathcal{D}\f$ as seen by the joint's distal frame
+ *                 \f$\{D\}\f$ and that frame's origin \f$d\f$ as the reference
+ *                 point.
+ *                 Size: \f$[6 \times n]\f$
+ * @param[out] jnt The joint force.
+ *                 Size: \f$[1 \times n]\f$
+ */
+void dyn2b_trans_from_wrench3(
+        int n,
+        const double *restrict axis,
+        const double *restrict cart,
+        double *restrict jnt);
+
+
+/**
+ * Project an articulated-body inertia over a revolute joint about an arbitrary
+ * axis (cf. dyn2b_rev_x_proj_abi3()). The joint's Jacobian is
+ * \f$\boldsymbol{S} = [\boldsymbol{a}^T, \boldsymbol{0}^T]^T\f$ so that
+ * \f$D\f$ remains a scalar and no factorization is required.
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *                 joint's distal sub-tree as seen by the joint's distal frame
+ *                 \f$\{D\}\f$.
+ *                 Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] m_out Apparent inertia \f${}^D\boldsymbol{I}^a\f$ of the joint's
+ *                   distal sub-tree as seen by the joint's distal frame
+ *                   \f$\{D\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ */
+void dyn2b_rev_proj_abi3(
+        const double *restrict axis,
+        const double *restrict d,
+        const double *restrict m_in,
+        double *restrict m_out);
+
+
+/**
+ * Project an articulated-body inertia over a prismatic joint along an
+ * arbitrary axis (cf. dyn2b_trans_x_proj_abi3()). The joint's Jacobian is
+ * \f$\boldsymbol{S} = [\boldsymbol{0}^T, \boldsymbol{a}^T]^T\f$.
+ *
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m_in Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *                 joint's distal sub-tree as seen by the joint's distal frame
+ *                 \f$\{D\}\f$.
+ *                 Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] m_out Apparent inertia \f${}^D\boldsymbol{I}^a\f$ of the joint's
+ *                   distal sub-tree as seen by the joint's distal frame
+ *                   \f$\{D\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ */
+void dyn2b_trans_proj_abi3(
+        const double *restrict axis,
+        const double *restrict d,
+        const double *restrict m_in,
+        double *restrict m_out);
+
+
+/**
+ * Project wrenches over a revolute joint about an arbitrary axis (cf.
+ * dyn2b_rev_x_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *              joint's distal sub-tree as seen by the joint's distal frame
+ *              \f$\{D\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[in] f_in Wrench \f${}^D\boldsymbol{w}^A\f$ of the joint's distal
+ *                 sub-tree as seen by the joint's distal frame \f$\{D\}\f$.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrench \f${}^D\boldsymbol{w}^a\f$
+ *                   of the joint's distal sub-tree as seen by the joint's
+ *                   distal frame \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_rev_proj_wrench3(
+        int n,
+        const double *restrict axis,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Project wrenches over a prismatic joint along an arbitrary axis (cf.
+ * dyn2b_trans_x_proj_wrench3()).
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] axis The joint axis \f$\boldsymbol{a}\f$ (cf. dyn2b_to_axis3()).
+ *                 Size: \f$[3 \times 1 + 6]\f$
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[1 \times 1]\f$.
+ * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *              joint's distal sub-tree as seen by the joint's distal frame
+ *              \f$\{D\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[in] f_in Wrench \f${}^D\boldsymbol{w}^A\f$ of the joint's distal
+ *                 sub-tree as seen by the joint's distal frame \f$\{D\}\f$.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrench \f${}^D\boldsymbol{w}^a\f$
+ *                   of the joint's distal sub-tree as seen by the joint's
+ *                   distal frame \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_trans_proj_wrench3(
+        int n,
+        const double *restrict axis,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out);
+
+
+/**
+ * Explictly compute the inverse of a generic joint's (specified by the joint's
+ * Jacobian matrix) inertia. This combines (i) the inertia felt from Cartesian
+ * space due to the links; and (ii) the inertia felt from an actuator.
+ *
+ * \f[
+ * D^{-1}
+ * = (d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S})^{-1}
+ * \f]
+ *
+ * where \f$\boldsymbol{S}\f$ is the joint's Jacobian matrix (or motion
+ * sub-space matrix) and \f$d\f$ is the inertia that the joint feels from the
+ * actuator, possibly through a gearbox.
+ *
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jac The joint Jacobian (or motion subspace matrix)
+ *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
+ *                \f$\{D\}\f$.
+ *                Size: \f$[6 \times \text{dof}]\f$.
+ * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *              joint's distal sub-tree as seen by the joint's distal frame
+ *              \f$\{D\}\f$. This inertia is represented as a dense matrix.
+ *              Size: \f$[6 \times 6]\f$.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              Size: \f$[\text{dof} \times \text{dof}]\f$.
+ * @param[out] dstms The inverse inertia \f$D^{-1}\f$.
+ *                   Size: \f$[\text{dof} \times \text{dof}]\f$.
+ */
+void dyn2b_jnt_inv_abi3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict m,
+        const double *restrict d,
+        double *restrict dstms);
+
+
+/**
+ * Factorize a generic joint's inertia instead of explicitly inverting it (cf.
+ * dyn2b_jnt_inv_abi3()). The result is the \f$LDL^T\f$ factorization of
+ *
+ * \f[
+ * D = d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}
+ * \f]
+ *
+ * which dyn2b_ldl_slv_mat() accepts to apply \f$D^{-1}\f$. This avoids the
+ * LAPACK call and the explicit inverse.
+ *
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jac The joint Jacobian (or motion subspace matrix)
+ *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
+ *                \f$\{D\}\f$.
+ *                Size: \f$[6 \times \text{dof}]\f$.
+ * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *              joint's distal sub-tree as seen by the joint's distal frame
+ *              \f$\{D\}\f$. This inertia is represented as a dense matrix.
+ *              Size: \f$[6 \times 6]\f$.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              \f$d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}\f$
+ *              must be positive-definite (cf. dyn2b_ldl_fct_mat()).
+ *              Size: \f$[\text{dof} \times \text{dof}]\f$.
+ * @param[out] fct The factorization of \f$D\f$ (cf. dyn2b_ldl_fct_mat()).
+ *                 Size: \f$[\text{dof} \times \text{dof}]\f$.
+ */
+void dyn2b_jnt_fct_abi3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict m,
+        const double *restrict d,
+        double *restrict fct);
+
+
+/**
+ * Compute an explicit projection matrix for a generic joint (specified by the
+ * joint's Jacobian matrix). This results in the so-called apparent inertia:
+ * after the projection (on the other side of the joint) the articulated-body
+ * inertia seems to reduce because of the joint.
+ *
+ * \f[
+ * \boldsymbol{P}^T
+ * = \boldsymbol{1} - {}^D\boldsymbol{I}^A~
+ *   {}^D\boldsymbol{S}~D^{-1}~{}^D\boldsymbol{S}^T
+ * \f]
+ *
+ * with
+ *
+ * \f[
+ * D = d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}
+ * \f]
+ *
+ * where \f$\boldsymbol{S}\f$ is the joint's Jacobian matrix (or motion
+ * sub-space matrix) and \f$d\f$ is the inertia that the joint feels from the
+ * actuator, possibly through a gearbox.
+ *
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jac The joint Jacobian (or motion subspace matrix)
+ *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
+ *                \f$\{D\}\f$.
+ *                Size: \f$[6 \times \text{dof}]\f$.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              \f$d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}\f$
+ *              must be positive-definite (cf. dyn2b_ldl_fct_mat()).
+ *              Size: \f$[\text{dof} \times \text{dof}]\f$.
+ * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *              joint's distal sub-tree as seen by the joint's distal frame
+ *              \f$\{D\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] proj The projection matrix \f$\boldsymbol{P}^T\f$.
+ *                  Size: \f$[6 \times 6]\f$.
+ */
+void dyn2b_jnt_to_proj3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict d,
+        const double *restrict m,
+        double *restrict proj);
+
+
+/**
+ * Project an articulated-body inertia over a generic joint (specified by the
+ * joint's Jacobian matrix). This results in the so-called apparent inertia:
+ * after the projection (on the other side of the joint) the articulated-body
+ * inertia seems to reduce because of the joint.
+ *
+ * \f[
+ * {}^D\boldsymbol{I}^a = \boldsymbol{P}^T~{}^D\boldsymbol{I}^A
+ * \f]
+ *
+ * with
+ *
+ * \f[
+ * \boldsymbol{P}^T
+ * = \boldsymbol{1} - {}^D\boldsymbol{I}^A~
+ *   {}^D\boldsymbol{S}~D^{-1}~{}^D\boldsymbol{S}^T
+ * \f]
+ *
+ * and
+ *
+ * \f[
+ * D = d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}
+ * \f]
+ *
+ * where \f$\boldsymbol{S}\f$ is the joint's Jacobian matrix (or motion
+ * sub-space matrix) and \f$d\f$ is the inertia that the joint feels from the
+ * actuator, possibly through a gearbox.
+ *
+ * The function does not construct the projection matrix. Instead, it directly
+ * applies the rank-dof update
+ * \f$
+ * {}^D\boldsymbol{I}^A - \boldsymbol{U}~D^{-1}~\boldsymbol{U}^T
+ * \f$
+ * with \f$\boldsymbol{U} = {}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}\f$ to the
+ * blocks of the articulated-body inertia.
+ *
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jac The joint Jacobian (or motion subspace matrix)
+ *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
+ *                \f$\{D\}\f$.
+ *                Size: \f$[6 \times \text{dof}]\f$.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              \f$d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}\f$
+ *              must be positive-definite (cf. dyn2b_ldl_fct_mat()).
+ *              Size: \f$[\text{dof} \times \text{dof}]\f$.
+ * @param[in] m_in Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *                 joint's distal sub-tree as seen by the joint's distal frame
+ *                 \f$\{D\}\f$.
+ *                 Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] m_out Apparent inertia \f${}^D\boldsymbol{I}^a\f$ of the joint's
+ *                   distal sub-tree as seen by the joint's distal frame
+ *                   \f$\{D\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ */
+void dyn2b_jnt_proj_abi3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict d,
+        const double *restrict m_in,
+        double *restrict m_out);
+
+
+/**
+ * Project a collection of articulated-body wrenches over a generic joint
+ * (specified by the joint's Jacobian matrix). This results in the so-called
+ * apparent wrench: the projection represents how much force is used to
+ * accelerate the joint.
  *
  * \f[
  * {}^D\boldsymbol{w}^a = \boldsymbol{P}^T~{}^D\boldsymbol{w}^A
@@ -1229,6 +2176,8 @@ void dyn2b_jnt_proj_abi3(
  *                \f$\{D\}\f$.
  *                Size: \f$[6 \times \text{dof}]\f$.
  * @param[in] d The joint inertia \f$d\f$.
+ *              \f$d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}\f$
+ *              must be positive-definite (cf. dyn2b_ldl_fct_mat()).
  *              Size: \f$[\text{dof} \times \text{dof}]\f$.
  * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
  *              joint's distal sub-tree as seen by the joint's distal frame
@@ -1251,8 +2200,199 @@ void dyn2b_jnt_proj_wrench3(
         const double *restrict f_in,
         double *restrict f_out);
 
+
+/**
+ * Number of doubles that the workspace of dyn2b_jnt_proj_wrench3_ws()
+ * requires.
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_jnt_proj_wrench3(
+        int n,
+        int dof);
+
+
+/**
+ * Same as dyn2b_jnt_proj_wrench3() but with a caller-provided workspace
+ * instead of variable-length arrays on the stack whose size grows with
+ * \f$n\f$.
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jac The joint Jacobian (or motion subspace matrix)
+ *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
+ *                \f$\{D\}\f$.
+ *                Size: \f$[6 \times \text{dof}]\f$.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              \f$d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}\f$
+ *              must be positive-definite (cf. dyn2b_ldl_fct_mat()).
+ *              Size: \f$[\text{dof} \times \text{dof}]\f$.
+ * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *              joint's distal sub-tree as seen by the joint's distal frame
+ *              \f$\{D\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[in] f_in Wrench \f${}^D\boldsymbol{w}^A\f$ of the joint's distal
+ *                 sub-tree as seen by the joint's distal frame \f$\{D\}\f$.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrench \f${}^D\boldsymbol{w}^a\f$
+ *                   of the joint's distal sub-tree as seen by the joint's
+ *                   distal frame \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_jnt_proj_wrench3().
+ */
+void dyn2b_jnt_proj_wrench3_ws(
+        int n,
+        int dof,
+        const double *restrict jac,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out,
+        double *restrict ws);
+
+
+/**
+ * Compute the joint projection context of a generic joint (specified by the
+ * joint's Jacobian matrix). The context holds the quantities that are shared
+ * by the projection of the articulated-body inertia, the projection of the
+ * wrenches and the joint acceleration in the subsequent forward sweep:
+ *
+ * \f[
+ * \boldsymbol{U} = {}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}, \quad
+ * D = d + {}^D\boldsymbol{S}^T~\boldsymbol{U}, \quad
+ * \boldsymbol{K} = \boldsymbol{U}~D^{-1}
+ * \f]
+ *
+ * where \f$D\f$ is stored in its factorized form. Hence, \f$D\f$ is factorized
+ * only once per joint instead of once per consumer.
+ *
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jac The joint Jacobian (or motion subspace matrix)
+ *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
+ *                \f$\{D\}\f$.
+ *                Size: \f$[6 \times \text{dof}]\f$.
+ * @param[in] d The joint inertia \f$d\f$.
+ *              \f$d + {}^D\boldsymbol{S}^T~{}^D\boldsymbol{I}^A~{}^D\boldsymbol{S}\f$
+ *              must be positive-definite (cf. dyn2b_ldl_fct_mat()).
+ *              Size: \f$[\text{dof} \times \text{dof}]\f$.
+ * @param[in] m Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *              joint's distal sub-tree as seen by the joint's distal frame
+ *              \f$\{D\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] jpc The joint projection context.
+ *                 Size: DYN2B_JPC3_SIZE(dof).
+ */
+void dyn2b_jnt_to_jpc3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict d,
+        const double *restrict m,
+        double *restrict jpc);
+
+
+/**
+ * Same as dyn2b_jnt_proj_abi3() but with a precomputed joint projection
+ * context (cf. dyn2b_jnt_to_jpc3()).
+ *
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jpc The joint projection context computed from \p m_in.
+ *                Size: DYN2B_JPC3_SIZE(dof).
+ * @param[in] m_in Articulated-body inertia \f${}^D\boldsymbol{I}^A\f$ of the
+ *                 joint's distal sub-tree as seen by the joint's distal frame
+ *                 \f$\{D\}\f$.
+ *                 Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ * @param[out] m_out Apparent inertia \f${}^D\boldsymbol{I}^a\f$ of the joint's
+ *                   distal sub-tree as seen by the joint's distal frame
+ *                   \f$\{D\}\f$.
+ *                   Size: \f$[3 \times 3 + 3 \times 3 + 3 \times 3]\f$.
+ */
+void dyn2b_jnt_proj_abi3_jpc(
+        int dof,
+        const double *restrict jpc,
+        const double *restrict m_in,
+        double *restrict m_out);
+
+
+/**
+ * Same as dyn2b_jnt_proj_wrench3_ws() but with a precomputed joint projection
+ * context (cf. dyn2b_jnt_to_jpc3()).
+ *
+ * \f[
+ * {}^D\boldsymbol{w}^a
+ * = {}^D\boldsymbol{w}^A - \boldsymbol{K}~{}^D\boldsymbol{S}^T~
+ *   {}^D\boldsymbol{w}^A
+ * \f]
+ *
+ * @param[in] n Number of wrenches to project.
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jac The joint Jacobian (or motion subspace matrix)
+ *                \f${}^D\boldsymbol{S}\f$ as seen by the joint's distal frame
+ *                \f$\{D\}\f$.
+ *                Size: \f$[6 \times \text{dof}]\f$.
+ * @param[in] jpc The joint projection context.
+ *                Size: DYN2B_JPC3_SIZE(dof).
+ * @param[in] f_in Wrench \f${}^D\boldsymbol{w}^A\f$ of the joint's distal
+ *                 sub-tree as seen by the joint's distal frame \f$\{D\}\f$.
+ *                 Size: \f$[6 \times n]\f$.
+ * @param[out] f_out Apparent wrench \f${}^D\boldsymbol{w}^a\f$
+ *                   of the joint's distal sub-tree as seen by the joint's
+ *                   distal frame \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_jnt_proj_wrench3().
+ */
+void dyn2b_jnt_proj_wrench3_jpc(
+        int n,
+        int dof,
+        const double *restrict jac,
+        const double *restrict jpc,
+        const double *restrict f_in,
+        double *restrict f_out,
+        double *restrict ws);
+
+
+/**
+ * Compute a generic joint's acceleration in the forward sweep of the
+ * articulated-body algorithm from a precomputed joint projection context (cf.
+ * dyn2b_jnt_to_jpc3()).
+ *
+ * \f[
+ * \ddot{q} = D^{-1}~\tau - \boldsymbol{K}^T~{}^D\ddot{\boldsymbol{X}}
+ * \f]
+ *
+ * where \f$\tau\f$ is the joint force that remains after subtracting the
+ * articulated-body bias wrench, i.e.
+ * \f$\tau = \tau_j - {}^D\boldsymbol{S}^T~{}^D\boldsymbol{w}^A\f$, and
+ * \f${}^D\ddot{\boldsymbol{X}}\f$ is the proximal acceleration as seen by the
+ * distal frame (before adding the joint's contribution).
+ *
+ * @param[in] dof Number of joint's motion degrees of freedom.
+ * @param[in] jpc The joint projection context.
+ *                Size: DYN2B_JPC3_SIZE(dof).
+ * @param[in] tau The joint force \f$\tau\f$.
+ *                Size: \f$[\text{dof} \times 1]\f$.
+ * @param[in] xdd The acceleration twist \f${}^D\ddot{\boldsymbol{X}}\f$.
+ *                Size: \f$[6 \times 1]\f$.
+ * @param[out] qdd The joint acceleration \f$\ddot{q}\f$.
+ *                 Size: \f$[\text{dof} \times 1]\f$.
+ */
+void dyn2b_jnt_acc3_jpc(
+        int dof,
+        const double *restrict jpc,
+        const double *restrict tau,
+        const double *restrict xdd,
+        double *restrict qdd);
+
 #ifdef __cplusplus
 }
 #endif
 
+// Definitions of the header-only mode
+#ifdef DYN2B_INLINE
+#  include <dyn2b/inline/joint.h>
+#endif
+
 #endif
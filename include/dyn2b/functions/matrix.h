@@ -69,6 +69,149 @@ void dyn2b_mad_mat(
         double *restrict out,
         int ldo);
 
+
+/**
+ * Compute the \f$LDL^T\f$ factorization of a symmetric, positive-definite
+ * matrix without pivoting.
+ *
+ * \f[
+ * \boldsymbol{A} = \boldsymbol{L}~\boldsymbol{D}~\boldsymbol{L}^T
+ * \f]
+ *
+ * where \f$\boldsymbol{L}\f$ is unit lower triangular and \f$\boldsymbol{D}\f$
+ * is diagonal. All matrices are stored in column-major order. Without
+ * pivoting the factorization is only stable for positive-definite matrices
+ * such as a joint's inertia: all entries of \f$\boldsymbol{D}\f$ are then
+ * positive. Other matrices, even non-singular ones such as
+ * \f$\begin{pmatrix} 0 & 1 \\ 1 & 0 \end{pmatrix}\f$, are not supported. In
+ * contrast to Cholesky, it does not require square roots. For \f$n \le 6\f$ the
+ * loops are specialized on the matrix size.
+ *
+ * @param[in] n Number of rows and columns of the matrix.
+ * @param[in] a The symmetric, positive-definite matrix \f$\boldsymbol{A}\f$
+ *              of which only the lower triangle is accessed.
+ * @param[in] lda The leading dimension of the matrix, i.e. the number of
+ *                matrix entries between two columns (\f$lda \ge n\f$).
+ * @param[out] fct The factorization: the strict lower triangle contains
+ *                 \f$\boldsymbol{L}\f$ (its unit diagonal is implicit), the
+ *                 diagonal contains \f$\boldsymbol{D}^{-1}\f$ and the strict
+ *                 upper triangle is set to zero.
+ *                 Size: \f$[n \times n]\f$.
+ */
+void dyn2b_ldl_fct_mat(
+        int n,
+        const double *restrict a,
+        int lda,
+        double *restrict fct);
+
+
+/**
+ * Solve a linear system of equations with a matrix that has been factorized by
+ * dyn2b_ldl_fct_mat().
+ *
+ * \f[
+ * \boldsymbol{X} = \boldsymbol{A}^{-1}~\boldsymbol{B}
+ * = \boldsymbol{L}^{-T}~\boldsymbol{D}^{-1}~\boldsymbol{L}^{-1}~\boldsymbol{B}
+ * \f]
+ *
+ * @param[in] n Number of rows and columns of the matrix.
+ * @param[in] nrhs Number of right-hand sides, i.e. columns of \f$\boldsymbol{B}\f$.
+ * @param[in] fct The factorization of \f$\boldsymbol{A}\f$.
+ *                Size: \f$[n \times n]\f$.
+ * @param[in] b The right-hand sides \f$\boldsymbol{B}\f$ in column-major order.
+ * @param[in] ldb The leading dimension of the right-hand sides
+ *                (\f$ldb \ge n\f$).
+ * @param[out] x The solution \f$\boldsymbol{X}\f$ in column-major order.
+ * @param[in] ldx The leading dimension of the solution (\f$ldx \ge n\f$).
+ */
+void dyn2b_ldl_slv_mat(
+        int n,
+        int nrhs,
+        const double *restrict fct,
+        const double *restrict b,
+        int ldb,
+        double *restrict x,
+        int ldx);
+
+
+/**
+ * Compute the \f$L^TDL\f$ factorization of a symmetric matrix whose sparsity
+ * is induced by a kinematic tree as proposed by Featherstone ("Efficient
+ * Factorization of the Joint-Space Inertia Matrix for Branched Kinematic
+ * Trees", 2005).
+ *
+ * \f[
+ * \boldsymbol{A} = \boldsymbol{L}^T~\boldsymbol{D}~\boldsymbol{L}
+ * \f]
+ *
+ * where \f$\boldsymbol{L}\f$ is unit lower triangular and \f$\boldsymbol{D}\f$
+ * is diagonal. The sparsity pattern is given by the parent of each row/column
+ * with \f$parent[i] < i\f$ or \f$-1\f$ if there is none (cf. the
+ * joint-space inertia matrix of a tree with single-DoF joints): an
+ * off-diagonal entry \f$A_{ij}\f$ with \f$i < j\f$ may only be non-zero if
+ * \f$i\f$ is an ancestor of \f$j\f$. The factorization preserves this
+ * pattern (no fill-in) and only visits the entries in it. Hence, its cost
+ * depends on the depth of the tree instead of \f$n^3\f$ and it reduces to a
+ * dense factorization for a chain.
+ *
+ * In contrast to dyn2b_ldl_fct_mat(), the function operates on the upper
+ * triangle: there, the ancestors of a row/column are stored in the same
+ * column and, for consecutive ancestors such as along a chain, contiguously.
+ *
+ * @param[in] n Number of rows and columns of the matrix.
+ * @param[in] parent Parent of each row/column.
+ *                   Size: \f$[n]\f$.
+ * @param[in] a The symmetric matrix \f$\boldsymbol{A}\f$ of which only the
+ *              entries of the upper triangle in the sparsity pattern are
+ *              accessed.
+ * @param[in] lda The leading dimension of the matrix (\f$lda \ge n\f$).
+ * @param[out] fct The factorization: the strict upper triangle contains
+ *                 \f$\boldsymbol{L}^T\f$ (its unit diagonal is implicit),
+ *                 the diagonal contains \f$\boldsymbol{D}^{-1}\f$ and all
+ *                 other entries are set to zero.
+ *                 Size: \f$[n \times n]\f$.
+ */
+void dyn2b_ltdl_fct_mat(
+        int n,
+        const int *restrict parent,
+        const double *restrict a,
+        int lda,
+        double *restrict fct);
+
+
+/**
+ * Solve a linear system of equations with a matrix that has been factorized by
+ * dyn2b_ltdl_fct_mat().
+ *
+ * \f[
+ * \boldsymbol{X} = \boldsymbol{A}^{-1}~\boldsymbol{B}
+ * = \boldsymbol{L}^{-1}~\boldsymbol{D}^{-1}~\boldsymbol{L}^{-T}~\boldsymbol{B}
+ * \f]
+ *
+ * Like the factorization, the solution only visits the sparsity pattern.
+ *
+ * @param[in] n Number of rows and columns of the matrix.
+ * @param[in] nrhs Number of right-hand sides, i.e. columns of \f$\boldsymbol{B}\f$.
+ * @param[in] parent Parent of each row/column (cf. dyn2b_ltdl_fct_mat()).
+ *                   Size: \f$[n]\f$.
+ * @param[in] fct The factorization of \f$\boldsymbol{A}\f$.
+ *                Size: \f$[n \times n]\f$.
+ * @param[in] b The right-hand sides \f$\boldsymbol{B}\f$ in column-major order.
+ * @param[in] ldb The leading dimension of the right-hand sides
+ *                (\f$ldb \ge n\f$).
+ * @param[out] x The solution \f$\boldsymbol{X}\f$ in column-major order.
+ * @param[in] ldx The leading dimension of the solution (\f$ldx \ge n\f$).
+ */
+void dyn2b_ltdl_slv_mat(
+        int n,
+        int nrhs,
+        const int *restrict parent,
+        const double *restrict fct,
+        const double *restrict b,
+        int ldb,
+        double *restrict x,
+        int ldx);
+
 #ifdef __cplusplus
 }
 #endif
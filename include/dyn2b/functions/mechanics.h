@@ -119,6 +119,269 @@ void dyn2b_nrt_wrench3(
         double *restrict w);
 
 
+/**
+ * Directional derivatives of the velocity-dependent bias force (cf.
+ * dyn2b_nrt_wrench3()) with respect to the screw velocity twist. For each
+ * velocity variation \f$\delta\dot{\boldsymbol{x}}\f$ it computes
+ *
+ * \f[
+ * \delta{}^D\boldsymbol{w}
+ * = [\delta\dot{\boldsymbol{x}}]_\times~{}^D\boldsymbol{I}_\mathcal{D}~
+ *     {}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}
+ *   + [{}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}]_\times~
+ *     {}^D\boldsymbol{I}_\mathcal{D}~\delta\dot{\boldsymbol{x}}
+ * \f]
+ *
+ * @param[in] n Number of velocity variations.
+ * @param[in] rbi Rigid-body inertia \f${}^D\boldsymbol{I}_\mathcal{D}\f$.
+ *                Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ * @param[in] xd Screw velocity twist
+ *               \f${}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}\f$ as
+ *               seen by frame \f$\{D\}\f$.
+ *               Size: \f$[6 \times 1]\f$.
+ * @param[in] xd_drv Velocity variations \f$\delta\dot{\boldsymbol{x}}\f$ as
+ *                   seen by frame \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[out] w_drv Variations \f$\delta{}^D\boldsymbol{w}\f$ of the wrench as
+ *                   seen by frame \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_nrt_wrench3_dxd(
+        int n,
+        const double *restrict rbi,
+        const double *restrict xd,
+        const double *restrict xd_drv,
+        double *restrict w_drv);
+
+
+/**
+ * Compute the wrench that a rigid body requires to perform a motion, i.e.
+ * evaluate the complete right-hand side of the equations of motion
+ *
+ * \f[
+ * {}^D\boldsymbol{w}
+ * = {}^D\boldsymbol{I}_\mathcal{D}~
+ *     {}^D\ddot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}
+ *   + [{}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}]_\times~
+ *     {}^D\boldsymbol{I}_\mathcal{D}~
+ *     {}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}
+ * \f]
+ *
+ * in a single pass. The result equals the sum of dyn2b_rbi_to_wrench3() and
+ * dyn2b_nrt_wrench3().
+ *
+ * @param[in] rbi Rigid-body inertia \f${}^D\boldsymbol{I}_\mathcal{D}\f$.
+ *                Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ * @param[in] xd Screw velocity twist
+ *               \f${}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}\f$ as
+ *               seen by frame \f$\{D\}\f$.
+ *               Size: \f$[6 \times 1]\f$.
+ * @param[in] xdd Screw acceleration twist
+ *                \f${}^D\ddot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}\f$
+ *                as seen by frame \f$\{D\}\f$.
+ *                Size: \f$[6 \times 1]\f$.
+ * @param[out] w Wrench \f${}^D\boldsymbol{w}\f$ as seen by frame \f$\{D\}\f$.
+ *               Size: \f$[6 \times 1]\f$.
+ */
+void dyn2b_eom_wrench3(
+        const double *restrict rbi,
+        const double *restrict xd,
+        const double *restrict xdd,
+        double *restrict w);
+
+
+/**
+ * Transform a rigid-body inertia from a distal frame \f$\{D\}\f$ to a
+ * proximal frame \f$\{P\}\f$.
+ *
+ * \f[
+ * {}^P\boldsymbol{I}
+ * = {}^P\boldsymbol{X}_D^*~{}^D\boldsymbol{I}~{}^D\boldsymbol{X}_P
+ * \f]
+ *
+ * In contrast to dyn2b_tf_prox_abi3(), the result is again a rigid-body
+ * inertia. With \f$\boldsymbol{R} = {}^P\boldsymbol{R}_D\f$ and
+ * \f$\boldsymbol{r} = {}^P\boldsymbol{r}^{p,d}\f$ the components are
+ *
+ * \f[
+ * m' = m, \quad
+ * \boldsymbol{h}' = \boldsymbol{R}~\boldsymbol{h} + m~\boldsymbol{r}, \quad
+ * \bar{\boldsymbol{I}}'
+ * = \boldsymbol{R}~\bar{\boldsymbol{I}}~\boldsymbol{R}^T
+ *   - [\boldsymbol{r}]_\times~[\boldsymbol{h}']_\times
+ *   - [\boldsymbol{R}~\boldsymbol{h}]_\times~[\boldsymbol{r}]_\times
+ * \f]
+ *
+ * Since rigid-body inertias are additive, this is the building block to
+ * compose the inertia of multiple rigid bodies, e.g. the composite inertias
+ * in the composite-rigid-body algorithm.
+ *
+ * @param[in] x Screw transformation \f${}^D\boldsymbol{X}_P\f$ of distal frame
+ *              \f$\{D\}\f$ with respect to proximal frame \f$\{P\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 1]\f$.
+ * @param[in] rbi_dist Rigid-body inertia \f${}^D\boldsymbol{I}\f$ as seen by
+ *                     distal frame \f$\{D\}\f$.
+ *                     Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ * @param[out] rbi_prox Rigid-body inertia \f${}^P\boldsymbol{I}\f$ as seen by
+ *                      proximal frame \f$\{P\}\f$.
+ *                      Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ */
+void dyn2b_tf_prox_rbi3(
+        const double *restrict x,
+        const double *restrict rbi_dist,
+        double *restrict rbi_prox);
+
+
+/**
+ * Pack a rigid-body inertia, i.e. only keep the upper triangle of the
+ * symmetric rotational inertia (cf. DYN2B_RBI3P_* and DYN2B_SYM3_IDX). The
+ * result is the ten-element inertial-parameter vector.
+ *
+ * @param[in] in Rigid-body inertia.
+ *               Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ * @param[out] out Packed rigid-body inertia.
+ *                 Size: \f$[6 + 3 \times 1 + 1]\f$.
+ */
+void dyn2b_pck_rbi3(
+        const double *restrict in,
+        double *restrict out);
+
+
+/**
+ * Unpack a rigid-body inertia (inverse of dyn2b_pck_rbi3()).
+ *
+ * @param[in] in Packed rigid-body inertia.
+ *               Size: \f$[6 + 3 \times 1 + 1]\f$.
+ * @param[out] out Rigid-body inertia.
+ *                 Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ */
+void dyn2b_unp_rbi3(
+        const double *restrict in,
+        double *restrict out);
+
+
+/**
+ * Map a screw acceleration twist into a wrench with a packed rigid-body inertia
+ * (packed version of dyn2b_rbi_to_wrench3()).
+ *
+ * @param[in] rbi Packed rigid-body inertia \f${}^D\boldsymbol{I}_\mathcal{D}\f$.
+ *                Size: \f$[6 + 3 \times 1 + 1]\f$.
+ * @param[in] xdd Screw acceleration twist
+ *                \f${}^D\ddot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}\f$
+ *                as seen by frame \f$\{D\}\f$.
+ *                Size: \f$[6 \times 1]\f$.
+ * @param[out] w Wrench \f${}^D\boldsymbol{w}\f$ as seen by frame \f$\{D\}\f$.
+ *               Size: \f$[6 \times 1]\f$.
+ */
+void dyn2b_rbi_to_wrench3p(
+        const double *restrict rbi,
+        const double *restrict xdd,
+        double *restrict w);
+
+
+/**
+ * Compute the velocity-dependent, bias force with a packed rigid-body inertia
+ * (packed version of dyn2b_nrt_wrench3()).
+ *
+ * @param[in] rbi Packed rigid-body inertia \f${}^D\boldsymbol{I}_\mathcal{D}\f$.
+ *                Size: \f$[6 + 3 \times 1 + 1]\f$.
+ * @param[in] xd Screw velocity twist
+ *               \f${}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{D}}\f$ as
+ *               seen by frame \f$\{D\}\f$.
+ *               Size: \f$[6 \times 1]\f$.
+ * @param[out] w Wrench \f${}^D\boldsymbol{w}\f$ as seen by frame \f$\{D\}\f$.
+ *               Size: \f$[6 \times 1]\f$.
+ */
+void dyn2b_nrt_wrench3p(
+        const double *restrict rbi,
+        const double *restrict xd,
+        double *restrict w);
+
+
+/**
+ * Transform a dual screw acceleration twist from a proximal frame \f$P\f$ to a
+ * distal frame \f$D\f$ (dual version of dyn2b_tf_dist_acc3(), cf. the `_dual`
+ * functions in screw.h).
+ *
+ * @param[in] x Dual pose \f${}^P\boldsymbol{X}_D\f$.
+ *              Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE).
+ * @param[in] xd_abs Dual screw velocity twist
+ *                   \f${}^D\dot{\boldsymbol{x}}_{\mathcal{W},\mathcal{P}}\f$.
+ *                   Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ * @param[in] xd_rel Dual screw velocity twist
+ *                   \f${}^D\dot{\boldsymbol{x}}_{\mathcal{P},\mathcal{D}}\f$.
+ *                   Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ * @param[in] xdd_prox Dual screw acceleration twist
+ *                     \f${}^P\ddot{\boldsymbol{x}}_{\mathcal{W},\mathcal{P}}\f$.
+ *                     Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ * @param[out] xdd_dist Dual screw acceleration twist
+ *                      \f${}^D\ddot{\boldsymbol{x}}_{\mathcal{W},\mathcal{P}}\f$.
+ *                      Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ */
+void dyn2b_tf_dist_acc3_dual(
+        const double *restrict x,
+        const double *restrict xd_abs,
+        const double *restrict xd_rel,
+        const double *restrict xdd_prox,
+        double *restrict xdd_dist);
+
+
+/**
+ * Map a dual acceleration twist to a dual wrench with a rigid-body inertia
+ * (dual version of dyn2b_rbi_to_wrench3()). The inertia is a constant, i.e.
+ * it does not carry tangents.
+ *
+ * @param[in] rbi Rigid-body inertia \f${}^D\boldsymbol{I}_\mathcal{D}\f$.
+ *                Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ * @param[in] xdd Dual screw acceleration twist as seen by frame \f$\{D\}\f$.
+ *                Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ * @param[out] w Dual wrench as seen by frame \f$\{D\}\f$.
+ *               Size: DYN2B_DUAL_SIZE(DYN2B_WRENCH3_SIZE).
+ */
+void dyn2b_rbi_to_wrench3_dual(
+        const double *restrict rbi,
+        const double *restrict xdd,
+        double *restrict w);
+
+
+/**
+ * Compute the velocity-dependent, bias force for a dual velocity twist (dual
+ * version of dyn2b_nrt_wrench3()). Its tangents are the directional
+ * derivatives that dyn2b_nrt_wrench3_dxd() computes.
+ *
+ * @param[in] rbi Rigid-body inertia \f${}^D\boldsymbol{I}_\mathcal{D}\f$.
+ *                Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ * @param[in] xd Dual screw velocity twist as seen by frame \f$\{D\}\f$.
+ *               Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ * @param[out] w Dual wrench as seen by frame \f$\{D\}\f$.
+ *               Size: DYN2B_DUAL_SIZE(DYN2B_WRENCH3_SIZE).
+ */
+void dyn2b_nrt_wrench3_dual(
+        const double *restrict rbi,
+        const double *restrict xd,
+        double *restrict w);
+
+
+/**
+ * Compute the wrench that a rigid body requires to perform a dual motion
+ * (dual version of dyn2b_eom_wrench3()).
+ *
+ * @param[in] rbi Rigid-body inertia \f${}^D\boldsymbol{I}_\mathcal{D}\f$.
+ *                Size: \f$[3 \times 3 + 3 \times 1 + 1]\f$.
+ * @param[in] xd Dual screw velocity twist as seen by frame \f$\{D\}\f$.
+ *               Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ * @param[in] xdd Dual screw acceleration twist as seen by frame \f$\{D\}\f$.
+ *                Size: DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE).
+ * @param[out] w Dual wrench as seen by frame \f$\{D\}\f$.
+ *               Size: DYN2B_DUAL_SIZE(DYN2B_WRENCH3_SIZE).
+ */
+void dyn2b_eom_wrench3_dual(
+        const double *restrict rbi,
+        const double *restrict xd,
+        const double *restrict xdd,
+        double *restrict w);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,26 @@ extern "C" {
  * - Transformations
  * - Screw dot product
  * - Screw cross product
+ *
+ * The functions with the `_batch` suffix evaluate the same operator for many
+ * independent instances (e.g. sampled states) in one call. Their arguments are
+ * stored as structure of arrays: the \f$k\f$-th entry of the \f$i\f$-th instance
+ * is located at index \f$k \cdot ld + i\f$ so that each entry is contiguous
+ * across the instances.
+ *
+ * The functions with the `_dual` suffix propagate, in addition to the value,
+ * \f$K\f$ tangent directions for forward-mode automatic differentiation
+ * (cf. DYN2B_DUAL_*). The tangents use the same structure-of-arrays layout
+ * with the directions as instances so that one call evaluates the directional
+ * derivatives along all \f$K\f$ directions.
+ *
+ * The functions with the `3q` suffix take poses whose orientation is a unit
+ * quaternion instead of a rotation matrix (cf. DYN2B_POSE3Q_*). Such a pose
+ * occupies 7 instead of 12 doubles and its composition stays a rotation up to
+ * the quaternion's norm, which is why long chains and stored trajectories
+ * prefer it. The matrix functions transform screws faster, though: unless a
+ * pose transforms a single screw, convert it once with dyn2b_to_mat_pose3q()
+ * and use the functions without the `3q` suffix.
  */
 
 
@@ -46,6 +66,32 @@ void dyn2b_cmp_pose3(
         double *restrict x_comp);
 
 
+/**
+ * Compose many pairs of 3D poses (batched version of dyn2b_cmp_pose3()).
+ *
+ * \f[
+ * {}^W\boldsymbol{X}_{D,i} = {}^W\boldsymbol{X}_{P,i} {}^P\boldsymbol{X}_{D,i}
+ * \f]
+ *
+ * @param[in] n Number of instances.
+ * @param[in] ld The leading dimension of all buffers, i.e. the number of
+ *               elements between two consecutive entries of one instance
+ *               (\f$ld \ge n\f$).
+ * @param[in] x_prox The proximal poses \f${}^W\boldsymbol{X}_{P,i}\f$.
+ *                   Size: \f$[(3 \times 3 + 3 \times 1) \times ld]\f$.
+ * @param[in] x_dist The distal poses \f${}^P\boldsymbol{X}_{D,i}\f$.
+ *                   Size: \f$[(3 \times 3 + 3 \times 1) \times ld]\f$.
+ * @param[out] x_comp The composite poses \f${}^W\boldsymbol{X}_{D,i}\f$.
+ *                    Size: \f$[(3 \times 3 + 3 \times 1) \times ld]\f$.
+ */
+void dyn2b_cmp_pose3_batch(
+        int n,
+        int ld,
+        const double *restrict x_prox,
+        const double *restrict x_dist,
+        double *restrict x_comp);
+
+
 /**
  * Compute the dot product between two collections of 3D screws.
  *
@@ -281,6 +327,102 @@ void dyn2b_tf_dist_screw3(
         double *restrict s_dist);
 
 
+/**
+ * Number of doubles that the workspace of dyn2b_tf_dist_screw3_ws() requires.
+ *
+ * @param[in] n Number of screws to transform.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_tf_dist_screw3(
+        int n);
+
+
+/**
+ * Same as dyn2b_tf_dist_screw3() but with a caller-provided workspace instead
+ * of a variable-length array on the stack.
+ *
+ * @param[in] n Number of screws to transform.
+ * @param[in] x The pose \f${}^P\boldsymbol{X}_D\f$ of proximal frame
+ *              \f$\{P\}\f$ with respect to distal frame \f$\{D\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 1]\f$.
+ * @param[in] s_prox Screw \f${}^P\boldsymbol{s}\f$ as seen by proximal frame
+ *                   \f$\{P\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[out] s_dist Screw \f${}^D\boldsymbol{s}\f$ as seen by distal frame
+ *                    \f$\{D\}\f$.
+ *                    Size: \f$[6 \times n]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_tf_dist_screw3().
+ */
+void dyn2b_tf_dist_screw3_ws(
+        int n,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist,
+        double *restrict ws);
+
+
+/**
+ * Transform many 3D screws, each with its own pose, from the pose's proximal
+ * frame to the pose's distal frame (batched version of dyn2b_tf_dist_screw3()).
+ *
+ * \f[
+ * {}^D\boldsymbol{s}_i = {}^P\boldsymbol{X}_{D,i}^{-1}~{}^P\boldsymbol{s}_i
+ * \f]
+ *
+ * @param[in] n Number of instances.
+ * @param[in] ld The leading dimension of all buffers, i.e. the number of
+ *               elements between two consecutive entries of one instance
+ *               (\f$ld \ge n\f$).
+ * @param[in] x The poses \f${}^P\boldsymbol{X}_{D,i}\f$.
+ *              Size: \f$[(3 \times 3 + 3 \times 1) \times ld]\f$.
+ * @param[in] s_prox Screws \f${}^P\boldsymbol{s}_i\f$ as seen by the proximal
+ *                   frames.
+ *                   Size: \f$[6 \times ld]\f$.
+ * @param[out] s_dist Screws \f${}^D\boldsymbol{s}_i\f$ as seen by the distal
+ *                    frames.
+ *                    Size: \f$[6 \times ld]\f$.
+ */
+void dyn2b_tf_dist_screw3_batch(
+        int n,
+        int ld,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist);
+
+
+/**
+ * Derivative of transformed 3D screws (cf. dyn2b_tf_dist_screw3()) with respect
+ * to the position \f$q\f$ of a joint that connects the proximal frame to the
+ * distal frame, i.e. \f${}^P\boldsymbol{X}_D(q)\f$. The joint's unit twist
+ * \f${}^D\boldsymbol{S}\f$ must be constant as seen by the distal frame which
+ * is the case for all revolute and prismatic joints (cf. joint.h). Then
+ *
+ * \f[
+ * \frac{\partial {}^D\boldsymbol{s}}{\partial q}
+ * = -{}^D\boldsymbol{S} \times {}^D\boldsymbol{s}
+ * = {}^D\boldsymbol{s} \times {}^D\boldsymbol{S}
+ * \f]
+ *
+ * so that the derivative follows from the already transformed screws.
+ *
+ * @param[in] n Number of screws.
+ * @param[in] s_jnt The joint's unit twist \f${}^D\boldsymbol{S}\f$ as seen by
+ *                  distal frame \f$\{D\}\f$.
+ *                  Size: \f$[6 \times 1]\f$.
+ * @param[in] s_dist Screw \f${}^D\boldsymbol{s}\f$ as seen by distal frame
+ *                   \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[out] out The derivative as seen by distal frame \f$\{D\}\f$.
+ *                 Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_tf_dist_screw3_dq(
+        int n,
+        const double *restrict s_jnt,
+        const double *restrict s_dist,
+        double *restrict out);
+
+
 /**
  * Rotate a collection of 3D screws from an orientation's distal frame to the
  * orientation's proximal frame.
@@ -363,6 +505,290 @@ void dyn2b_tf_prox_screw3(
         double *restrict s_prox);
 
 
+/**
+ * Transform many 3D screws, each with its own pose, from the pose's distal
+ * frame to the pose's proximal frame (batched version of
+ * dyn2b_tf_prox_screw3()).
+ *
+ * \f[
+ * {}^P\boldsymbol{s}_i = {}^P\boldsymbol{X}_{D,i}~{}^D\boldsymbol{s}_i
+ * \f]
+ *
+ * @param[in] n Number of instances.
+ * @param[in] ld The leading dimension of all buffers, i.e. the number of
+ *               elements between two consecutive entries of one instance
+ *               (\f$ld \ge n\f$).
+ * @param[in] x The poses \f${}^P\boldsymbol{X}_{D,i}\f$.
+ *              Size: \f$[(3 \times 3 + 3 \times 1) \times ld]\f$.
+ * @param[in] s_dist Screws \f${}^D\boldsymbol{s}_i\f$ as seen by the distal
+ *                   frames.
+ *                   Size: \f$[6 \times ld]\f$.
+ * @param[out] s_prox Screws \f${}^P\boldsymbol{s}_i\f$ as seen by the proximal
+ *                    frames.
+ *                    Size: \f$[6 \times ld]\f$.
+ */
+void dyn2b_tf_prox_screw3_batch(
+        int n,
+        int ld,
+        const double *restrict x,
+        const double *restrict s_dist,
+        double *restrict s_prox);
+
+
+/**
+ * Derivative of transformed 3D screws (cf. dyn2b_tf_prox_screw3()) with respect
+ * to the position \f$q\f$ of a joint that connects the proximal frame to the
+ * distal frame (cf. dyn2b_tf_dist_screw3_dq()).
+ *
+ * \f[
+ * \frac{\partial {}^P\boldsymbol{s}}{\partial q}
+ * = {}^P\boldsymbol{X}_D~({}^D\boldsymbol{S} \times {}^D\boldsymbol{s})
+ * \f]
+ *
+ * @param[in] n Number of screws.
+ * @param[in] x The pose \f${}^P\boldsymbol{X}_D\f$ of proximal frame
+ *              \f$\{P\}\f$ with respect to distal frame \f$\{D\}\f$.
+ *              Size: \f$[3 \times 3 + 3 \times 1]\f$.
+ * @param[in] s_jnt The joint's unit twist \f${}^D\boldsymbol{S}\f$ as seen by
+ *                  distal frame \f$\{D\}\f$.
+ *                  Size: \f$[6 \times 1]\f$.
+ * @param[in] s_dist Screw \f${}^D\boldsymbol{s}\f$ as seen by distal frame
+ *                   \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[out] out The derivative as seen by proximal frame \f$\{P\}\f$.
+ *                 Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_tf_prox_screw3_dq(
+        int n,
+        const double *restrict x,
+        const double *restrict s_jnt,
+        const double *restrict s_dist,
+        double *restrict out);
+
+
+/**
+ * Convert a 3D pose to a quaternion pose (Shepperd's method). The quaternion
+ * is normalized and its scalar part is non-negative.
+ *
+ * @param[in] x The pose.
+ *              Size: \f$[3 \times 3 + 3 \times 1]\f$.
+ * @param[out] xq The quaternion pose.
+ *                Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ */
+void dyn2b_to_pose3q(
+        const double *restrict x,
+        double *restrict xq);
+
+
+/**
+ * Convert a quaternion pose to a 3D pose (inverse of dyn2b_to_pose3q()).
+ *
+ * \f[
+ * \boldsymbol{R} = \boldsymbol{1}
+ *   + s \left( w \left[\boldsymbol{v}\right]_\times
+ *   + \left[\boldsymbol{v}\right]_\times^2 \right),
+ * \quad s = \frac{2}{\|\boldsymbol{v}\|^2 + w^2}
+ * \f]
+ *
+ * The scaling by the squared norm yields a rotation even if the quaternion's
+ * norm has drifted away from one.
+ *
+ * @param[in] xq The quaternion pose.
+ *               Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ * @param[out] x The pose.
+ *               Size: \f$[3 \times 3 + 3 \times 1]\f$.
+ */
+void dyn2b_to_mat_pose3q(
+        const double *restrict xq,
+        double *restrict x);
+
+
+/**
+ * Compose two quaternion poses (quaternion version of dyn2b_cmp_pose3()).
+ *
+ * \f{eqnarray*}{
+ *   {}^W\boldsymbol{q}_D     &=& {}^W\boldsymbol{q}_P \otimes {}^P\boldsymbol{q}_D \\
+ *   {}^W\boldsymbol{r}^{w,d} &=& {}^W\boldsymbol{r}^{w,p}
+ *                              + {}^W\boldsymbol{q}_P \otimes {}^P\boldsymbol{r}^{p,d}
+ *                                \otimes {}^W\boldsymbol{q}_P^*
+ * \f}
+ *
+ * The quaternions must be unit quaternions. The product takes 16
+ * multiplications and the rotation of the position 18 instead of the 27 and 9
+ * of dyn2b_cmp_pose3().
+ *
+ * @param[in] x_prox The proximal quaternion pose \f${}^W\boldsymbol{X}_P\f$.
+ *                   Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ * @param[in] x_dist The distal quaternion pose \f${}^P\boldsymbol{X}_D\f$.
+ *                   Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ * @param[out] x_comp The composite quaternion pose \f${}^W\boldsymbol{X}_D\f$.
+ *                    Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ */
+void dyn2b_cmp_pose3q(
+        const double *restrict x_prox,
+        const double *restrict x_dist,
+        double *restrict x_comp);
+
+
+/**
+ * Renormalize the unit quaternion of a quaternion pose.
+ *
+ * \f[
+ * \boldsymbol{q} \leftarrow \frac{\boldsymbol{q}}{\|\boldsymbol{q}\|}
+ * \f]
+ *
+ * Each composition (dyn2b_cmp_pose3q()) lets the quaternion's norm drift by a
+ * few rounding errors. Long chains, e.g. integrating a trajectory, should
+ * renormalize every few compositions since dyn2b_cmp_pose3q() assumes unit
+ * quaternions. The position is unchanged.
+ *
+ * @param[in,out] xq The quaternion pose. Its quaternion must not vanish.
+ *                   Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ */
+void dyn2b_nrm_pose3q(
+        double *restrict xq);
+
+
+/**
+ * Transform a collection of 3D screws from a quaternion pose's proximal frame
+ * to the pose's distal frame (quaternion version of dyn2b_tf_dist_screw3()).
+ * The rotation matrix is computed once, as in dyn2b_to_mat_pose3q(), but kept
+ * in local variables and applied to all screws. This saves the conversion's
+ * stores and reloads for a single screw. For more screws
+ * dyn2b_to_mat_pose3q() followed by dyn2b_tf_dist_screw3() is faster.
+ *
+ * @param[in] n Number of screws to transform.
+ * @param[in] x The quaternion pose \f${}^P\boldsymbol{X}_D\f$.
+ *              Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ * @param[in] s_prox Screw \f${}^P\boldsymbol{s}\f$ as seen by proximal frame
+ *                   \f$\{P\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[out] s_dist Screw \f${}^D\boldsymbol{s}\f$ as seen by distal frame
+ *                    \f$\{D\}\f$.
+ *                    Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_tf_dist_screw3q(
+        int n,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist);
+
+
+/**
+ * Transform a collection of 3D screws from a quaternion pose's distal frame to
+ * the pose's proximal frame (quaternion version of dyn2b_tf_prox_screw3()).
+ * The rotation matrix is computed once, as in dyn2b_to_mat_pose3q(), but kept
+ * in local variables and applied to all screws. This saves the conversion's
+ * stores and reloads for a single screw. For more screws
+ * dyn2b_to_mat_pose3q() followed by dyn2b_tf_prox_screw3() is faster.
+ *
+ * @param[in] n Number of screws to transform.
+ * @param[in] x The quaternion pose \f${}^P\boldsymbol{X}_D\f$.
+ *              Size: \f$[4 \times 1 + 3 \times 1]\f$.
+ * @param[in] s_dist Screw \f${}^D\boldsymbol{s}\f$ as seen by distal frame
+ *                   \f$\{D\}\f$.
+ *                   Size: \f$[6 \times n]\f$.
+ * @param[out] s_prox Screw \f${}^P\boldsymbol{s}\f$ as seen by proximal frame
+ *                    \f$\{P\}\f$.
+ *                    Size: \f$[6 \times n]\f$.
+ */
+void dyn2b_tf_prox_screw3q(
+        int n,
+        const double *restrict x,
+        const double *restrict s_dist,
+        double *restrict s_prox);
+
+
+/**
+ * Compose two dual 3D poses (dual version of dyn2b_cmp_pose3()).
+ *
+ * \f[
+ * \delta{}^W\boldsymbol{X}_D
+ * = \delta{}^W\boldsymbol{X}_P~{}^P\boldsymbol{X}_D
+ *   + {}^W\boldsymbol{X}_P~\delta{}^P\boldsymbol{X}_D
+ * \f]
+ *
+ * @param[in] x_prox The dual pose \f${}^W\boldsymbol{X}_P\f$.
+ *                   Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE).
+ * @param[in] x_dist The dual pose \f${}^P\boldsymbol{X}_D\f$.
+ *                   Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE).
+ * @param[out] x_comp The dual pose \f${}^W\boldsymbol{X}_D\f$.
+ *                    Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE).
+ */
+void dyn2b_cmp_pose3_dual(
+        const double *restrict x_prox,
+        const double *restrict x_dist,
+        double *restrict x_comp);
+
+
+/**
+ * Compute the cross product of two dual 3D screws (dual version of
+ * dyn2b_crs_screw3()).
+ *
+ * \f[
+ * \delta(\boldsymbol{s}_1 \times \boldsymbol{s}_2)
+ * = \delta\boldsymbol{s}_1 \times \boldsymbol{s}_2
+ *   + \boldsymbol{s}_1 \times \delta\boldsymbol{s}_2
+ * \f]
+ *
+ * @param[in] s1 First dual screw.
+ *               Size: DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE).
+ * @param[in] s2 Second dual screw.
+ *               Size: DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE).
+ * @param[out] out The dual screw cross product.
+ *                 Size: DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE).
+ */
+void dyn2b_crs_screw3_dual(
+        const double *restrict s1,
+        const double *restrict s2,
+        double *restrict out);
+
+
+/**
+ * Transform a collection of dual 3D screws from a dual pose's proximal frame to
+ * the pose's distal frame (dual version of dyn2b_tf_dist_screw3()).
+ *
+ * The \f$n\f$ screws form a single dual quantity with \f$6 n\f$ entries, i.e.
+ * their values are stored as in dyn2b_tf_dist_screw3() and followed by all
+ * tangents.
+ *
+ * @param[in] n Number of screws to transform.
+ * @param[in] x The dual pose \f${}^P\boldsymbol{X}_D\f$.
+ *              Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE).
+ * @param[in] s_prox Dual screws as seen by proximal frame \f$\{P\}\f$.
+ *                   Size: DYN2B_DUAL_SIZE(6 n).
+ * @param[out] s_dist Dual screws as seen by distal frame \f$\{D\}\f$.
+ *                    Size: DYN2B_DUAL_SIZE(6 n).
+ */
+void dyn2b_tf_dist_screw3_dual(
+        int n,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist);
+
+
+/**
+ * Transform a collection of dual 3D screws from a dual pose's distal frame to
+ * the pose's proximal frame (dual version of dyn2b_tf_prox_screw3()).
+ *
+ * The \f$n\f$ screws form a single dual quantity with \f$6 n\f$ entries (cf.
+ * dyn2b_tf_dist_screw3_dual()).
+ *
+ * @param[in] n Number of screws to transform.
+ * @param[in] x The dual pose \f${}^P\boldsymbol{X}_D\f$.
+ *              Size: DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE).
+ * @param[in] s_dist Dual screws as seen by distal frame \f$\{D\}\f$.
+ *                   Size: DYN2B_DUAL_SIZE(6 n).
+ * @param[out] s_prox Dual screws as seen by proximal frame \f$\{P\}\f$.
+ *                    Size: DYN2B_DUAL_SIZE(6 n).
+ */
+void dyn2b_tf_prox_screw3_dual(
+        int n,
+        const double *restrict x,
+        const double *restrict s_dist,
+        double *restrict s_prox);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,8 @@
 #ifndef DYN2B_FUNCTIONS_VECTOR3_H
 #define DYN2B_FUNCTIONS_VECTOR3_H
 
+#include <dyn2b/inline/api.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -32,7 +34,7 @@ extern "C" {
  *                i.e. the number of elements between two 3D vectors
  *                (\f$ldo \ge n\f$).
  */
-void dyn2b_crs_vec3(
+DYN2B_INLINE_API void dyn2b_crs_vec3(
         int n,
         const double *restrict in1,
         int ld1,
@@ -66,7 +68,7 @@ void dyn2b_crs_vec3(
  *                i.e. the number of elements between two 3D vectors
  *                (\f$ldo \ge n\f$).
  */
-void dyn2b_cad_vec3(
+DYN2B_INLINE_API void dyn2b_cad_vec3(
         int n,
         const double *restrict in1, // [3xn]
         int ld1,
@@ -86,7 +88,7 @@ void dyn2b_cad_vec3(
  * @param[in] in The 3D input vector.
  * @param[out] out The \f$3 \times 3\f$ output matrix.
  */
-void dyn2b_skw_vec3(
+DYN2B_INLINE_API void dyn2b_skw_vec3(
         const double *restrict in,
         double *restrict out);
 
@@ -94,4 +96,9 @@ void dyn2b_skw_vec3(
 }
 #endif
 
+// Definitions of the header-only mode
+#ifdef DYN2B_INLINE
+#  include <dyn2b/inline/vector3.h>
+#endif
+
 #endif
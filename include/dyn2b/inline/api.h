@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_INLINE_API_H
+#define DYN2B_INLINE_API_H
+
+
+// Header-only mode of the tiny operators, i.e. the ones that only do a handful
+// of flops (array.h, vector3.h and the fixed-axis joints in joint.h). If a
+// translation unit defines DYN2B_INLINE before it includes any dyn2b header,
+// those operators become static inline functions whose definitions the public
+// headers pull in from dyn2b/inline/. The compiler can then inline them into
+// the caller instead of going through the shared library's PLT. All other
+// operators still come from the library. The header-only mode only affects the
+// translation units that opt into it and may be mixed with others in the same
+// program.
+#ifdef DYN2B_INLINE
+#  define DYN2B_INLINE_API static inline
+#else
+#  define DYN2B_INLINE_API
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_INLINE_ARRAY_H
+#define DYN2B_INLINE_ARRAY_H
+
+#include <dyn2b/inline/api.h>
+
+
+/*
+ * Definitions of the component-wise operations on arrays (cf. array.h).
+ */
+
+
+DYN2B_INLINE_API void dyn2b_cpy_arr(
+        int n,
+        const double *restrict in,
+        double *restrict out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = in[i];
+    }
+}
+
+
+DYN2B_INLINE_API void dyn2b_add_arr(
+        int n,
+        int offset,
+        const double *restrict in1,
+        const double *restrict in2,
+        double *restrict out)
+{
+    for (int i = 0; i < n; i++) {
+        out[offset + i] = in1[i] + in2[i];
+    }
+}
+
+
+DYN2B_INLINE_API void dyn2b_add_arr_i(
+        int n,
+        int offset,
+        const double *restrict in,
+        double *restrict out)
+{
+    for (int i = 0; i < n; i++) {
+        out[offset + i] += in[i];
+    }
+}
+
+
+DYN2B_INLINE_API void dyn2b_sub_arr(
+        int n,
+        const double *restrict in1,
+        const double *restrict in2,
+        double *restrict out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = in1[i] - in2[i];
+    }
+}
+
+
+DYN2B_INLINE_API void dyn2b_scl_arr(
+        int n,
+        const double *restrict a,
+        const double *restrict in,
+        double *restrict out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = *a * in[i];
+    }
+}
+
+
+DYN2B_INLINE_API void dyn2b_inv_arr(
+        int n,
+        const double *restrict in,
+        double *restrict out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = -in[i];
+    }
+}
+
+#endif
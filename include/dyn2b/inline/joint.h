@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_INLINE_JOINT_H
+#define DYN2B_INLINE_JOINT_H
+
+#include <dyn2b/inline/api.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/types/vector3.h>
+#include <math.h>
+#include <assert.h>
+
+
+/*
+ * Definitions of the position, velocity and force kinematics of the joints
+ * with a fixed axis and of the composition with their poses (cf. joint.h).
+ * They are generated for each joint in DYN2B_JNT_ALIGNED with the joint type
+ * and axis as literals so that the branches on them vanish.
+ */
+
+
+/*
+ * The composition of the revolute joints takes the cosine and sine of the
+ * joint position, the one of the prismatic joints the joint position itself.
+ * The joint rotates the columns a and b of R_p or moves along column k.
+ */
+#define DYN2B_INL_JNT_CMP_POSE3_REV(name, k) \
+    DYN2B_INLINE_API void dyn2b_##name##_cmp_pose3( \
+            const double *restrict x_prox, \
+            double cq, \
+            double sq, \
+            double *restrict x_comp) \
+    { \
+        assert(x_prox); \
+        assert(x_comp); \
+        \
+        const int a = ((k) + 1) % 3; \
+        const int b = ((k) + 2) % 3; \
+        \
+        const double *rot_p = &x_prox[DYN2B_POSE3_ANG_OFFSET]; \
+        const double *pos_p = &x_prox[DYN2B_POSE3_LIN_OFFSET]; \
+        double *rot = &x_comp[DYN2B_POSE3_ANG_OFFSET]; \
+        double *pos = &x_comp[DYN2B_POSE3_LIN_OFFSET]; \
+        const double *rot_pk = &rot_p[DYN2B_POSE3_ANG_LD * (k)]; \
+        const double *rot_pa = &rot_p[DYN2B_POSE3_ANG_LD * a]; \
+        const double *rot_pb = &rot_p[DYN2B_POSE3_ANG_LD * b]; \
+        for (int i = 0; i < 3; i++) { \
+            rot[(DYN2B_POSE3_ANG_LD * (k)) + i] = rot_pk[i]; \
+            rot[(DYN2B_POSE3_ANG_LD * a) + i] \
+                    = cq * rot_pa[i] + sq * rot_pb[i]; \
+            rot[(DYN2B_POSE3_ANG_LD * b) + i] \
+                    = cq * rot_pb[i] - sq * rot_pa[i]; \
+            pos[i] = pos_p[i]; \
+        } \
+    }
+
+#define DYN2B_INL_JNT_CMP_POSE3_TRANS(name, k) \
+    DYN2B_INLINE_API void dyn2b_##name##_cmp_pose3( \
+            const double *restrict x_prox, \
+            const double *restrict jnt, \
+            double *restrict x_comp) \
+    { \
+        assert(x_prox); \
+        assert(jnt); \
+        assert(x_comp); \
+        \
+        const double *rot_p = &x_prox[DYN2B_POSE3_ANG_OFFSET]; \
+        const double *pos_p = &x_prox[DYN2B_POSE3_LIN_OFFSET]; \
+        double *rot = &x_comp[DYN2B_POSE3_ANG_OFFSET]; \
+        double *pos = &x_comp[DYN2B_POSE3_LIN_OFFSET]; \
+        const double *rot_pk = &rot_p[DYN2B_POSE3_ANG_LD * (k)]; \
+        for (int i = 0; i < DYN2B_POSE3_ANG_SIZE; i++) { \
+            rot[i] = rot_p[i]; \
+        } \
+        for (int i = 0; i < 3; i++) { \
+            pos[i] = pos_p[i] + jnt[0] * rot_pk[i]; \
+        } \
+    }
+
+
+#define DYN2B_INL_JNT_ALIGNED(name, type, k) \
+    DYN2B_INLINE_API void dyn2b_##name##_to_pose3( \
+            const double *restrict jnt, \
+            double *restrict cart) \
+    { \
+        assert(jnt); \
+        assert(cart); \
+        \
+        const int rev = (DYN2B_JNT_ALIGNED_##type == DYN2B_JNT_ALIGNED_REV); \
+        /* The axes a and b that span the plane of rotation */ \
+        const int a = ((k) + 1) % 3; \
+        const int b = ((k) + 2) % 3; \
+        double cq = rev ? cos(*jnt) : 1.0; \
+        double sq = rev ? sin(*jnt) : 0.0; \
+        \
+        /* Column-major layout */ \
+        double *rot = &cart[DYN2B_POSE3_ANG_OFFSET]; \
+        double *pos = &cart[DYN2B_POSE3_LIN_OFFSET]; \
+        rot[(DYN2B_POSE3_ANG_LD * (k)) + (k)] = 1.0; \
+        rot[(DYN2B_POSE3_ANG_LD * (k)) + a] = 0.0; \
+        rot[(DYN2B_POSE3_ANG_LD * (k)) + b] = 0.0; \
+        rot[(DYN2B_POSE3_ANG_LD * a) + (k)] = 0.0; \
+        rot[(DYN2B_POSE3_ANG_LD * a) + a] =  cq; \
+        rot[(DYN2B_POSE3_ANG_LD * a) + b] =  sq; \
+        rot[(DYN2B_POSE3_ANG_LD * b) + (k)] = 0.0; \
+        rot[(DYN2B_POSE3_ANG_LD * b) + a] = -sq; \
+        rot[(DYN2B_POSE3_ANG_LD * b) + b] =  cq; \
+        pos[k] = rev ? 0.0 : *jnt; \
+        pos[a] = 0.0; \
+        pos[b] = 0.0; \
+    } \
+    \
+    DYN2B_INL_JNT_CMP_POSE3_##type(name, k) \
+    \
+    DYN2B_INLINE_API void dyn2b_##name##_to_twist3( \
+            const double *restrict jnt, \
+            double *restrict cart) \
+    { \
+        assert(jnt); \
+        assert(cart); \
+        \
+        const int rev = (DYN2B_JNT_ALIGNED_##type == DYN2B_JNT_ALIGNED_REV); \
+        const int a = ((k) + 1) % 3; \
+        const int b = ((k) + 2) % 3; \
+        \
+        /* Angular-before-linear order */ \
+        double *ang = &cart[DYN2B_TWIST3_ANG_OFFSET]; \
+        double *lin = &cart[DYN2B_TWIST3_LIN_OFFSET]; \
+        ang[k] = rev ? *jnt : 0.0; \
+        ang[a] = 0.0; \
+        ang[b] = 0.0; \
+        lin[k] = rev ? 0.0 : *jnt; \
+        lin[a] = 0.0; \
+        lin[b] = 0.0; \
+    } \
+    \
+    DYN2B_INLINE_API void dyn2b_##name##_from_wrench3( \
+            int n, \
+            const double *restrict cart, \
+            double *restrict jnt) \
+    { \
+        assert(n >= 0); \
+        assert(jnt); \
+        assert(cart); \
+        \
+        /* Linear-before-angular order */ \
+        const int off = (DYN2B_JNT_ALIGNED_##type == DYN2B_JNT_ALIGNED_REV) \
+                        ? DYN2B_WRENCH3_ANG_OFFSET : DYN2B_WRENCH3_LIN_OFFSET; \
+        for (int i = 0; i < n; i++) { \
+            jnt[i] = cart[(i * DYN2B_SCREW3_SIZE) + off + (k)]; \
+        } \
+    }
+
+DYN2B_JNT_ALIGNED(DYN2B_INL_JNT_ALIGNED)
+
+#endif
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_ABA_H
+#define DYN2B_SOLVERS_ABA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file aba.h
+ *
+ * Articulated-body algorithm (ABA) for the forward dynamics of a kinematic
+ * tree (cf. tree.h). The algorithm consists of three sweeps over the tree that
+ * are also available as separate functions so that they can be timed (or
+ * interleaved with other computations) individually. The sweeps communicate
+ * via the workspace and must be called in order:
+ *
+ * 1. dyn2b_aba_vel(): outward sweep of the velocities
+ * 2. dyn2b_aba_abi(): inward sweep of the articulated-body inertias and bias
+ *    wrenches
+ * 3. dyn2b_aba_acc(): outward sweep of the accelerations
+ */
+
+
+/**
+ * Number of doubles that the workspace of the ABA functions requires.
+ *
+ * @param[in] nb Number of bodies.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_aba(
+        int nb);
+
+
+/**
+ * Compute the joint accelerations that result from the given joint forces
+ * (forward dynamics) with the articulated-body algorithm. This is the same as
+ * calling dyn2b_aba_vel(), dyn2b_aba_abi() and dyn2b_aba_acc() in this order.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] d Inertia that each joint feels from its actuator (e.g. the
+ *              reflected rotor inertia).
+ *              Size: \f$[n_b]\f$.
+ * @param[in] xdd_base Screw acceleration twist of the base as seen by the base
+ *                     frame (cf. dyn2b_rnea()).
+ *                     Size: \f$[6 \times 1]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] qd Joint velocities.
+ *               Size: \f$[n_b]\f$.
+ * @param[in] tau Joint forces.
+ *                Size: \f$[n_b]\f$.
+ * @param[in] f_ext External wrench that acts on each body as seen by the body's
+ *                  frame. May be `NULL` if there are no external wrenches.
+ *                  Size: \f$[6 \times n_b]\f$.
+ * @param[out] qdd Joint accelerations.
+ *                 Size: \f$[n_b]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_aba().
+ */
+void dyn2b_aba(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict tau,
+        const double *restrict f_ext,
+        double *restrict qdd,
+        double *restrict ws);
+
+
+/**
+ * First (outward) sweep of the articulated-body algorithm. It computes each
+ * body's pose with respect to its parent, velocity, velocity-product
+ * acceleration and the bias wrench of the body alone.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] qd Joint velocities.
+ *               Size: \f$[n_b]\f$.
+ * @param[in] f_ext External wrench that acts on each body as seen by the body's
+ *                  frame. May be `NULL` if there are no external wrenches.
+ *                  Size: \f$[6 \times n_b]\f$.
+ * @param[in,out] ws Workspace.
+ *                   Size: dyn2b_workspace_size_aba().
+ */
+void dyn2b_aba_vel(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict f_ext,
+        double *restrict ws);
+
+
+/**
+ * Second (inward) sweep of the articulated-body algorithm. It projects each
+ * body's articulated-body inertia and bias wrench over the body's joint and
+ * accumulates the apparent quantities in the parent body. The sweep only
+ * depends on the results of dyn2b_aba_vel() and may be repeated, e.g. for
+ * different joint forces.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] d Inertia that each joint feels from its actuator.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] tau Joint forces.
+ *                Size: \f$[n_b]\f$.
+ * @param[in,out] ws Workspace as left by dyn2b_aba_vel().
+ *                   Size: dyn2b_workspace_size_aba().
+ */
+void dyn2b_aba_abi(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict tau,
+        double *restrict ws);
+
+
+/**
+ * Third (outward) sweep of the articulated-body algorithm. It computes each
+ * joint's and body's acceleration.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] xdd_base Screw acceleration twist of the base as seen by the base
+ *                     frame (cf. dyn2b_rnea()).
+ *                     Size: \f$[6 \times 1]\f$.
+ * @param[out] qdd Joint accelerations.
+ *                 Size: \f$[n_b]\f$.
+ * @param[in,out] ws Workspace as left by dyn2b_aba_abi().
+ *                   Size: dyn2b_workspace_size_aba().
+ */
+void dyn2b_aba_acc(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict xdd_base,
+        double *restrict qdd,
+        double *restrict ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_ABA_MIXED_H
+#define DYN2B_SOLVERS_ABA_MIXED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file aba_mixed.h
+ *
+ * Mixed-precision articulated-body algorithm (cf. aba.h) for a kinematic tree
+ * (cf. tree.h) that is only available if the single-precision API is built
+ * (ENABLE_FLOAT). The tree, the state, the poses, twists and wrenches are
+ * single-precision (cf. dyn2b_abaf()) while the articulated-body inertias are
+ * double-precision:
+ *
+ * - the joint inertia \f$D = d + \boldsymbol{S}^T \boldsymbol{I}^A
+ *   \boldsymbol{S}\f$ and \f$\boldsymbol{U} = \boldsymbol{I}^A
+ *   \boldsymbol{S}\f$
+ * - the apparent inertia \f$\boldsymbol{I}^a = \boldsymbol{I}^A -
+ *   \boldsymbol{U} D^{-1} \boldsymbol{U}^T\f$ (dyn2b_*_proj_abi3())
+ * - the composite sums of the apparent inertias in the parent bodies
+ *   (dyn2b_tf_prox_abi3())
+ *
+ * The subtraction in the apparent inertia cancels more and more digits the
+ * heavier the sub-tree behind a joint is in comparison to the joint's own
+ * inertia, i.e. towards the root of long chains. In single precision, this
+ * error dominates the joint accelerations long before the errors of the
+ * kinematic quantities do (cf. the dyn2b_aba_accuracy benchmark).
+ */
+
+
+/**
+ * Number of floats that the single-precision workspace of dyn2b_aba_mixed()
+ * requires.
+ *
+ * @param[in] nb Number of bodies.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_aba_mixed(
+        int nb);
+
+
+/**
+ * Number of doubles that the double-precision workspace of dyn2b_aba_mixed()
+ * requires.
+ *
+ * @param[in] nb Number of bodies.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_aba_mixed_abi(
+        int nb);
+
+
+/**
+ * Compute the joint accelerations that result from the given joint forces
+ * (forward dynamics) with the mixed-precision articulated-body algorithm.
+ * Except for the precision, the arguments are the same as the ones of
+ * dyn2b_aba().
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] d Inertia that each joint feels from its actuator.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] xdd_base Screw acceleration twist of the base as seen by the base
+ *                     frame.
+ *                     Size: \f$[6 \times 1]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] qd Joint velocities.
+ *               Size: \f$[n_b]\f$.
+ * @param[in] tau Joint forces.
+ *                Size: \f$[n_b]\f$.
+ * @param[in] f_ext External wrench that acts on each body as seen by the body's
+ *                  frame. May be `NULL` if there are no external wrenches.
+ *                  Size: \f$[6 \times n_b]\f$.
+ * @param[out] qdd Joint accelerations.
+ *                 Size: \f$[n_b]\f$.
+ * @param[in,out] ws Single-precision workspace. Its content on entry and exit
+ *                   is unspecified.
+ *                   Size: dyn2b_workspace_size_aba_mixed().
+ * @param[in,out] ws_abi Double-precision workspace. Its content on entry and
+ *                       exit is unspecified.
+ *                       Size: dyn2b_workspace_size_aba_mixed_abi().
+ */
+void dyn2b_aba_mixed(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const float *restrict axis,
+        const float *restrict x_tree,
+        const float *restrict rbi,
+        const float *restrict d,
+        const float *restrict xdd_base,
+        const float *restrict q,
+        const float *restrict qd,
+        const float *restrict tau,
+        const float *restrict f_ext,
+        float *restrict qdd,
+        float *restrict ws,
+        double *restrict ws_abi);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_ACHD_H
+#define DYN2B_SOLVERS_ACHD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file achd.h
+ *
+ * Acceleration-constrained hybrid dynamics (ACHD) solver by Popov and
+ * Vereshchagin for a kinematic tree (cf. tree.h). It extends the
+ * articulated-body algorithm (cf. aba.h) by \f$n_c\f$ acceleration constraints
+ * that act on arbitrary bodies of the tree. The \f$k\f$-th constraint is
+ * given by a unit constraint wrench \f$\boldsymbol{\alpha}_k\f$ that acts on
+ * body \f$b_k\f$ and the desired acceleration energy \f$\beta_k\f$:
+ *
+ * \f[
+ * \boldsymbol{\alpha}_k \cdot \ddot{\boldsymbol{x}}_{b_k} = \beta_k
+ * \f]
+ *
+ * The solver computes the joint accelerations together with the magnitudes
+ * \f$\boldsymbol{\nu}\f$ of the constraint wrenches that realize the
+ * constraints, i.e. the wrench \f$\boldsymbol{\alpha}_k \nu_k\f$ acts on body
+ * \f$b_k\f$.
+ *
+ * All \f$n_c\f$ unit constraint wrenches are propagated together as one
+ * \f$6 \times n_c\f$ block per body, so that the operators that support
+ * multiple instances (dyn2b_*_proj_wrench3(), dyn2b_tf_prox_screw3() and
+ * dyn2b_dot_screw3()) process all constraints in one call.
+ */
+
+
+/**
+ * Number of doubles that the workspace of dyn2b_achd() requires.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] nc Number of constraints.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_achd(
+        int nb,
+        int nc);
+
+
+/**
+ * Compute the joint accelerations that result from the given joint forces
+ * subject to acceleration constraints (hybrid dynamics) with the
+ * Popov-Vereshchagin solver.
+ *
+ * The first two sweeps are the ones of the articulated-body algorithm
+ * (dyn2b_aba_vel() and dyn2b_aba_abi()). A third, inward sweep projects each
+ * body's block of unit constraint wrenches over the body's joint
+ * (dyn2b_*_proj_wrench3()) and accumulates it in the parent body
+ * (dyn2b_tf_prox_screw3()). On its way, it accumulates the constraint
+ * coupling matrix \f$\boldsymbol{L}\f$ (dyn2b_dot_screw3()) and the
+ * acceleration energy \f$\boldsymbol{g}\f$ that the unconstrained motion
+ * produces against the constraints. The constraint magnitudes follow from
+ *
+ * \f[
+ * \boldsymbol{L}~\boldsymbol{\nu} = \boldsymbol{\beta} - \boldsymbol{g}
+ * \f]
+ *
+ * which is solved via the \f$LDL^T\f$ factorization (dyn2b_ldl_fct_mat()).
+ * Finally, the ABA's outward sweep (dyn2b_aba_acc()) computes the accelerations
+ * with the additional joint forces that the constraint wrenches cause.
+ *
+ * The factorization requires that \f$\boldsymbol{L}\f$ is positive definite,
+ * i.e. that the constraints are independent. In particular, there must be at
+ * least \f$n_c\f$ joints between the constrained bodies and the base.
+ *
+ * The accelerations that enter the constraints are the ones that the solver
+ * propagates and, hence, include the fictitious acceleration of the base that
+ * represents gravity (cf. dyn2b_rnea()).
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] d Inertia that each joint feels from its actuator.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] xdd_base Screw acceleration twist of the base as seen by the base
+ *                     frame (cf. dyn2b_rnea()).
+ *                     Size: \f$[6 \times 1]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] qd Joint velocities.
+ *               Size: \f$[n_b]\f$.
+ * @param[in] tau Joint forces.
+ *                Size: \f$[n_b]\f$.
+ * @param[in] f_ext External wrench that acts on each body as seen by the body's
+ *                  frame. May be `NULL` if there are no external wrenches.
+ *                  Size: \f$[6 \times n_b]\f$.
+ * @param[in] nc Number of constraints.
+ * @param[in] con_body Body \f$b_k\f$ on which each constraint acts.
+ *                     Size: \f$[n_c]\f$.
+ * @param[in] alpha Unit constraint wrench \f$\boldsymbol{\alpha}_k\f$ of each
+ *                  constraint as seen by the frame of body \f$b_k\f$.
+ *                  Size: \f$[6 \times n_c]\f$.
+ * @param[in] beta Desired acceleration energy \f$\beta_k\f$ of each
+ *                 constraint.
+ *                 Size: \f$[n_c]\f$.
+ * @param[out] qdd Joint accelerations.
+ *                 Size: \f$[n_b]\f$.
+ * @param[out] nu Magnitude \f$\nu_k\f$ of each constraint wrench.
+ *                Size: \f$[n_c]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_achd().
+ */
+void dyn2b_achd(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict tau,
+        const double *restrict f_ext,
+        int nc,
+        const int *restrict con_body,
+        const double *restrict alpha,
+        const double *restrict beta,
+        double *restrict qdd,
+        double *restrict nu,
+        double *restrict ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
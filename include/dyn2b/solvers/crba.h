@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_CRBA_H
+#define DYN2B_SOLVERS_CRBA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file crba.h
+ *
+ * Composite-rigid-body algorithm (CRBA) for the joint-space inertia matrix of
+ * a kinematic tree (cf. tree.h).
+ */
+
+
+/**
+ * Number of doubles that the workspace of dyn2b_crba() requires.
+ *
+ * @param[in] nb Number of bodies.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_crba(
+        int nb);
+
+
+/**
+ * Compute the joint-space inertia matrix \f$\boldsymbol{H}\f$ with the
+ * composite-rigid-body algorithm.
+ *
+ * The inward sweep accumulates each body's composite inertia, i.e. the
+ * rigid-body inertia of the subtree that the body supports, in its parent
+ * (dyn2b_tf_prox_rbi3()). The wrench that the composite inertia requires for
+ * a unit acceleration of the body's joint (dyn2b_rbi_to_wrench3()) is then
+ * transformed towards the base (dyn2b_tf_prox_screw3()) and projected onto
+ * each joint on the way, which yields one row and column of
+ * \f$\boldsymbol{H}\f$.
+ *
+ * Entries \f$H_{ij}\f$ where neither body is an ancestor of the other are
+ * zero. This branch-induced sparsity is the pattern that
+ * dyn2b_ltdl_fct_mat() exploits with `parent` as the sparsity pattern.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] d Inertia that each joint feels from its actuator. It is added
+ *              to the diagonal.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[out] h The symmetric joint-space inertia matrix in column-major
+ *               order (both triangles).
+ *               Size: \f$[n_b \times n_b]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_crba().
+ */
+void dyn2b_crba(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict q,
+        double *restrict h,
+        double *restrict ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_FK_H
+#define DYN2B_SOLVERS_FK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file fk.h
+ *
+ * Forward position kinematics of a whole configuration of a kinematic tree
+ * (cf. tree.h).
+ *
+ * Instead of one call of `sin()` and `cos()` per revolute joint (cf.
+ * dyn2b_rev_to_pose3()), the sines and cosines of all joint positions are
+ * evaluated in one branch-free pass that the compiler vectorizes: a
+ * Cody-Waite reduction to \f$[-\pi/4, \pi/4]\f$ followed by the minimax
+ * polynomials of fdlibm. For \f$|q| \leq 4096\f$ the absolute error of each
+ * sine and cosine is below \f$2^{-52} \approx 2.2 \cdot 10^{-16}\f$ (double
+ * precision) or \f$2^{-23} \approx 1.2 \cdot 10^{-7}\f$ (single precision),
+ * i.e. within about one unit in the last place of the libm result. Larger
+ * joint positions fall back to `sin()` and `cos()`.
+ *
+ * The bound requires the reduction to be evaluated as written, i.e. without
+ * `-fassociative-math` (part of `-ffast-math`) which the CMake build therefore
+ * disables for this solver. Otherwise the sines and cosines stay correct but
+ * lose accuracy with growing \f$|q|\f$ (about \f$10^{-13}\f$ at
+ * \f$|q| = 1000\f$).
+ */
+
+
+/**
+ * Compute the pose of each joint's distal frame with respect to its proximal
+ * frame for all joints of a tree at once. The result equals the one of the
+ * joints' dyn2b_*_to_pose3() up to the error bound above.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[out] x_jnt The pose of each joint.
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ */
+void dyn2b_jnt_to_pose3(
+        int nb,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict q,
+        double *restrict x_jnt);
+
+
+/**
+ * Compute the pose of each body's frame with respect to its parent's frame,
+ * i.e. the joint poses (dyn2b_jnt_to_pose3()) composed with the tree's constant
+ * poses. The axis-aligned joints skip the dense composition and only update
+ * the affected columns (cf. dyn2b_rev_x_cmp_pose3()).
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[out] x The pose of each body's frame with respect to its parent.
+ *               Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ */
+void dyn2b_jnt_cmp_pose3(
+        int nb,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict q,
+        double *restrict x);
+
+
+/**
+ * Compute the pose of each body with respect to the base frame, i.e. the
+ * bodies' relative poses (dyn2b_jnt_cmp_pose3()) composed from the base
+ * outwards (dyn2b_cmp_pose3()).
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[out] x The pose of each body's frame with respect to the base frame.
+ *               Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ */
+void dyn2b_fk(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict q,
+        double *restrict x);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
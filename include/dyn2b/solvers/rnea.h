@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_RNEA_H
+#define DYN2B_SOLVERS_RNEA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file rnea.h
+ *
+ * Recursive Newton-Euler algorithm (RNEA) for the inverse dynamics of a
+ * kinematic tree (cf. tree.h).
+ */
+
+
+/**
+ * Number of doubles that the workspace of dyn2b_rnea() requires.
+ *
+ * @param[in] nb Number of bodies.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_rnea(
+        int nb);
+
+
+/**
+ * Compute the joint forces that realize the given joint accelerations (inverse
+ * dynamics) with the recursive Newton-Euler algorithm.
+ *
+ * The outward sweep computes each body's pose, velocity and acceleration
+ * (dyn2b_tf_dist_screw3(), dyn2b_tf_dist_acc3()) as well as the wrench that
+ * the body requires for this motion (dyn2b_eom_wrench3()). The inward sweep
+ * projects the wrenches onto the joints and accumulates them in the parent
+ * bodies (dyn2b_tf_prox_screw3()).
+ *
+ * Gravity is accounted for by a fictitious acceleration of the base, e.g.
+ * \f$\ddot{\boldsymbol{x}}_0 = [0, 0, 0, 0, 0, 9.81]\f$ for gravity along the
+ * base frame's negative \f$z\f$-axis.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] xdd_base Screw acceleration twist of the base as seen by the base
+ *                     frame.
+ *                     Size: \f$[6 \times 1]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] qd Joint velocities.
+ *               Size: \f$[n_b]\f$.
+ * @param[in] qdd Joint accelerations.
+ *                Size: \f$[n_b]\f$.
+ * @param[in] f_ext External wrench that acts on each body as seen by the body's
+ *                  frame. May be `NULL` if there are no external wrenches.
+ *                  Size: \f$[6 \times n_b]\f$.
+ * @param[out] tau Joint forces.
+ *                 Size: \f$[n_b]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_rnea().
+ */
+void dyn2b_rnea(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict qdd,
+        const double *restrict f_ext,
+        double *restrict tau,
+        double *restrict ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
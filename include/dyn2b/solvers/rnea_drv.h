@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_RNEA_DRV_H
+#define DYN2B_SOLVERS_RNEA_DRV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file rnea_drv.h
+ *
+ * Analytical derivatives of the inverse dynamics (cf. rnea.h) of a kinematic
+ * tree (cf. tree.h) with respect to the joint positions, velocities and
+ * accelerations, e.g. for the linearization of the dynamics in trajectory
+ * optimization or model-predictive control.
+ *
+ * The algorithm follows Carpentier and Mansard's analytical derivatives of the
+ * RNEA. All quantities are expressed in the base frame. There, a joint
+ * \f$j\f$ rotates all quantities of its subtree alike about its joint twist
+ * \f$\boldsymbol{S}_j\f$, i.e. their derivative is a cross product with
+ * \f$\boldsymbol{S}_j\f$ (cf. dyn2b_tf_dist_screw3_dq()). The only remaining
+ * effects stem from the velocity and acceleration of the joint's parent. They
+ * enter via composite quantities that the inward sweep accumulates (cf. the
+ * composite inertia in dyn2b_crba()). Hence, the effort per body is constant
+ * and each pair of a joint and one of its ancestors only costs a few pairings
+ * of wrenches with twists instead of \f$2 n_b\f$ sweeps of the RNEA as for
+ * finite differences.
+ */
+
+
+/**
+ * Number of doubles that the workspace of dyn2b_rnea_drv() requires.
+ *
+ * @param[in] nb Number of bodies.
+ * @return Workspace size.
+ */
+int dyn2b_workspace_size_rnea_drv(
+        int nb);
+
+
+/**
+ * Compute the joint forces of the inverse dynamics (cf. dyn2b_rnea()) together
+ * with their partial derivatives with respect to the joint positions,
+ * velocities and accelerations.
+ *
+ * The outward sweep computes each body's pose, joint twist, velocity,
+ * acceleration, inertia (dyn2b_tf_prox_rbi3()) and wrench as seen by the base
+ * frame. It also computes the rate of change
+ * \f$\dot{\boldsymbol{\psi}}_j = \dot{\boldsymbol{x}}_{\lambda(j)} \times
+ * \boldsymbol{S}_j\f$ of the joint twist, its acceleration counterpart
+ * \f$\ddot{\boldsymbol{\psi}}_j\f$ and a bias matrix
+ * \f$\boldsymbol{B}\f$ that maps a change of a body's velocity to the change
+ * of its wrench (dyn2b_nrt_wrench3_dxd()). The inward sweep accumulates the
+ * composite inertia \f$\boldsymbol{I}^C_i\f$, bias matrix
+ * \f$\boldsymbol{B}^C_i\f$ and wrench \f$\boldsymbol{f}^C_i\f$ of each
+ * subtree. For a joint \f$i\f$ in the subtree of joint \f$j\f$ (including
+ * \f$j\f$ itself) the derivatives are
+ *
+ * \f[
+ * \frac{\partial \tau_i}{\partial q_j}
+ * = \boldsymbol{S}_i^T (\boldsymbol{I}^C_i \ddot{\boldsymbol{\psi}}_j
+ *   + \boldsymbol{B}^C_i \dot{\boldsymbol{\psi}}_j), \quad
+ * \frac{\partial \tau_i}{\partial \dot{q}_j}
+ * = \boldsymbol{S}_i^T (\boldsymbol{B}^C_i \boldsymbol{S}_j
+ *   + 2 \boldsymbol{I}^C_i \dot{\boldsymbol{\psi}}_j), \quad
+ * \frac{\partial \tau_i}{\partial \ddot{q}_j}
+ * = \boldsymbol{S}_i^T \boldsymbol{I}^C_i \boldsymbol{S}_j
+ * \f]
+ *
+ * For an ancestor \f$i\f$ of joint \f$j\f$, the roles of \f$i\f$ and
+ * \f$j\f$ in the composite quantities swap and the position derivative
+ * additionally contains the rotation \f$\boldsymbol{S}_j \times
+ * \boldsymbol{f}^C_j\f$ of the subtree's wrench.
+ *
+ * The derivative with respect to the joint accelerations equals the
+ * joint-space inertia matrix (cf. dyn2b_crba()) without the actuator inertia.
+ *
+ * All matrices are stored in column-major order, e.g. the element
+ * \f$\partial \tau_i / \partial q_j\f$ is located at `dtau_dq[nb * j + i]`.
+ *
+ * @param[in] nb Number of bodies.
+ * @param[in] parent Parent of each body (cf. tree.h).
+ *                   Size: \f$[n_b]\f$.
+ * @param[in] jnt Joint type of each joint (cf. tree.h).
+ *                Size: \f$[n_b]\f$.
+ * @param[in] axis Joint axis of each joint (cf. tree.h).
+ *                 Size: \f$[n_b \times 9]\f$.
+ * @param[in] x_tree Constant pose of each joint (cf. tree.h).
+ *                   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * @param[in] rbi Rigid-body inertia of each body (cf. tree.h).
+ *                Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ * @param[in] xdd_base Screw acceleration twist of the base as seen by the base
+ *                     frame (cf. dyn2b_rnea()).
+ *                     Size: \f$[6 \times 1]\f$.
+ * @param[in] q Joint positions.
+ *              Size: \f$[n_b]\f$.
+ * @param[in] qd Joint velocities.
+ *               Size: \f$[n_b]\f$.
+ * @param[in] qdd Joint accelerations.
+ *                Size: \f$[n_b]\f$.
+ * @param[in] f_ext External wrench that acts on each body as seen by the body's
+ *                  frame. May be `NULL` if there are no external wrenches.
+ *                  Size: \f$[6 \times n_b]\f$.
+ * @param[out] tau Joint forces.
+ *                 Size: \f$[n_b]\f$.
+ * @param[out] dtau_dq Derivative of the joint forces with respect to the joint
+ *                     positions.
+ *                     Size: \f$[n_b \times n_b]\f$.
+ * @param[out] dtau_dqd Derivative of the joint forces with respect to the joint
+ *                      velocities.
+ *                      Size: \f$[n_b \times n_b]\f$.
+ * @param[out] dtau_dqdd Derivative of the joint forces with respect to the
+ *                       joint accelerations.
+ *                       Size: \f$[n_b \times n_b]\f$.
+ * @param[in,out] ws Workspace. Its content on entry and exit is unspecified.
+ *                   Size: dyn2b_workspace_size_rnea_drv().
+ */
+void dyn2b_rnea_drv(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict qdd,
+        const double *restrict f_ext,
+        double *restrict tau,
+        double *restrict dtau_dq,
+        double *restrict dtau_dqd,
+        double *restrict dtau_dqdd,
+        double *restrict ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_TREE_H
+#define DYN2B_SOLVERS_TREE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file tree.h
+ *
+ * The solvers operate on a kinematic tree of \f$n_b\f$ bodies where each body
+ * \f$i\f$ is connected to its parent body by one single-DoF joint. The tree is
+ * represented by flat arrays that are indexed by the body (or joint) number:
+ *
+ * - `parent`: The parent body of each body or -1 for the fixed base. The
+ *   bodies must be topologically sorted, i.e. `parent[i] < i`.
+ *   Size: \f$[n_b]\f$.
+ * - `jnt`: The joint type of each joint (cf. `DYN2B_JNT_*`).
+ *   Size: \f$[n_b]\f$.
+ * - `axis`: The joint axis of each joint (cf. dyn2b_to_axis3()). Only the
+ *   entries of `DYN2B_JNT_REV` and `DYN2B_JNT_TRANS` joints are accessed.
+ *   Size: \f$[n_b \times \text{DYN2B\_AXIS3\_SIZE}]\f$.
+ * - `x_tree`: The constant pose \f${}^P\boldsymbol{X}_J\f$ of each joint's
+ *   proximal frame \f$\{J\}\f$ with respect to the parent body's frame
+ *   \f$\{P\}\f$. The joint's distal frame is the body's frame.
+ *   Size: \f$[n_b \times (3 \times 3 + 3 \times 1)]\f$.
+ * - `rbi`: The rigid-body inertia of each body as seen by the body's frame.
+ *   Size: \f$[n_b \times (3 \times 3 + 3 \times 1 + 1)]\f$.
+ *
+ * Joint-space quantities (positions, velocities, accelerations and forces) are
+ * vectors of size \f$n_b\f$.
+ */
+
+
+// Joint types
+#define DYN2B_JNT_REV_X   0
+#define DYN2B_JNT_REV_Y   1
+#define DYN2B_JNT_REV_Z   2
+#define DYN2B_JNT_TRANS_X 3
+#define DYN2B_JNT_TRANS_Y 4
+#define DYN2B_JNT_TRANS_Z 5
+#define DYN2B_JNT_REV     6     // Revolute joint with an arbitrary axis
+#define DYN2B_JNT_TRANS   7     // Prismatic joint with an arbitrary axis
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
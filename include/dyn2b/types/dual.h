@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_TYPES_DUAL_H
+#define DYN2B_TYPES_DUAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// Number of tangent directions that a dual number carries. The library and its
+// users must agree on this value (cf. the DUAL_TANGENTS build option).
+#ifndef DYN2B_DUAL_K
+#  define DYN2B_DUAL_K 4
+#endif
+
+// Dual quantity with m entries (e.g. m = DYN2B_POSE3_SIZE): [v, T]
+// v: m, value in the layout of the underlying type
+// T: m x K, tangents, structure of arrays, i.e. the k-th tangent of the c-th
+//    entry is located at c * DYN2B_DUAL_TAN_LD + k so that all tangents of an
+//    entry are contiguous (cf. the _batch functions)
+#define DYN2B_DUAL_TAN_LD        DYN2B_DUAL_K
+#define DYN2B_DUAL_VAL_OFFSET(m) 0
+#define DYN2B_DUAL_VAL_SIZE(m)   (m)
+#define DYN2B_DUAL_TAN_OFFSET(m) (m)
+#define DYN2B_DUAL_TAN_SIZE(m)   ((m) * DYN2B_DUAL_K)
+#define DYN2B_DUAL_SIZE(m)       (DYN2B_DUAL_VAL_SIZE(m) \
+                                  + DYN2B_DUAL_TAN_SIZE(m))
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -24,6 +24,63 @@ extern "C" {
                                 + DYN2B_ABI3_H_SIZE \
                                 + DYN2B_ABI3_M_SIZE)
 
+// Packed articulated-body inertia: [I, H, M]
+// I: 3x3, symmetric, packed (cf. DYN2B_SYM3_IDX)
+// H: 3x3
+// M: 3x3, symmetric, packed (cf. DYN2B_SYM3_IDX)
+#define DYN2B_ABI3P_I_OFFSET  0
+#define DYN2B_ABI3P_I_SIZE    6
+#define DYN2B_ABI3P_H_LD      3
+#define DYN2B_ABI3P_H_OFFSET  6
+#define DYN2B_ABI3P_H_SIZE    9
+#define DYN2B_ABI3P_M_OFFSET 15
+#define DYN2B_ABI3P_M_SIZE    6
+#define DYN2B_ABI3P_SIZE      (DYN2B_ABI3P_I_SIZE \
+                                + DYN2B_ABI3P_H_SIZE \
+                                + DYN2B_ABI3P_M_SIZE)
+
+// Joint axis: [a, A]
+// a: 3x1, unit vector
+// A: 3x3, outer product a a^T, symmetric, packed (cf. DYN2B_SYM3_IDX)
+#define DYN2B_AXIS3_DIR_OFFSET 0
+#define DYN2B_AXIS3_DIR_SIZE   3
+#define DYN2B_AXIS3_OUT_OFFSET 3
+#define DYN2B_AXIS3_OUT_SIZE   6
+#define DYN2B_AXIS3_SIZE       (DYN2B_AXIS3_DIR_SIZE \
+                                + DYN2B_AXIS3_OUT_SIZE)
+
+// Joints whose motion sub-space is a coordinate axis as an X-macro list
+// X(name, type, k): the name of the joint in the functions (e.g.
+// dyn2b_rev_x_to_pose3), its type (REV or TRANS, cf. DYN2B_JNT_ALIGNED_REV)
+// and the index of the axis (cf. DYN2B_X_OFFSET)
+#define DYN2B_JNT_ALIGNED(X) \
+    X(rev_x,   REV,   0) \
+    X(rev_y,   REV,   1) \
+    X(rev_z,   REV,   2) \
+    X(trans_x, TRANS, 0) \
+    X(trans_y, TRANS, 1) \
+    X(trans_z, TRANS, 2)
+#define DYN2B_JNT_ALIGNED_REV   0
+#define DYN2B_JNT_ALIGNED_TRANS 1
+
+// Joint projection context of a generic joint with dof degrees of freedom:
+// [U, K, F]
+// U: 6xdof, U = I^A S, collection of wrenches (linear-before-angular)
+// K: 6xdof, K = U D^{-1}, collection of wrenches (linear-before-angular)
+// F: dofxdof, LDL^T factorization of D = d + S^T U (cf. dyn2b_ldl_fct_mat)
+#define DYN2B_JPC3_U_LD               6
+#define DYN2B_JPC3_U_OFFSET(dof)      0
+#define DYN2B_JPC3_U_SIZE(dof)        (6 * (dof))
+#define DYN2B_JPC3_K_LD               6
+#define DYN2B_JPC3_K_OFFSET(dof)      (6 * (dof))
+#define DYN2B_JPC3_K_SIZE(dof)        (6 * (dof))
+#define DYN2B_JPC3_FCT_LD(dof)        (dof)
+#define DYN2B_JPC3_FCT_OFFSET(dof)    (12 * (dof))
+#define DYN2B_JPC3_FCT_SIZE(dof)      ((dof) * (dof))
+#define DYN2B_JPC3_SIZE(dof)          (DYN2B_JPC3_U_SIZE(dof) \
+                                        + DYN2B_JPC3_K_SIZE(dof) \
+                                        + DYN2B_JPC3_FCT_SIZE(dof))
+
 
 #ifdef __cplusplus
 }
@@ -9,9 +9,9 @@ extern "C" {
 
 // Twist: angular-before-linear
 #define DYN2B_TWIST3_ANG_OFFSET DYN2B_SCREW3_DIR_OFFSET
-#define DYN2B_TWIST3_ANG_SIZE   DYN3B_SCREW3_DIR_SIZE
+#define DYN2B_TWIST3_ANG_SIZE   DYN2B_SCREW3_DIR_SIZE
 #define DYN2B_TWIST3_LIN_OFFSET DYN2B_SCREW3_MOM_OFFSET
-#define DYN2B_TWIST3_LIN_SIZE   DYN3B_SCREW3_MOM_SIZE
+#define DYN2B_TWIST3_LIN_SIZE   DYN2B_SCREW3_MOM_SIZE
 #define DYN2B_TWIST3_SIZE       DYN2B_SCREW3_SIZE
 
 // Wrench: linear-before-angular
@@ -36,6 +36,21 @@ extern "C" {
                               + DYN2B_RBI3_H_SIZE \
                               + DYN2B_RBI3_M_SIZE)
 
+// Packed rigid-body inertia: [I, h, m]
+// I: 3x3, symmetric, packed (cf. DYN2B_SYM3_IDX), i.e.
+//    [Ixx, Ixy, Iyy, Ixz, Iyz, Izz]
+// h: 3x1
+// m: 1
+#define DYN2B_RBI3P_I_OFFSET 0
+#define DYN2B_RBI3P_I_SIZE   6
+#define DYN2B_RBI3P_H_OFFSET 6
+#define DYN2B_RBI3P_H_SIZE   3
+#define DYN2B_RBI3P_M_OFFSET 9
+#define DYN2B_RBI3P_M_SIZE   1
+#define DYN2B_RBI3P_SIZE     (DYN2B_RBI3P_I_SIZE \
+                              + DYN2B_RBI3P_H_SIZE \
+                              + DYN2B_RBI3P_M_SIZE)
+
 
 #ifdef __cplusplus
 }
@@ -15,6 +15,15 @@ extern "C" {
 #define DYN2B_POSE3_LIN_SIZE    3
 #define DYN2B_POSE3_SIZE        (DYN2B_POSE3_ANG_SIZE + DYN2B_POSE3_LIN_SIZE)
 
+// Quaternion pose: angular-before-linear, the unit quaternion stored
+// vector-before-scalar (x, y, z, w)
+#define DYN2B_POSE3Q_ANG_OFFSET 0
+#define DYN2B_POSE3Q_ANG_SIZE   4
+#define DYN2B_POSE3Q_ANG_W      3
+#define DYN2B_POSE3Q_LIN_OFFSET 4
+#define DYN2B_POSE3Q_LIN_SIZE   3
+#define DYN2B_POSE3Q_SIZE       (DYN2B_POSE3Q_ANG_SIZE + DYN2B_POSE3Q_LIN_SIZE)
+
 // Screw: moment-before-direction
 #define DYN2B_SCREW3_DIR_OFFSET 0
 #define DYN2B_SCREW3_DIR_SIZE   3
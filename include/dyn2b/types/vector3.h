@@ -11,6 +11,14 @@ extern "C" {
 #define DYN2B_Y_OFFSET 1
 #define DYN2B_Z_OFFSET 2
 
+// Packed, symmetric 3x3 matrix: upper triangle in column-major order, i.e.
+// [a00, a01, a11, a02, a12, a22]
+#define DYN2B_SYM3_SIZE 6
+// Index of the entry in row r and column c (either triangle)
+#define DYN2B_SYM3_IDX(r, c) (((r) <= (c)) \
+                              ? ((((c) * ((c) + 1)) / 2) + (r)) \
+                              : ((((r) * ((r) + 1)) / 2) + (c)))
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,38 @@
+# Generate the single-precision version of a source or header file (cf.
+# ENABLE_FLOAT). The double-precision sources are the only ones to maintain:
+# - double becomes float and the floating-point literals become float literals
+# - every identifier dyn2b_<name> becomes dyn2b_<name>f, including the internal
+#   kernels, the solvers' dispatch table and the references in the
+#   documentation
+# - the headers dyn2b/functions/<name>.h, dyn2b/solvers/<name>.h,
+#   dyn2b/inline/<name>.h and the private headers "<name>.h" become <name>f.h
+#   (with their own include guards). The headers that only define layouts,
+#   constants and macros (dyn2b/types/*.h, dyn2b/solvers/tree.h and
+#   dyn2b/inline/api.h) are shared.
+# - the (C)BLAS/LAPACK(E) routines and libm functions switch to their
+#   single-precision counterparts and so do the <float.h> limits (DBL_*)
+#
+# Usage: cmake -DIN=<file> -DOUT=<file> -P float.cmake
+
+if(NOT IN OR NOT OUT)
+  message(FATAL_ERROR "Usage: cmake -DIN=<file> -DOUT=<file> -P float.cmake")
+endif()
+
+file(READ "${IN}" code)
+
+string(REPLACE "double" "float" code "${code}")
+string(REGEX REPLACE "([^a-zA-Z0-9_.])([0-9]+\\.[0-9]+([eE][-+]?[0-9]+)?)" "\\1\\2f" code "${code}")
+string(REPLACE "LGPL-3.0f" "LGPL-3.0" code "${code}")
+string(REGEX REPLACE "dyn2b_([a-z0-9_#]*[a-z0-9])" "dyn2b_\\1f" code "${code}")
+string(REGEX REPLACE "dyn2b/(functions|solvers|inline)/([a-z0-9_]+)\\.h" "dyn2b/\\1/\\2f.h" code "${code}")
+string(REPLACE "dyn2b/solvers/treef.h" "dyn2b/solvers/tree.h" code "${code}")
+string(REPLACE "dyn2b/inline/apif.h" "dyn2b/inline/api.h" code "${code}")
+string(REGEX REPLACE "#include \"([a-z0-9_]+)\\.h\"" "#include \"\\1f.h\"" code "${code}")
+string(REGEX REPLACE "@file ([a-z0-9_]+)\\.h" "@file \\1f.h" code "${code}")
+string(REGEX REPLACE "(DYN2B_(FUNCTIONS|SOLVERS|INLINE|SRC)_[A-Z0-9_]+)_H" "\\1F_H" code "${code}")
+string(REPLACE "cblas_d" "cblas_s" code "${code}")
+string(REPLACE "LAPACKE_d" "LAPACKE_s" code "${code}")
+string(REPLACE "DBL_" "FLT_" code "${code}")
+string(REGEX REPLACE "([^a-zA-Z0-9_])(cos|sin|sqrt|fabs|rint)\\(" "\\1\\2f(" code "${code}")
+
+file(WRITE "${OUT}" "${code}")
@@ -1,329 +1,572 @@
 // SPDX-License-Identifier: LGPL-3.0
 #include <dyn2b/functions/joint.h>
+#include <dyn2b/inline/joint.h>
+#include <dyn2b/functions/matrix.h>
 #include <dyn2b/functions/vector3.h>
 #include <dyn2b/functions/mechanics.h>
+#include <dyn2b/functions/screw.h>
 #include <dyn2b/types/vector3.h>
 #include <dyn2b/types/screw.h>
 #include <dyn2b/types/mechanics.h>
 #include <dyn2b/types/joint.h>
+#include <dyn2b/types/dual.h>
 #include <math.h>
 #include <string.h>
 #include <assert.h>
 #include <cblas.h>
 #include <lapacke.h>
 
+#include "kernel.h"
+
 
 //
 // Operations on joints
 //
 
 
-void dyn2b_rev_x_to_pose3(
-        const double *restrict jnt,
-        double *restrict cart)
+void dyn2b_to_abi3(
+        const double *restrict in,
+        double *restrict out)
 {
-    assert(jnt);
-    assert(cart);
+    assert(in);
+    assert(out);
 
-    double cq = cos(*jnt);
-    double sq = sin(*jnt);
+    memcpy(&out[DYN2B_ABI3_I_OFFSET], &in[DYN2B_RBI3_I_OFFSET],
+            DYN2B_ABI3_I_SIZE * sizeof(double));
 
-    // Column-major layout
-    cart[0] = 1.0; cart[ 1] = 0.0; cart[ 2] = 0.0;
-    cart[3] = 0.0; cart[ 4] =  cq; cart[ 5] =  sq;
-    cart[6] = 0.0; cart[ 7] = -sq; cart[ 8] =  cq;
-    cart[9] = 0.0; cart[10] = 0.0; cart[11] = 0.0;
+    dyn2b_skw_vec3(&in[DYN2B_RBI3_H_OFFSET], &out[DYN2B_ABI3_H_OFFSET]);
+
+    const int MA = DYN2B_ABI3_M_OFFSET;
+    const int MR = DYN2B_RBI3_M_OFFSET;
+    out[MA + 0] = in[MR]; out[MA + 1] =   0.0 ; out[MA + 2] =   0.0 ;
+    out[MA + 3] =   0.0 ; out[MA + 4] = in[MR]; out[MA + 5] =   0.0 ;
+    out[MA + 6] =   0.0 ; out[MA + 7] =   0.0 ; out[MA + 8] = in[MR];
 }
 
 
-void dyn2b_rev_y_to_pose3(
-        const double *restrict jnt,
-        double *restrict cart)
+void dyn2b_tf_prox_abi3(
+        const double *restrict tf,
+        const double *restrict in,
+        double *restrict out)
 {
-    assert(jnt);
-    assert(cart);
+    assert(tf);
+    assert(in);
+    assert(out);
 
-    double cq = cos(*jnt);
-    double sq = sin(*jnt);
+    // This is the same as [Featherstone2008]'s formula X^T I^A X ...
+    // ... just with R = E^T
 
-    // Column-major layout
-    cart[0] =  cq; cart[ 1] = 0.0; cart[ 2] = -sq;
-    cart[3] = 0.0; cart[ 4] = 1.0; cart[ 5] = 0.0;
-    cart[6] =  sq; cart[ 7] = 0.0; cart[ 8] =  cq;
-    cart[9] = 0.0; cart[10] = 0.0; cart[11] = 0.0;
-}
+    // M' = R M R^T
+    //
+    double mrt[DYN2B_ABI3_M_SIZE];
 
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+            1.0, &in[DYN2B_ABI3_M_OFFSET],
+            &tf[DYN2B_POSE3_ANG_OFFSET],
+            0.0, mrt);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            1.0, &tf[DYN2B_POSE3_ANG_OFFSET],
+            mrt,
+            0.0, &out[DYN2B_ABI3_M_OFFSET]);
 
-void dyn2b_rev_z_to_pose3(
-        const double *restrict jnt,
-        double *restrict cart)
-{
-    assert(jnt);
-    assert(cart);
 
-    double cq = cos(*jnt);
-    double sq = sin(*jnt);
+    // H'' = H' + rxM'
+    // H'  = R H R^T
+    //
+    double hrt[DYN2B_ABI3_H_SIZE];
+    double rhrt[DYN2B_ABI3_H_SIZE];
 
-    // Column-major layout
-    cart[0] =  cq; cart[ 1] =  sq; cart[ 2] = 0.0;
-    cart[3] = -sq; cart[ 4] =  cq; cart[ 5] = 0.0;
-    cart[6] = 0.0; cart[ 7] = 0.0; cart[ 8] = 1.0;
-    cart[9] = 0.0; cart[10] = 0.0; cart[11] = 0.0;
-}
+    // R H R^T
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+            1.0, &in[DYN2B_ABI3_H_OFFSET],
+            &tf[DYN2B_POSE3_ANG_OFFSET],
+            0.0, hrt);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            1.0, &tf[DYN2B_POSE3_ANG_OFFSET],
+            hrt,
+            0.0, rhrt);
 
+    // + rxM'
+    dyn2b_cad_vec3(3,
+            rhrt, DYN2B_ABI3_H_LD,
+            &tf[DYN2B_POSE3_LIN_OFFSET], 0,
+            &out[DYN2B_ABI3_M_OFFSET], DYN2B_ABI3_M_LD,
+            &out[DYN2B_ABI3_H_OFFSET], DYN2B_ABI3_H_LD);
 
-void dyn2b_trans_x_to_pose3(
-        const double *restrict jnt,
-        double *restrict cart)
-{
-    assert(jnt);
-    assert(cart);
 
-    // Column-major layout
-    cart[0] =  1.0; cart[ 1] = 0.0; cart[ 2] = 0.0;
-    cart[3] =  0.0; cart[ 4] = 1.0; cart[ 5] = 0.0;
-    cart[6] =  0.0; cart[ 7] = 0.0; cart[ 8] = 1.0;
-    cart[9] = *jnt; cart[10] = 0.0; cart[11] = 0.0;
-}
+    // I' = R I R^T + rx(H'^T)      - (H' + rxM')rx
+    //    = R I R^T + rx(R H R^T)^T - H''rx
+    //
+    double irt[DYN2B_ABI3_I_SIZE];
+    double rx[9];
 
+    // R I R^T ...
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+            1.0, &in[DYN2B_ABI3_I_OFFSET],
+            &tf[DYN2B_POSE3_ANG_OFFSET],
+            0.0, irt);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            1.0, &tf[DYN2B_POSE3_ANG_OFFSET],
+            irt,
+            0.0, &out[DYN2B_ABI3_I_OFFSET]);
 
-void dyn2b_trans_y_to_pose3(
-        const double *restrict jnt,
-        double *restrict cart)
-{
-    assert(jnt);
-    assert(cart);
+    // ... + rx(R H R^T)^T ...
+    dyn2b_skw_vec3(&tf[DYN2B_POSE3_LIN_OFFSET], rx);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+            1.0, rx,
+            rhrt,
+            1.0, &out[DYN2B_ABI3_I_OFFSET]);
 
-    // Column-major layout
-    cart[0] = 1.0; cart[ 1] =  0.0; cart[ 2] = 0.0;
-    cart[3] = 0.0; cart[ 4] =  1.0; cart[ 5] = 0.0;
-    cart[6] = 0.0; cart[ 7] =  0.0; cart[ 8] = 1.0;
-    cart[9] = 0.0; cart[10] = *jnt; cart[11] = 0.0;
+    // ... - H''rx
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            -1.0, &out[DYN2B_ABI3_H_OFFSET],
+            rx,
+            1.0, &out[DYN2B_ABI3_I_OFFSET]);
 }
 
 
-void dyn2b_trans_z_to_pose3(
-        const double *restrict jnt,
-        double *restrict cart)
+void dyn2b_tf_prox_abi3q(
+        const double *restrict x,
+        const double *restrict abi_dist,
+        double *restrict abi_prox)
 {
-    assert(jnt);
-    assert(cart);
+    assert(x);
+    assert(abi_dist);
+    assert(abi_prox);
 
-    // Column-major layout
-    cart[0] = 1.0; cart[ 1] = 0.0; cart[ 2] =  0.0;
-    cart[3] = 0.0; cart[ 4] = 1.0; cart[ 5] =  0.0;
-    cart[6] = 0.0; cart[ 7] = 0.0; cart[ 8] =  1.0;
-    cart[9] = 0.0; cart[10] = 0.0; cart[11] = *jnt;
+    double x_mat[DYN2B_POSE3_SIZE];
+    dyn2b_to_mat_pose3q(x, x_mat);
+    dyn2b_tf_prox_abi3(x_mat, abi_dist, abi_prox);
 }
 
 
-void dyn2b_rev_x_to_twist3(
-        const double *restrict jnt,
-        double *restrict cart)
+void dyn2b_tf_prox_abi3_batch(
+        int n,
+        int ld,
+        const double *restrict tf,
+        const double *restrict in,
+        double *restrict out)
 {
-    assert(jnt);
-    assert(cart);
+    assert(n >= 0);
+    assert(ld >= n);
+    assert(tf);
+    assert(in);
+    assert(out);
 
-    // Angular-before-linear order
-    cart[0] = *jnt; cart[1] =  0.0; cart[2] = 0.0;
-    cart[3] =  0.0; cart[4] =  0.0; cart[5] = 0.0;
+    DYN2B_KRN_INDEPENDENT
+    for (int i = 0; i < n; i++) {
+        const double *restrict r = &tf[(DYN2B_POSE3_ANG_OFFSET * ld) + i];
+        const double *restrict p = &tf[(DYN2B_POSE3_LIN_OFFSET * ld) + i];
+        const double *restrict i_in = &in[(DYN2B_ABI3_I_OFFSET * ld) + i];
+        const double *restrict h_in = &in[(DYN2B_ABI3_H_OFFSET * ld) + i];
+        const double *restrict m_in = &in[(DYN2B_ABI3_M_OFFSET * ld) + i];
+        double *restrict i_out = &out[(DYN2B_ABI3_I_OFFSET * ld) + i];
+        double *restrict h_out = &out[(DYN2B_ABI3_H_OFFSET * ld) + i];
+        double *restrict m_out = &out[(DYN2B_ABI3_M_OFFSET * ld) + i];
+
+        // M' = R M R^T
+        double mrt[DYN2B_ABI3_M_SIZE];
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+                1.0, m_in, ld,
+                r, ld,
+                0.0, mrt, 1);
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+                1.0, r, ld,
+                mrt, 1,
+                0.0, m_out, ld);
+
+        // H'' = R H R^T + rxM'
+        double hrt[DYN2B_ABI3_H_SIZE];
+        double rhrt[DYN2B_ABI3_H_SIZE];
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+                1.0, h_in, ld,
+                r, ld,
+                0.0, hrt, 1);
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+                1.0, r, ld,
+                hrt, 1,
+                0.0, rhrt, 1);
+        dyn2b_krn_cad3_strided(&rhrt[0], 1, p, ld,
+                &m_out[0 * ld], ld, &h_out[0 * ld], ld);
+        dyn2b_krn_cad3_strided(&rhrt[3], 1, p, ld,
+                &m_out[3 * ld], ld, &h_out[3 * ld], ld);
+        dyn2b_krn_cad3_strided(&rhrt[6], 1, p, ld,
+                &m_out[6 * ld], ld, &h_out[6 * ld], ld);
+
+        // I' = R I R^T + rx(R H R^T)^T - H''rx
+        double irt[DYN2B_ABI3_I_SIZE];
+        double rx[9] = {
+             0.0     ,  p[2 * ld], -p[1 * ld],
+            -p[2 * ld],  0.0     ,  p[0 * ld],
+             p[1 * ld], -p[0 * ld],  0.0
+        };
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+                1.0, i_in, ld,
+                r, ld,
+                0.0, irt, 1);
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+                1.0, r, ld,
+                irt, 1,
+                0.0, i_out, ld);
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+                1.0, rx, 1,
+                rhrt, 1,
+                1.0, i_out, ld);
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+                -1.0, h_out, ld,
+                rx, 1,
+                1.0, i_out, ld);
+    }
 }
 
 
-void dyn2b_rev_y_to_twist3(
-        const double *restrict jnt,
-        double *restrict cart)
+void dyn2b_abi_to_wrench3(
+        int n,
+        const double *restrict abi,
+        const double *restrict xdd,
+        double *restrict w)
 {
-    assert(jnt);
-    assert(cart);
+    assert(n >= 0);
+    assert(abi);
+    assert(xdd);
+    assert(w);
 
-    // Angular-before-linear order
-    cart[0] =  0.0; cart[1] = *jnt; cart[2] = 0.0;
-    cart[3] =  0.0; cart[4] =  0.0; cart[5] = 0.0;
+    // n = I w + H v
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &abi[DYN2B_ABI3_I_OFFSET],
+            &xdd[DYN2B_TWIST3_ANG_OFFSET], DYN2B_TWIST3_SIZE,
+            0.0, &w[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_WRENCH3_SIZE);
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &abi[DYN2B_ABI3_H_OFFSET],
+            &xdd[DYN2B_TWIST3_LIN_OFFSET], DYN2B_TWIST3_SIZE,
+            1.0, &w[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_WRENCH3_SIZE);
+
+    // f = M v + H^T w
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &abi[DYN2B_ABI3_M_OFFSET],
+            &xdd[DYN2B_TWIST3_LIN_OFFSET], DYN2B_TWIST3_SIZE,
+            0.0, &w[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_WRENCH3_SIZE);
+    dyn2b_krn_gemm3n(DYN2B_KRN_TRANS, n,
+            1.0, &abi[DYN2B_ABI3_H_OFFSET],
+            &xdd[DYN2B_TWIST3_ANG_OFFSET], DYN2B_TWIST3_SIZE,
+            1.0, &w[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_WRENCH3_SIZE);
 }
 
 
-void dyn2b_rev_z_to_twist3(
-        const double *restrict jnt,
-        double *restrict cart)
-{
-    assert(jnt);
-    assert(cart);
+//
+// Joints whose motion sub-space S = e_k is a coordinate axis (cf.
+// DYN2B_JNT_ALIGNED). The kernels below take the joint type and k as
+// arguments. The generators call them with literals so that, after inlining,
+// each joint's functions only load the entries that S selects and only contain
+// the non-zero arithmetic.
+//
 
-    // Angular-before-linear order
-    cart[0] =  0.0; cart[1] =  0.0; cart[2] = *jnt;
-    cart[3] =  0.0; cart[4] =  0.0; cart[5] =  0.0;
+
+// U = M S, i.e. the k-th (revolute) or (3 + k)-th (prismatic) column of
+// [I H; H^T M]
+static inline void aligned_u(
+        int type,
+        int k,
+        const double *restrict m,
+        double *restrict u_ang,
+        double *restrict u_lin)
+{
+    DYN2B_KRN_UNROLL
+    for (int i = 0; i < 3; i++) {
+        if (type == DYN2B_JNT_ALIGNED_REV) {
+            u_ang[i] = m[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * k) + i];
+            u_lin[i] = m[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * i) + k];
+        } else {
+            u_ang[i] = m[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + i];
+            u_lin[i] = m[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * k) + i];
+        }
+    }
 }
 
 
-void dyn2b_trans_x_to_twist3(
-        const double *restrict jnt,
-        double *restrict cart)
+// U = M S of a packed ABI (cf. aligned_u())
+static inline void aligned_u_p(
+        int type,
+        int k,
+        const double *restrict m,
+        double *restrict u_ang,
+        double *restrict u_lin)
 {
-    assert(jnt);
-    assert(cart);
-
-    // Angular-before-linear order
-    cart[0] =  0.0; cart[1] = 0.0; cart[2] = 0.0;
-    cart[3] = *jnt; cart[4] = 0.0; cart[5] = 0.0;
+    DYN2B_KRN_UNROLL
+    for (int i = 0; i < 3; i++) {
+        if (type == DYN2B_JNT_ALIGNED_REV) {
+            u_ang[i] = m[DYN2B_ABI3P_I_OFFSET + DYN2B_SYM3_IDX(i, k)];
+            u_lin[i] = m[DYN2B_ABI3P_H_OFFSET + (DYN2B_ABI3P_H_LD * i) + k];
+        } else {
+            u_ang[i] = m[DYN2B_ABI3P_H_OFFSET + (DYN2B_ABI3P_H_LD * k) + i];
+            u_lin[i] = m[DYN2B_ABI3P_M_OFFSET + DYN2B_SYM3_IDX(i, k)];
+        }
+    }
 }
 
 
-void dyn2b_trans_y_to_twist3(
-        const double *restrict jnt,
-        double *restrict cart)
+// D = d + S^T U
+static inline double aligned_dstms(
+        int type,
+        int k,
+        const double *restrict d,
+        const double *restrict u_ang,
+        const double *restrict u_lin)
 {
-    assert(jnt);
-    assert(cart);
-
-    // Angular-before-linear order
-    cart[0] = 0.0; cart[1] =  0.0; cart[2] = 0.0;
-    cart[3] = 0.0; cart[4] = *jnt; cart[5] = 0.0;
+    return *d + ((type == DYN2B_JNT_ALIGNED_REV) ? u_ang[k] : u_lin[k]);
 }
 
 
-void dyn2b_trans_z_to_twist3(
-        const double *restrict jnt,
-        double *restrict cart)
+// Projection of an ABI over a joint whose motion sub-space is a unit vector.
+// u_ang and u_lin are the angular and linear part of U = M S, D = d + S^T U.
+static inline void axis_proj_abi3(
+        double dstms,
+        const double *restrict u_ang,
+        const double *restrict u_lin,
+        const double *restrict m_in,
+        double *restrict m_out)
 {
-    assert(jnt);
-    assert(cart);
+    double ud_ang[3] = {
+        u_ang[0] / dstms, u_ang[1] / dstms, u_ang[2] / dstms
+    };
+    double ud_lin[3] = {
+        u_lin[0] / dstms, u_lin[1] / dstms, u_lin[2] / dstms
+    };
+
+    DYN2B_KRN_UNROLL
+    for (int c = 0; c < 3; c++) {
+        DYN2B_KRN_UNROLL
+        for (int r = 0; r < 3; r++) {
+            // I - U_n D^{-1} U_n^T
+            m_out[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
+                    = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
+                    - ud_ang[r] * u_ang[c];
 
-    // Angular-before-linear order
-    cart[0] = 0.0; cart[1] = 0.0; cart[2] =  0.0;
-    cart[3] = 0.0; cart[4] = 0.0; cart[5] = *jnt;
+            // H - U_n D^{-1} U_f^T
+            m_out[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
+                    = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
+                    - ud_ang[r] * u_lin[c];
+
+            // M - U_f D^{-1} U_f^T
+            m_out[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
+                    = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
+                    - ud_lin[r] * u_lin[c];
+        }
+    }
 }
 
 
-void dyn2b_rev_x_from_wrench3(
-        int n,
-        const double *restrict cart,
-        double *restrict jnt)
+// Projection of a packed ABI over a joint whose motion sub-space is a unit
+// vector (cf. axis_proj_abi3()). Only the upper triangles of I and M.
+static inline void axis_proj_abi3p(
+        double dstms,
+        const double *restrict u_ang,
+        const double *restrict u_lin,
+        const double *restrict m_in,
+        double *restrict m_out)
 {
-    assert(n >= 0);
-    assert(jnt);
-    assert(cart);
+    double ud_ang[3] = {
+        u_ang[0] / dstms, u_ang[1] / dstms, u_ang[2] / dstms
+    };
+    double ud_lin[3] = {
+        u_lin[0] / dstms, u_lin[1] / dstms, u_lin[2] / dstms
+    };
+
+    DYN2B_KRN_UNROLL
+    for (int c = 0; c < 3; c++) {
+        DYN2B_KRN_UNROLL
+        for (int r = 0; r < 3; r++) {
+            // H - U_n D^{-1} U_f^T
+            m_out[DYN2B_ABI3P_H_OFFSET + (DYN2B_ABI3P_H_LD * c) + r]
+                    = m_in[DYN2B_ABI3P_H_OFFSET + (DYN2B_ABI3P_H_LD * c) + r]
+                    - ud_ang[r] * u_lin[c];
 
-    for (int i = 0; i < n; i++) {
-        // Linear-before-angular order
-        int idx = (i * DYN2B_SCREW3_SIZE)
-                  + DYN2B_WRENCH3_ANG_OFFSET + DYN2B_X_OFFSET;
-        jnt[i] = cart[idx];
+            if (r > c) {
+                continue;
+            }
+
+            // I - U_n D^{-1} U_n^T
+            m_out[DYN2B_ABI3P_I_OFFSET + DYN2B_SYM3_IDX(r, c)]
+                    = m_in[DYN2B_ABI3P_I_OFFSET + DYN2B_SYM3_IDX(r, c)]
+                    - ud_ang[r] * u_ang[c];
+
+            // M - U_f D^{-1} U_f^T
+            m_out[DYN2B_ABI3P_M_OFFSET + DYN2B_SYM3_IDX(r, c)]
+                    = m_in[DYN2B_ABI3P_M_OFFSET + DYN2B_SYM3_IDX(r, c)]
+                    - ud_lin[r] * u_lin[c];
+        }
     }
 }
 
 
-void dyn2b_rev_y_from_wrench3(
+// Projection of wrenches over an axis-aligned joint: f - U D^{-1} S^T f
+static inline void aligned_proj_wrench3(
         int n,
-        const double *restrict cart,
-        double *restrict jnt)
+        int type,
+        int k,
+        double dstms,
+        const double *restrict u_ang,
+        const double *restrict u_lin,
+        const double *restrict f_in,
+        double *restrict f_out)
 {
-    assert(n >= 0);
-    assert(jnt);
-    assert(cart);
-
-    for (int i = 0; i < n; i++) {
-        // Linear-before-angular order
-        int idx = (i * DYN2B_SCREW3_SIZE)
-                  + DYN2B_WRENCH3_ANG_OFFSET + DYN2B_Y_OFFSET;
-        jnt[i] = cart[idx];
+    const int off = (type == DYN2B_JNT_ALIGNED_REV)
+                    ? DYN2B_WRENCH3_ANG_OFFSET : DYN2B_WRENCH3_LIN_OFFSET;
+    const double d_inv = 1.0 / dstms;
+
+    for (int j = 0; j < n; j++) {
+        const double *f = &f_in[j * DYN2B_WRENCH3_SIZE];
+        double *g = &f_out[j * DYN2B_WRENCH3_SIZE];
+        double f_k = f[off + k] * d_inv;
+
+        DYN2B_KRN_UNROLL
+        for (int i = 0; i < 3; i++) {
+            g[DYN2B_WRENCH3_ANG_OFFSET + i]
+                    = f[DYN2B_WRENCH3_ANG_OFFSET + i] - f_k * u_ang[i];
+            g[DYN2B_WRENCH3_LIN_OFFSET + i]
+                    = f[DYN2B_WRENCH3_LIN_OFFSET + i] - f_k * u_lin[i];
+        }
     }
 }
 
 
-void dyn2b_rev_z_from_wrench3(
-        int n,
-        const double *restrict cart,
-        double *restrict jnt)
+#define DYN2B_JNT_ALIGNED_PROJ(name, type, k) \
+    void dyn2b_##name##_proj_abi3( \
+            const double *restrict d, \
+            const double *restrict m_in, \
+            double *restrict m_out) \
+    { \
+        assert(d); \
+        assert(m_in); \
+        assert(m_out); \
+        \
+        double u_ang[3]; \
+        double u_lin[3]; \
+        aligned_u(DYN2B_JNT_ALIGNED_##type, k, m_in, u_ang, u_lin); \
+        axis_proj_abi3( \
+                aligned_dstms(DYN2B_JNT_ALIGNED_##type, k, d, u_ang, u_lin), \
+                u_ang, u_lin, m_in, m_out); \
+    } \
+    \
+    \
+    void dyn2b_##name##_proj_wrench3( \
+            int n, \
+            const double *restrict d, \
+            const double *restrict m, \
+            const double *restrict f_in, \
+            double *restrict f_out) \
+    { \
+        assert(n >= 0); \
+        assert(d); \
+        assert(m); \
+        assert(f_in); \
+        assert(f_out); \
+        \
+        double u_ang[3]; \
+        double u_lin[3]; \
+        aligned_u(DYN2B_JNT_ALIGNED_##type, k, m, u_ang, u_lin); \
+        aligned_proj_wrench3(n, DYN2B_JNT_ALIGNED_##type, k, \
+                aligned_dstms(DYN2B_JNT_ALIGNED_##type, k, d, u_ang, u_lin), \
+                u_ang, u_lin, f_in, f_out); \
+    }
+
+DYN2B_JNT_ALIGNED(DYN2B_JNT_ALIGNED_PROJ)
+
+
+void dyn2b_to_mat_abi3(
+        const double *restrict tup,
+        double *restrict mat)
 {
-    assert(n >= 0);
-    assert(jnt);
-    assert(cart);
+    assert(tup);
+    assert(mat);
 
-    for (int i = 0; i < n; i++) {
-        // Linear-before-angular order
-        int idx = (i * DYN2B_SCREW3_SIZE)
-                  + DYN2B_WRENCH3_ANG_OFFSET + DYN2B_Z_OFFSET;
-        jnt[i] = cart[idx];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            int ii  =  0 + (i * DYN2B_SCREW3_SIZE) + j;
+            int iht =  3 + (i * DYN2B_SCREW3_SIZE) + j;
+            int ih  = 18 + (i * DYN2B_SCREW3_SIZE) + j;
+            int im  = 21 + (i * DYN2B_SCREW3_SIZE) + j;
+            mat[ii ] = tup[DYN2B_ABI3_I_OFFSET + (i * DYN2B_ABI3_I_LD) + j];
+            mat[iht] = tup[DYN2B_ABI3_H_OFFSET + (j * DYN2B_ABI3_H_LD) + i];
+            mat[ih ] = tup[DYN2B_ABI3_H_OFFSET + (i * DYN2B_ABI3_H_LD) + j];
+            mat[im ] = tup[DYN2B_ABI3_M_OFFSET + (i * DYN2B_ABI3_M_LD) + j];
+        }
     }
 }
 
 
-void dyn2b_trans_x_from_wrench3(
-        int n,
-        const double *restrict cart,
-        double *restrict jnt)
+void dyn2b_to_tup_abi3(
+        const double *restrict mat,
+        double *restrict tup)
 {
-    assert(n >= 0);
-    assert(jnt);
-    assert(cart);
+    assert(mat);
+    assert(tup);
 
-    for (int i = 0; i < n; i++) {
-        // Linear-before-angular order
-        int idx = (i * DYN2B_SCREW3_SIZE)
-                  + DYN2B_WRENCH3_LIN_OFFSET + DYN2B_X_OFFSET;
-        jnt[i] = cart[idx];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            int ii = DYN2B_ABI3_I_OFFSET + (i * DYN2B_ABI3_I_LD) + j;
+            int ih = DYN2B_ABI3_H_OFFSET + (i * DYN2B_ABI3_H_LD) + j;
+            int im = DYN2B_ABI3_M_OFFSET + (i * DYN2B_ABI3_M_LD) + j;
+            tup[ii] = mat[ 0 + (i * DYN2B_SCREW3_SIZE) + j];
+            tup[ih] = mat[18 + (i * DYN2B_SCREW3_SIZE) + j];
+            tup[im] = mat[21 + (i * DYN2B_SCREW3_SIZE) + j];
+        }
     }
 }
 
 
-void dyn2b_trans_y_from_wrench3(
-        int n,
-        const double *restrict cart,
-        double *restrict jnt)
+void dyn2b_pck_abi3(
+        const double *restrict in,
+        double *restrict out)
 {
-    assert(n >= 0);
-    assert(jnt);
-    assert(cart);
+    assert(in);
+    assert(out);
 
-    for (int i = 0; i < n; i++) {
-        // Linear-before-angular order
-        int idx = (i * DYN2B_SCREW3_SIZE)
-                  + DYN2B_WRENCH3_LIN_OFFSET + DYN2B_Y_OFFSET;
-        jnt[i] = cart[idx];
-    }
+    dyn2b_krn_pck3p(&in[DYN2B_ABI3_I_OFFSET], &out[DYN2B_ABI3P_I_OFFSET]);
+    memcpy(&out[DYN2B_ABI3P_H_OFFSET], &in[DYN2B_ABI3_H_OFFSET],
+            DYN2B_ABI3_H_SIZE * sizeof(double));
+    dyn2b_krn_pck3p(&in[DYN2B_ABI3_M_OFFSET], &out[DYN2B_ABI3P_M_OFFSET]);
 }
 
 
-void dyn2b_trans_z_from_wrench3(
-        int n,
-        const double *restrict cart,
-        double *restrict jnt)
+void dyn2b_unp_abi3(
+        const double *restrict in,
+        double *restrict out)
 {
-    assert(n >= 0);
-    assert(jnt);
-    assert(cart);
+    assert(in);
+    assert(out);
 
-    for (int i = 0; i < n; i++) {
-        // Linear-before-angular order
-        int idx = (i * DYN2B_SCREW3_SIZE)
-                  + DYN2B_WRENCH3_LIN_OFFSET + DYN2B_Z_OFFSET;
-        jnt[i] = cart[idx];
-    }
+    dyn2b_krn_unp3p(&in[DYN2B_ABI3P_I_OFFSET], &out[DYN2B_ABI3_I_OFFSET]);
+    memcpy(&out[DYN2B_ABI3_H_OFFSET], &in[DYN2B_ABI3P_H_OFFSET],
+            DYN2B_ABI3P_H_SIZE * sizeof(double));
+    dyn2b_krn_unp3p(&in[DYN2B_ABI3P_M_OFFSET], &out[DYN2B_ABI3_M_OFFSET]);
 }
 
 
-void dyn2b_to_abi3(
+void dyn2b_to_abi3p(
         const double *restrict in,
         double *restrict out)
 {
     assert(in);
     assert(out);
 
-    memcpy(&out[DYN2B_ABI3_I_OFFSET], &in[DYN2B_RBI3_I_OFFSET],
-            DYN2B_ABI3_I_SIZE * sizeof(double));
+    memcpy(&out[DYN2B_ABI3P_I_OFFSET], &in[DYN2B_RBI3P_I_OFFSET],
+            DYN2B_ABI3P_I_SIZE * sizeof(double));
 
-    dyn2b_skw_vec3(&in[DYN2B_RBI3_H_OFFSET], &out[DYN2B_ABI3_H_OFFSET]);
+    dyn2b_skw_vec3(&in[DYN2B_RBI3P_H_OFFSET], &out[DYN2B_ABI3P_H_OFFSET]);
 
-    const int MA = DYN2B_ABI3_M_OFFSET;
-    const int MR = DYN2B_RBI3_M_OFFSET;
-    out[MA + 0] = in[MR]; out[MA + 1] =   0.0 ; out[MA + 2] =   0.0 ;
-    out[MA + 3] =   0.0 ; out[MA + 4] = in[MR]; out[MA + 5] =   0.0 ;
-    out[MA + 6] =   0.0 ; out[MA + 7] =   0.0 ; out[MA + 8] = in[MR];
+    const int MA = DYN2B_ABI3P_M_OFFSET;
+    const int MR = DYN2B_RBI3P_M_OFFSET;
+    out[MA + DYN2B_SYM3_IDX(0, 0)] = in[MR];
+    out[MA + DYN2B_SYM3_IDX(0, 1)] = 0.0;
+    out[MA + DYN2B_SYM3_IDX(1, 1)] = in[MR];
+    out[MA + DYN2B_SYM3_IDX(0, 2)] = 0.0;
+    out[MA + DYN2B_SYM3_IDX(1, 2)] = 0.0;
+    out[MA + DYN2B_SYM3_IDX(2, 2)] = in[MR];
 }
 
 
-void dyn2b_tf_prox_abi3(
+void dyn2b_tf_prox_abi3p(
         const double *restrict tf,
         const double *restrict in,
         double *restrict out)
@@ -332,79 +575,52 @@ void dyn2b_tf_prox_abi3(
     assert(in);
     assert(out);
 
-    // This is the same as [Featherstone2008]'s formula X^T I^A X ...
-    // ... just with R = E^T
+    const double *r = &tf[DYN2B_POSE3_ANG_OFFSET];
+    const double *p = &tf[DYN2B_POSE3_LIN_OFFSET];
+    double *i_out = &out[DYN2B_ABI3P_I_OFFSET];
+    double *h_out = &out[DYN2B_ABI3P_H_OFFSET];
+    double *m_out = &out[DYN2B_ABI3P_M_OFFSET];
 
     // M' = R M R^T
-    //
-    double mrt[DYN2B_ABI3_M_SIZE];
-
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, 3, 3, 3,
-            1.0, &in[DYN2B_ABI3_M_OFFSET], DYN2B_ABI3_M_LD,
-            &tf[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            0.0, mrt, DYN2B_ABI3_M_LD);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, 3, 3,
-            1.0, &tf[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            mrt, DYN2B_ABI3_M_LD,
-            0.0, &out[DYN2B_ABI3_M_OFFSET], DYN2B_ABI3_M_LD);
-
-
-    // H'' = H' + rxM'
-    // H'  = R H R^T
-    //
-    double hrt[DYN2B_ABI3_H_SIZE];
-    double rhrt[DYN2B_ABI3_H_SIZE];
-
-    // R H R^T
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, 3, 3, 3,
-            1.0, &in[DYN2B_ABI3_H_OFFSET], DYN2B_ABI3_H_LD,
-            &tf[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            0.0, hrt, DYN2B_ABI3_H_LD);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, 3, 3,
-            1.0, &tf[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            hrt, DYN2B_ABI3_H_LD,
-            0.0, rhrt, DYN2B_ABI3_H_LD);
-
-    // + rxM'
-    dyn2b_cad_vec3(3,
-            rhrt, DYN2B_ABI3_H_LD,
-            &tf[DYN2B_POSE3_LIN_OFFSET], 0,
-            &out[DYN2B_ABI3_M_OFFSET], DYN2B_ABI3_M_LD,
-            &out[DYN2B_ABI3_H_OFFSET], DYN2B_ABI3_H_LD);
-
-
-    // I' = R I R^T + rx(H'^T)      - (H' + rxM')rx
-    //    = R I R^T + rx(R H R^T)^T - H''rx
-    //
-    double irt[DYN2B_ABI3_I_SIZE];
+    dyn2b_krn_rart3p(r, &in[DYN2B_ABI3P_M_OFFSET], m_out);
+
+    // H'' = R H R^T + rxM'
+    double hrt[DYN2B_ABI3P_H_SIZE];
+    double rhrt[DYN2B_ABI3P_H_SIZE];
+    double m_full[DYN2B_ABI3_M_SIZE];
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+            1.0, &in[DYN2B_ABI3P_H_OFFSET],
+            r,
+            0.0, hrt);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            1.0, r,
+            hrt,
+            0.0, rhrt);
+    dyn2b_krn_unp3p(m_out, m_full);
+    dyn2b_krn_cad3_strided(&rhrt[0], 1, p, 1, &m_full[0], 1, &h_out[0], 1);
+    dyn2b_krn_cad3_strided(&rhrt[3], 1, p, 1, &m_full[3], 1, &h_out[3], 1);
+    dyn2b_krn_cad3_strided(&rhrt[6], 1, p, 1, &m_full[6], 1, &h_out[6], 1);
+
+    // I' = R I R^T + rx(R H R^T)^T - H''rx
+    // The last two terms are symmetric, too, so only the upper triangle is
+    // computed
     double rx[9];
-
-    // R I R^T ...
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, 3, 3, 3,
-            1.0, &in[DYN2B_ABI3_I_OFFSET], DYN2B_ABI3_I_LD,
-            &tf[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            0.0, irt, DYN2B_ABI3_I_LD);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, 3, 3,
-            1.0, &tf[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            irt, DYN2B_ABI3_I_LD,
-            0.0, &out[DYN2B_ABI3_I_OFFSET], DYN2B_ABI3_I_LD);
-
-    // ... + rx(R H R^T)^T ...
-    dyn2b_skw_vec3(&tf[DYN2B_POSE3_LIN_OFFSET], rx);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, 3, 3, 3,
-            1.0, rx, 3,
-            rhrt, DYN2B_ABI3_H_LD,
-            1.0, &out[DYN2B_ABI3_I_OFFSET], DYN2B_ABI3_I_LD);
-
-    // ... - H''rx
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, 3, 3,
-            -1.0, &out[DYN2B_ABI3_H_OFFSET], DYN2B_ABI3_H_LD,
-            rx, 3,
-            1.0, &out[DYN2B_ABI3_I_OFFSET], DYN2B_ABI3_I_LD);
+    dyn2b_skw_vec3(p, rx);
+    dyn2b_krn_rart3p(r, &in[DYN2B_ABI3P_I_OFFSET], i_out);
+    for (int c = 0; c < 3; c++) {
+        for (int k = 0; k <= c; k++) {
+            double sum = 0.0;
+            for (int j = 0; j < 3; j++) {
+                sum += rx[(3 * j) + k] * rhrt[(3 * j) + c]
+                       - h_out[(3 * j) + k] * rx[(3 * c) + j];
+            }
+            i_out[DYN2B_SYM3_IDX(k, c)] += sum;
+        }
+    }
 }
 
 
-void dyn2b_abi_to_wrench3(
+void dyn2b_abi_to_wrench3p(
         int n,
         const double *restrict abi,
         const double *restrict xdd,
@@ -415,646 +631,532 @@ void dyn2b_abi_to_wrench3(
     assert(xdd);
     assert(w);
 
+    double i_full[DYN2B_ABI3_I_SIZE];
+    double m_full[DYN2B_ABI3_M_SIZE];
+    dyn2b_krn_unp3p(&abi[DYN2B_ABI3P_I_OFFSET], i_full);
+    dyn2b_krn_unp3p(&abi[DYN2B_ABI3P_M_OFFSET], m_full);
+
     // n = I w + H v
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, n, 3,
-            1.0, &abi[DYN2B_ABI3_I_OFFSET], DYN2B_ABI3_I_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, i_full,
             &xdd[DYN2B_TWIST3_ANG_OFFSET], DYN2B_TWIST3_SIZE,
             0.0, &w[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_WRENCH3_SIZE);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, n, 3,
-            1.0, &abi[DYN2B_ABI3_H_OFFSET], DYN2B_ABI3_H_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &abi[DYN2B_ABI3P_H_OFFSET],
             &xdd[DYN2B_TWIST3_LIN_OFFSET], DYN2B_TWIST3_SIZE,
             1.0, &w[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_WRENCH3_SIZE);
 
     // f = M v + H^T w
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, n, 3,
-            1.0, &abi[DYN2B_ABI3_M_OFFSET], DYN2B_ABI3_M_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, m_full,
             &xdd[DYN2B_TWIST3_LIN_OFFSET], DYN2B_TWIST3_SIZE,
             0.0, &w[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_WRENCH3_SIZE);
-    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, 3, n, 3,
-            1.0, &abi[DYN2B_ABI3_H_OFFSET], DYN2B_ABI3_H_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_TRANS, n,
+            1.0, &abi[DYN2B_ABI3P_H_OFFSET],
             &xdd[DYN2B_TWIST3_ANG_OFFSET], DYN2B_TWIST3_SIZE,
             1.0, &w[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_WRENCH3_SIZE);
 }
 
 
-void dyn2b_rev_x_proj_abi3(
-        const double *restrict d,
-        const double *restrict m_in,
-        double *restrict m_out)
-{
-    assert(d);
-    assert(m_in);
-    assert(m_out);
+#define DYN2B_JNT_ALIGNED_PROJP(name, type, k) \
+    void dyn2b_##name##_proj_abi3p( \
+            const double *restrict d, \
+            const double *restrict m_in, \
+            double *restrict m_out) \
+    { \
+        assert(d); \
+        assert(m_in); \
+        assert(m_out); \
+        \
+        double u_ang[3]; \
+        double u_lin[3]; \
+        aligned_u_p(DYN2B_JNT_ALIGNED_##type, k, m_in, u_ang, u_lin); \
+        axis_proj_abi3p( \
+                aligned_dstms(DYN2B_JNT_ALIGNED_##type, k, d, u_ang, u_lin), \
+                u_ang, u_lin, m_in, m_out); \
+    } \
+    \
+    \
+    void dyn2b_##name##_proj_wrench3p( \
+            int n, \
+            const double *restrict d, \
+            const double *restrict m, \
+            const double *restrict f_in, \
+            double *restrict f_out) \
+    { \
+        assert(n >= 0); \
+        assert(d); \
+        assert(m); \
+        assert(f_in); \
+        assert(f_out); \
+        \
+        double u_ang[3]; \
+        double u_lin[3]; \
+        aligned_u_p(DYN2B_JNT_ALIGNED_##type, k, m, u_ang, u_lin); \
+        aligned_proj_wrench3(n, DYN2B_JNT_ALIGNED_##type, k, \
+                aligned_dstms(DYN2B_JNT_ALIGNED_##type, k, d, u_ang, u_lin), \
+                u_ang, u_lin, f_in, f_out); \
+    }
 
-    const int k = DYN2B_X_OFFSET;
+DYN2B_JNT_ALIGNED(DYN2B_JNT_ALIGNED_PROJP)
 
-    // S^T M S
-    double i_kk = m_in[DYN2B_ABI3_I_OFFSET + (k * DYN2B_ABI3_I_LD) + k];
-    // d + S^T M S
-    double dstms = *d + i_kk;
 
-    for (int c = 0; c < 3; c++) {
-        for (int r = 0; r < 3; r++) {
-            // I - "2nd moment of mass matrix"
-            double i_rc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r];
-            double i_rk = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * k) + r];
-            double i_kc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + k];
-            m_out[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
-                    = i_rc - (i_rk * i_kc) / dstms;
+void dyn2b_to_axis3(
+        const double *restrict dir,
+        double *restrict axis)
+{
+    assert(dir);
+    assert(axis);
 
-            // H - "1st moment of mass matrix"
-            double h_rc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r];
-            double h_kc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + k];
-            double h_rk = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * k) + r];
-            m_out[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
-                    = h_rc - (h_kc * h_rk) / dstms;
+    double nrm = sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+    assert(nrm > 0.0);
 
-            // M - "0th moment of mass matrix"
-            double m_rc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r];
-            double m_kc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + k];
-            double m_kr = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * r) + k];
-            m_out[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
-                    = m_rc - (m_kc * m_kr) / dstms;
+    double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
+    double *aa = &axis[DYN2B_AXIS3_OUT_OFFSET];
+
+    for (int i = 0; i < 3; i++) {
+        a[i] = dir[i] / nrm;
+    }
+
+    for (int c = 0; c < 3; c++) {
+        for (int r = 0; r <= c; r++) {
+            aa[DYN2B_SYM3_IDX(r, c)] = a[r] * a[c];
         }
     }
 }
 
 
-void dyn2b_rev_y_proj_abi3(
-        const double *restrict d,
-        const double *restrict m_in,
-        double *restrict m_out)
+void dyn2b_rev_to_pose3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
 {
-    assert(d);
-    assert(m_in);
-    assert(m_out);
-
-    const int k = DYN2B_Y_OFFSET;
-
-    // S^T M S
-    double i_kk = m_in[DYN2B_ABI3_I_OFFSET + (k * DYN2B_ABI3_I_LD) + k];
-    // d + S^T M S
-    double dstms = *d + i_kk;
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-    for (int c = 0; c < 3; c++) {
-        for (int r = 0; r < 3; r++) {
-            // I - "2nd moment of mass matrix"
-            double i_rc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r];
-            double i_rk = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * k) + r];
-            double i_kc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + k];
-            m_out[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
-                    = i_rc - (i_rk * i_kc) / dstms;
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
+    const double *aa = &axis[DYN2B_AXIS3_OUT_OFFSET];
 
-            // H - "1st moment of mass matrix"
-            double h_rc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r];
-            double h_kc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + k];
-            double h_rk = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * k) + r];
-            m_out[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
-                    = h_rc - (h_kc * h_rk) / dstms;
+    double cq = cos(*jnt);
+    double sq = sin(*jnt);
+    double vq = 1.0 - cq;
+
+    // R = cq 1 + sq [a]x + vq a a^T
+    double a00 = vq * aa[DYN2B_SYM3_IDX(0, 0)] + cq;
+    double a11 = vq * aa[DYN2B_SYM3_IDX(1, 1)] + cq;
+    double a22 = vq * aa[DYN2B_SYM3_IDX(2, 2)] + cq;
+    double a01 = vq * aa[DYN2B_SYM3_IDX(0, 1)];
+    double a02 = vq * aa[DYN2B_SYM3_IDX(0, 2)];
+    double a12 = vq * aa[DYN2B_SYM3_IDX(1, 2)];
+    double s0 = sq * a[0];
+    double s1 = sq * a[1];
+    double s2 = sq * a[2];
 
-            // M - "0th moment of mass matrix"
-            double m_rc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r];
-            double m_kc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + k];
-            double m_kr = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * r) + k];
-            m_out[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
-                    = m_rc - (m_kc * m_kr) / dstms;
-        }
-    }
+    // Column-major layout
+    cart[0] = a00     ; cart[ 1] = a01 + s2; cart[ 2] = a02 - s1;
+    cart[3] = a01 - s2; cart[ 4] = a11     ; cart[ 5] = a12 + s0;
+    cart[6] = a02 + s1; cart[ 7] = a12 - s0; cart[ 8] = a22     ;
+    cart[9] = 0.0     ; cart[10] = 0.0     ; cart[11] = 0.0     ;
 }
 
 
-void dyn2b_rev_z_proj_abi3(
-        const double *restrict d,
-        const double *restrict m_in,
-        double *restrict m_out)
+void dyn2b_trans_to_pose3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
 {
-    assert(d);
-    assert(m_in);
-    assert(m_out);
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-    const int k = DYN2B_Z_OFFSET;
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
 
-    // S^T M S
-    double i_kk = m_in[DYN2B_ABI3_I_OFFSET + (k * DYN2B_ABI3_I_LD) + k];
-    // d + S^T M S
-    double dstms = *d + i_kk;
+    // Column-major layout
+    cart[0] = 1.0         ; cart[ 1] = 0.0         ; cart[ 2] = 0.0         ;
+    cart[3] = 0.0         ; cart[ 4] = 1.0         ; cart[ 5] = 0.0         ;
+    cart[6] = 0.0         ; cart[ 7] = 0.0         ; cart[ 8] = 1.0         ;
+    cart[9] = *jnt * a[0] ; cart[10] = *jnt * a[1] ; cart[11] = *jnt * a[2] ;
+}
 
-    for (int c = 0; c < 3; c++) {
-        for (int r = 0; r < 3; r++) {
-            // I - "2nd moment of mass matrix"
-            double i_rc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r];
-            double i_rk = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * k) + r];
-            double i_kc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + k];
-            m_out[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
-                    = i_rc - (i_rk * i_kc) / dstms;
 
-            // H - "1st moment of mass matrix"
-            double h_rc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r];
-            double h_kc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + k];
-            double h_rk = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * k) + r];
-            m_out[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
-                    = h_rc - (h_kc * h_rk) / dstms;
+void dyn2b_rev_to_twist3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
+{
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-            // M - "0th moment of mass matrix"
-            double m_rc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r];
-            double m_kc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + k];
-            double m_kr = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * r) + k];
-            m_out[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
-                    = m_rc - (m_kc * m_kr) / dstms;
-        }
-    }
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
+
+    // Angular-before-linear order
+    cart[0] = *jnt * a[0]; cart[1] = *jnt * a[1]; cart[2] = *jnt * a[2];
+    cart[3] =     0.0    ; cart[4] =     0.0    ; cart[5] =     0.0    ;
 }
 
 
-void dyn2b_trans_x_proj_abi3(
-        const double *restrict d,
-        const double *restrict m_in,
-        double *restrict m_out)
+void dyn2b_trans_to_twist3(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
 {
-    assert(d);
-    assert(m_in);
-    assert(m_out);
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-    const int k = DYN2B_X_OFFSET;
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
 
-    // S^T M S
-    double m_kk = m_in[DYN2B_ABI3_M_OFFSET + (k * DYN2B_ABI3_M_LD) + k];
-    // d + S^T M S
-    double dstms = *d + m_kk;
+    // Angular-before-linear order
+    cart[0] =     0.0    ; cart[1] =     0.0    ; cart[2] =     0.0    ;
+    cart[3] = *jnt * a[0]; cart[4] = *jnt * a[1]; cart[5] = *jnt * a[2];
+}
 
-    for (int c = 0; c < 3; c++) {
-        for (int r = 0; r < 3; r++) {
-            // I - "2nd moment of mass matrix"
-            double i_rc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r];
-            double i_rk = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + r];
-            double i_ck = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + c];
-            m_out[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
-                    = i_rc - (i_rk * i_ck) / dstms;
 
-            // H - "1st moment of mass matrix"
-            double h_rc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r];
-            double h_rk = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + r];
-            double h_kc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + k];
-            m_out[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
-                    = h_rc - (h_rk * h_kc) / dstms;
+// Tangents of a joint's dual quantity that depends on a single, dual joint
+// coordinate: out = drv dq
+static void jnt_dual_tan(
+        int m,
+        const double *restrict drv,
+        const double *restrict jnt,
+        double *restrict out)
+{
+    const int ld = DYN2B_DUAL_TAN_LD;
+    const double *t_jnt = &jnt[DYN2B_DUAL_TAN_OFFSET(1)];
+    double *t_out = &out[DYN2B_DUAL_TAN_OFFSET(m)];
 
-            // M - "0th moment of mass matrix"
-            double m_rc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r];
-            double m_rk = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * k) + r];
-            double m_kc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + k];
-            m_out[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
-                    = m_rc - (m_rk * m_kc) / dstms;
+    for (int i = 0; i < m; i++) {
+        for (int k = 0; k < DYN2B_DUAL_K; k++) {
+            t_out[(i * ld) + k] = drv[i] * t_jnt[k];
         }
     }
 }
 
 
-void dyn2b_trans_y_proj_abi3(
-        const double *restrict d,
-        const double *restrict m_in,
-        double *restrict m_out)
+void dyn2b_rev_to_pose3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
 {
-    assert(d);
-    assert(m_in);
-    assert(m_out);
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-    const int k = DYN2B_Y_OFFSET;
+    dyn2b_rev_to_pose3(axis, jnt, cart);
+
+    // dR/dq = [a]x R, dr/dq = 0
+    double ax[9];
+    double drv[DYN2B_POSE3_SIZE] = { 0.0 };
+    dyn2b_skw_vec3(&axis[DYN2B_AXIS3_DIR_OFFSET], ax);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            1.0, ax,
+            &cart[DYN2B_POSE3_ANG_OFFSET],
+            0.0, &drv[DYN2B_POSE3_ANG_OFFSET]);
+    jnt_dual_tan(DYN2B_POSE3_SIZE, drv, jnt, cart);
+}
 
-    // S^T M S
-    double m_kk = m_in[DYN2B_ABI3_M_OFFSET + (k * DYN2B_ABI3_M_LD) + k];
-    // d + S^T M S
-    double dstms = *d + m_kk;
 
-    for (int c = 0; c < 3; c++) {
-        for (int r = 0; r < 3; r++) {
-            // I - "2nd moment of mass matrix"
-            double i_rc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r];
-            double i_rk = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + r];
-            double i_ck = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + c];
-            m_out[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
-                    = i_rc - (i_rk * i_ck) / dstms;
+void dyn2b_trans_to_pose3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
+{
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-            // H - "1st moment of mass matrix"
-            double h_rc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r];
-            double h_rk = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + r];
-            double h_kc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + k];
-            m_out[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
-                    = h_rc - (h_rk * h_kc) / dstms;
+    dyn2b_trans_to_pose3(axis, jnt, cart);
 
-            // M - "0th moment of mass matrix"
-            double m_rc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r];
-            double m_rk = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * k) + r];
-            double m_kc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + k];
-            m_out[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
-                    = m_rc - (m_rk * m_kc) / dstms;
-        }
-    }
+    // dR/dq = 0, dr/dq = a
+    double drv[DYN2B_POSE3_SIZE] = { 0.0 };
+    memcpy(&drv[DYN2B_POSE3_LIN_OFFSET], &axis[DYN2B_AXIS3_DIR_OFFSET],
+            DYN2B_POSE3_LIN_SIZE * sizeof(double));
+    jnt_dual_tan(DYN2B_POSE3_SIZE, drv, jnt, cart);
 }
 
 
-void dyn2b_trans_z_proj_abi3(
-        const double *restrict d,
-        const double *restrict m_in,
-        double *restrict m_out)
+void dyn2b_rev_to_twist3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
 {
-    assert(d);
-    assert(m_in);
-    assert(m_out);
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-    const int k = DYN2B_Z_OFFSET;
+    // The twist is linear in the joint coordinate, i.e. its derivative is the
+    // joint's unit twist
+    const double one = 1.0;
+    double drv[DYN2B_TWIST3_SIZE];
+    dyn2b_rev_to_twist3(axis, jnt, cart);
+    dyn2b_rev_to_twist3(axis, &one, drv);
+    jnt_dual_tan(DYN2B_TWIST3_SIZE, drv, jnt, cart);
+}
 
-    // S^T M S
-    double m_kk = m_in[DYN2B_ABI3_M_OFFSET + (k * DYN2B_ABI3_M_LD) + k];
-    // d + S^T M S
-    double dstms = *d + m_kk;
 
-    for (int c = 0; c < 3; c++) {
-        for (int r = 0; r < 3; r++) {
-            // I - "2nd moment of mass matrix"
-            double i_rc = m_in[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r];
-            double i_rk = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + r];
-            double i_ck = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + c];
-            m_out[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * c) + r]
-                    = i_rc - (i_rk * i_ck) / dstms;
+void dyn2b_trans_to_twist3_dual(
+        const double *restrict axis,
+        const double *restrict jnt,
+        double *restrict cart)
+{
+    assert(axis);
+    assert(jnt);
+    assert(cart);
 
-            // H - "1st moment of mass matrix"
-            double h_rc = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r];
-            double h_rk = m_in[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * k) + r];
-            double h_kc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + k];
-            m_out[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * c) + r]
-                    = h_rc - (h_rk * h_kc) / dstms;
+    const double one = 1.0;
+    double drv[DYN2B_TWIST3_SIZE];
+    dyn2b_trans_to_twist3(axis, jnt, cart);
+    dyn2b_trans_to_twist3(axis, &one, drv);
+    jnt_dual_tan(DYN2B_TWIST3_SIZE, drv, jnt, cart);
+}
 
-            // M - "0th moment of mass matrix"
-            double m_rc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r];
-            double m_rk = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * k) + r];
-            double m_kc = m_in[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + k];
-            m_out[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * c) + r]
-                    = m_rc - (m_rk * m_kc) / dstms;
-        }
+
+void dyn2b_rev_from_wrench3(
+        int n,
+        const double *restrict axis,
+        const double *restrict cart,
+        double *restrict jnt)
+{
+    assert(n >= 0);
+    assert(axis);
+    assert(cart);
+    assert(jnt);
+
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
+
+    for (int i = 0; i < n; i++) {
+        const double *f = &cart[(i * DYN2B_WRENCH3_SIZE)
+                                + DYN2B_WRENCH3_ANG_OFFSET];
+        jnt[i] = a[0] * f[0] + a[1] * f[1] + a[2] * f[2];
     }
 }
 
 
-void dyn2b_rev_x_proj_wrench3(
+void dyn2b_trans_from_wrench3(
         int n,
-        const double *restrict d,
-        const double *restrict m,
-        const double *restrict f_in,
-        double *restrict f_out)
+        const double *restrict axis,
+        const double *restrict cart,
+        double *restrict jnt)
 {
     assert(n >= 0);
-    assert(d);
-    assert(m);
-    assert(f_in);
-    assert(f_out);
+    assert(axis);
+    assert(cart);
+    assert(jnt);
 
-    const int JNT_IDX = DYN2B_X_OFFSET;
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
 
-    // | I  H|
-    // |H^T M|
-    //
-    // [ i00,  - ,  - , h00, h01, h02],
-    // [ i10,  - ,  - ,  - ,  - ,  - ],
-    // [ i20,  - ,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ]])
-
-    double i_kk = m[DYN2B_ABI3_I_OFFSET
-                    + (JNT_IDX * DYN2B_ABI3_I_LD) + JNT_IDX];
-    double dstms = *d + i_kk;  // d + S^T M S
-
-    for (int i = 0; i < DYN2B_SCREW3_SIZE / 2; i++) {
-        double i_ik = m[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * JNT_IDX) + i];
-        double h_ki = m[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * i) + JNT_IDX];
-
-        for (int j = 0; j < n; j++) {
-            int idx_k = (j * DYN2B_SCREW3_SIZE)
-                        + (DYN2B_WRENCH3_ANG_OFFSET + JNT_IDX);
-            double f_k = f_in[idx_k];
-
-            int idx_ang_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_ANG_OFFSET + i);
-            f_out[idx_ang_io] = f_in[idx_ang_io] - f_k * i_ik / dstms;
-
-            int idx_lin_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_LIN_OFFSET + i);
-            f_out[idx_lin_io] = f_in[idx_lin_io] - f_k * h_ki / dstms;
-        }
+    for (int i = 0; i < n; i++) {
+        const double *f = &cart[(i * DYN2B_WRENCH3_SIZE)
+                                + DYN2B_WRENCH3_LIN_OFFSET];
+        jnt[i] = a[0] * f[0] + a[1] * f[1] + a[2] * f[2];
     }
 }
 
 
-void dyn2b_rev_y_proj_wrench3(
+// Projection of wrenches over a joint whose motion sub-space is a unit vector.
+// off selects the wrench part that S^T f extracts.
+static void axis_proj_wrench3(
         int n,
-        const double *restrict d,
-        const double *restrict m,
+        int off,
+        const double *restrict a,
+        double dstms,
+        const double *restrict u_ang,
+        const double *restrict u_lin,
         const double *restrict f_in,
         double *restrict f_out)
 {
-    assert(n >= 0);
-    assert(d);
-    assert(m);
-    assert(f_in);
-    assert(f_out);
+    for (int j = 0; j < n; j++) {
+        const double *f = &f_in[j * DYN2B_WRENCH3_SIZE];
+        double *g = &f_out[j * DYN2B_WRENCH3_SIZE];
+        double f_k = (a[0] * f[off + 0] + a[1] * f[off + 1]
+                      + a[2] * f[off + 2]) / dstms;
+
+        for (int i = 0; i < 3; i++) {
+            g[DYN2B_WRENCH3_ANG_OFFSET + i]
+                    = f[DYN2B_WRENCH3_ANG_OFFSET + i] - f_k * u_ang[i];
+            g[DYN2B_WRENCH3_LIN_OFFSET + i]
+                    = f[DYN2B_WRENCH3_LIN_OFFSET + i] - f_k * u_lin[i];
+        }
+    }
+}
+
+
+// U = [I a; H^T a] of a revolute joint
+static void rev_axis_u(
+        const double *restrict a,
+        const double *restrict m,
+        double *restrict u_ang,
+        double *restrict u_lin)
+{
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+            1.0, &m[DYN2B_ABI3_I_OFFSET], 1,
+            a, 1,
+            0.0, u_ang, 1);
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+            1.0, &m[DYN2B_ABI3_H_OFFSET], 1,
+            a, 1,
+            0.0, u_lin, 1);
+}
 
-    const int JNT_IDX = DYN2B_Y_OFFSET;
 
-    // | I  H|
-    // |H^T M|
-    //
-    // [  - , i01,  - ,  - ,  - ,  - ],
-    // [  - , i11,  - , h10, h11, h12],
-    // [  - , i21,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ]])
-
-    double i_kk = m[DYN2B_ABI3_I_OFFSET
-                    + (JNT_IDX * DYN2B_ABI3_I_LD) + JNT_IDX];
-    double dstms = *d + i_kk;  // d + S^T M S
-
-    for (int i = 0; i < DYN2B_SCREW3_SIZE / 2; i++) {
-        double i_ik = m[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * JNT_IDX) + i];
-        double h_ki = m[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * i) + JNT_IDX];
-
-        for (int j = 0; j < n; j++) {
-            int idx_k = (j * DYN2B_SCREW3_SIZE)
-                        + (DYN2B_WRENCH3_ANG_OFFSET + JNT_IDX);
-            double f_k = f_in[idx_k];
-
-            int idx_ang_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_ANG_OFFSET + i);
-            f_out[idx_ang_io] = f_in[idx_ang_io] - f_k * i_ik / dstms;
-
-            int idx_lin_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_LIN_OFFSET + i);
-            f_out[idx_lin_io] = f_in[idx_lin_io] - f_k * h_ki / dstms;
-        }
-    }
+// U = [H a; M a] of a prismatic joint
+static void trans_axis_u(
+        const double *restrict a,
+        const double *restrict m,
+        double *restrict u_ang,
+        double *restrict u_lin)
+{
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+            1.0, &m[DYN2B_ABI3_H_OFFSET], 1,
+            a, 1,
+            0.0, u_ang, 1);
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+            1.0, &m[DYN2B_ABI3_M_OFFSET], 1,
+            a, 1,
+            0.0, u_lin, 1);
 }
 
 
-void dyn2b_rev_z_proj_wrench3(
-        int n,
+void dyn2b_rev_proj_abi3(
+        const double *restrict axis,
         const double *restrict d,
-        const double *restrict m,
-        const double *restrict f_in,
-        double *restrict f_out)
+        const double *restrict m_in,
+        double *restrict m_out)
 {
-    assert(n >= 0);
+    assert(axis);
     assert(d);
-    assert(m);
-    assert(f_in);
-    assert(f_out);
+    assert(m_in);
+    assert(m_out);
 
-    const int JNT_IDX = DYN2B_Z_OFFSET;
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
 
-    // | I  H|
-    // |H^T M|
-    //
-    // [  - ,  - , i02,  - ,  - ,  - ],
-    // [  - ,  - , i12,  - ,  - ,  - ],
-    // [  - ,  - , i22, h20, h21, h22],
-    // [  - ,  - ,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ],
-    // [  - ,  - ,  - ,  - ,  - ,  - ]])
-
-    double i_kk = m[DYN2B_ABI3_I_OFFSET
-                    + (JNT_IDX * DYN2B_ABI3_I_LD) + JNT_IDX];
-    double dstms = *d + i_kk;  // d + S^T M S
-
-    for (int i = 0; i < DYN2B_SCREW3_SIZE / 2; i++) {
-        double i_ik = m[DYN2B_ABI3_I_OFFSET + (DYN2B_ABI3_I_LD * JNT_IDX) + i];
-        double h_ki = m[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * i) + JNT_IDX];
-
-        for (int j = 0; j < n; j++) {
-            int idx_k = (j * DYN2B_SCREW3_SIZE)
-                        + (DYN2B_WRENCH3_ANG_OFFSET + JNT_IDX);
-            double f_k = f_in[idx_k];
-
-            int idx_ang_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_ANG_OFFSET + i);
-            f_out[idx_ang_io] = f_in[idx_ang_io] - f_k * i_ik / dstms;
-
-            int idx_lin_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_LIN_OFFSET + i);
-            f_out[idx_lin_io] = f_in[idx_lin_io] - f_k * h_ki / dstms;
-        }
-    }
+    double u_ang[3];
+    double u_lin[3];
+    rev_axis_u(a, m_in, u_ang, u_lin);
+
+    // d + S^T M S
+    double dstms = *d + a[0] * u_ang[0] + a[1] * u_ang[1] + a[2] * u_ang[2];
+
+    axis_proj_abi3(dstms, u_ang, u_lin, m_in, m_out);
 }
 
 
-void dyn2b_trans_x_proj_wrench3(
-        int n,
+void dyn2b_trans_proj_abi3(
+        const double *restrict axis,
         const double *restrict d,
-        const double *restrict m,
-        const double *restrict f_in,
-        double *restrict f_out)
+        const double *restrict m_in,
+        double *restrict m_out)
 {
-    assert(n >= 0);
+    assert(axis);
     assert(d);
-    assert(m);
-    assert(f_in);
-    assert(f_out);
+    assert(m_in);
+    assert(m_out);
 
-    const int JNT_IDX = DYN2B_X_OFFSET;
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
 
-    // | I  H|
-    // |H^T M|
-    //
-    // [  - ,  - ,  - , h00,  - ,  - ],
-    // [  - ,  - ,  - , h10,  - ,  - ],
-    // [  - ,  - ,  - , h20,  - ,  - ],
-    // [  - ,  - ,  - , m00,  - ,  - ],
-    // [  - ,  - ,  - , m10,  - ,  - ],
-    // [  - ,  - ,  - , m20,  - ,  - ]])
-
-    double m_kk = m[DYN2B_ABI3_M_OFFSET
-                    + (JNT_IDX * DYN2B_ABI3_M_LD) + JNT_IDX];
-    double dstms = *d + m_kk;  // d + S^T M S
-
-    for (int i = 0; i < DYN2B_SCREW3_SIZE / 2; i++) {
-        double m_ik = m[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * JNT_IDX) + i];
-        double h_ik = m[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * JNT_IDX) + i];
-
-        for (int j = 0; j < n; j++) {
-            int idx_k = (j * DYN2B_SCREW3_SIZE)
-                        + (DYN2B_WRENCH3_LIN_OFFSET + JNT_IDX);
-            double f_k = f_in[idx_k];
-
-            int idx_lin_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_LIN_OFFSET + i);
-            f_out[idx_lin_io] = f_in[idx_lin_io] - f_k * m_ik / dstms;
-
-            int idx_ang_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_ANG_OFFSET + i);
-            f_out[idx_ang_io] = f_in[idx_ang_io] - f_k * h_ik / dstms;
-        }
-    }
+    double u_ang[3];
+    double u_lin[3];
+    trans_axis_u(a, m_in, u_ang, u_lin);
+
+    // d + S^T M S
+    double dstms = *d + a[0] * u_lin[0] + a[1] * u_lin[1] + a[2] * u_lin[2];
+
+    axis_proj_abi3(dstms, u_ang, u_lin, m_in, m_out);
 }
 
 
-void dyn2b_trans_y_proj_wrench3(
+void dyn2b_rev_proj_wrench3(
         int n,
+        const double *restrict axis,
         const double *restrict d,
         const double *restrict m,
         const double *restrict f_in,
         double *restrict f_out)
 {
     assert(n >= 0);
+    assert(axis);
     assert(d);
     assert(m);
     assert(f_in);
     assert(f_out);
 
-    const int JNT_IDX = DYN2B_Y_OFFSET;
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
 
-    // | I  H|
-    // |H^T M|
-    //
-    // [  - ,  - ,  - ,  - , h01,  - ],
-    // [  - ,  - ,  - ,  - , h11,  - ],
-    // [  - ,  - ,  - ,  - , h21,  - ],
-    // [  - ,  - ,  - ,  - , m01,  - ],
-    // [  - ,  - ,  - ,  - , m11,  - ],
-    // [  - ,  - ,  - ,  - , m21,  - ]])
-
-    double m_kk = m[DYN2B_ABI3_M_OFFSET
-                    + (JNT_IDX * DYN2B_ABI3_M_LD) + JNT_IDX];
-    double dstms = *d + m_kk;  // d + S^T M S
-
-    for (int i = 0; i < DYN2B_SCREW3_SIZE / 2; i++) {
-        double m_ik = m[DYN2B_ABI3_M_OFFSET + (DYN2B_ABI3_M_LD * JNT_IDX) + i];
-        double h_ik = m[DYN2B_ABI3_H_OFFSET + (DYN2B_ABI3_H_LD * JNT_IDX) + i];
-
-        for (int j = 0; j < n; j++) {
-            int idx_k = (j * DYN2B_SCREW3_SIZE)
-                        + (DYN2B_WRENCH3_LIN_OFFSET + JNT_IDX);
-            double f_k = f_in[idx_k];
-
-            int idx_lin_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_LIN_OFFSET + i);
-            f_out[idx_lin_io] = f_in[idx_lin_io] - f_k * m_ik / dstms;
-
-            int idx_ang_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_ANG_OFFSET + i);
-            f_out[idx_ang_io] = f_in[idx_ang_io] - f_k * h_ik / dstms;
-        }
-    }
+    double u_ang[3];
+    double u_lin[3];
+    rev_axis_u(a, m, u_ang, u_lin);
+
+    // d + S^T M S
+    double dstms = *d + a[0] * u_ang[0] + a[1] * u_ang[1] + a[2] * u_ang[2];
+
+    axis_proj_wrench3(n, DYN2B_WRENCH3_ANG_OFFSET, a, dstms,
+            u_ang, u_lin, f_in, f_out);
 }
 
 
-void dyn2b_trans_z_proj_wrench3(
+void dyn2b_trans_proj_wrench3(
         int n,
+        const double *restrict axis,
         const double *restrict d,
         const double *restrict m,
         const double *restrict f_in,
         double *restrict f_out)
 {
     assert(n >= 0);
+    assert(axis);
     assert(d);
     assert(m);
     assert(f_in);
     assert(f_out);
 
-    const int JNT_IDX = DYN2B_Z_OFFSET;
-
-    // | I  H|
-    // |H^T M|
-    //
-    // [  - ,  - ,  - ,  - ,  - , h02],
-    // [  - ,  - ,  - ,  - ,  - , h12],
-    // [  - ,  - ,  - ,  - ,  - , h22],
-    // [  - ,  - ,  - ,  - ,  - , m02],
-    // [  - ,  - ,  - ,  - ,  - , m12],
-    // [  - ,  - ,  - ,  - ,  - , m22]])
-
-    double m_kk = m[DYN2B_ABI3_M_OFFSET
-                    + (JNT_IDX * DYN2B_ABI3_M_LD) + JNT_IDX];
-    double dstms = *d + m_kk;  // d + S^T M S
-
-    for (int i = 0; i < DYN2B_SCREW3_SIZE / 2; i++) {
-        double m_ik = m[DYN2B_ABI3_M_OFFSET
-                        + (DYN2B_ABI3_M_LD * JNT_IDX) + i];
-        double h_ik = m[DYN2B_ABI3_H_OFFSET
-                        + (DYN2B_ABI3_H_LD * JNT_IDX) + i];
-
-        for (int j = 0; j < n; j++) {
-            int idx_k = (j * DYN2B_SCREW3_SIZE)
-                        + (DYN2B_WRENCH3_LIN_OFFSET + JNT_IDX);
-            double f_k = f_in[idx_k];
-
-            int idx_lin_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_LIN_OFFSET + i);
-            f_out[idx_lin_io] = f_in[idx_lin_io] - f_k * m_ik / dstms;
-
-            int idx_ang_io = (j * DYN2B_SCREW3_SIZE)
-                             + (DYN2B_WRENCH3_ANG_OFFSET + i);
-            f_out[idx_ang_io] = f_in[idx_ang_io] - f_k * h_ik / dstms;
-        }
-    }
-}
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
 
+    double u_ang[3];
+    double u_lin[3];
+    trans_axis_u(a, m, u_ang, u_lin);
 
-void dyn2b_to_mat_abi3(
-        const double *restrict tup,
-        double *restrict mat)
-{
-    assert(tup);
-    assert(mat);
+    // d + S^T M S
+    double dstms = *d + a[0] * u_lin[0] + a[1] * u_lin[1] + a[2] * u_lin[2];
 
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            int ii  =  0 + (i * DYN2B_SCREW3_SIZE) + j;
-            int iht =  3 + (i * DYN2B_SCREW3_SIZE) + j;
-            int ih  = 18 + (i * DYN2B_SCREW3_SIZE) + j;
-            int im  = 21 + (i * DYN2B_SCREW3_SIZE) + j;
-            mat[ii ] = tup[DYN2B_ABI3_I_OFFSET + (i * DYN2B_ABI3_I_LD) + j];
-            mat[iht] = tup[DYN2B_ABI3_H_OFFSET + (j * DYN2B_ABI3_H_LD) + i];
-            mat[ih ] = tup[DYN2B_ABI3_H_OFFSET + (i * DYN2B_ABI3_H_LD) + j];
-            mat[im ] = tup[DYN2B_ABI3_M_OFFSET + (i * DYN2B_ABI3_M_LD) + j];
-        }
-    }
+    axis_proj_wrench3(n, DYN2B_WRENCH3_LIN_OFFSET, a, dstms,
+            u_ang, u_lin, f_in, f_out);
 }
 
 
-void dyn2b_to_tup_abi3(
-        const double *restrict mat,
-        double *restrict tup)
+// Invert a symmetric [dof x dof] matrix in place
+static void inv_sym(
+        int dof,
+        double *restrict a)
 {
-    assert(mat);
-    assert(tup);
+    if (dof == 1) {
+        a[0] = 1.0 / a[0];
+    } else {
+        int piv[dof];
+        // Bunch-Kaufman (L D L^T) factorization: exploits the symmetry, unlike
+        // an LU decomposition, but only fills out the upper triangular
+        // matrix ...
+        LAPACKE_dsytrf(LAPACK_COL_MAJOR, 'U', dof, a, dof, piv);
+        LAPACKE_dsytri(LAPACK_COL_MAJOR, 'U', dof, a, dof, piv);
 
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            int ii = DYN2B_ABI3_I_OFFSET + (i * DYN2B_ABI3_I_LD) + j;
-            int ih = DYN2B_ABI3_H_OFFSET + (i * DYN2B_ABI3_H_LD) + j;
-            int im = DYN2B_ABI3_M_OFFSET + (i * DYN2B_ABI3_M_LD) + j;
-            tup[ii] = mat[ 0 + (i * DYN2B_SCREW3_SIZE) + j];
-            tup[ih] = mat[18 + (i * DYN2B_SCREW3_SIZE) + j];
-            tup[im] = mat[21 + (i * DYN2B_SCREW3_SIZE) + j];
+        // ... copy upper triangular matrix to lower triangular matrix
+        for (int i = 0; i < dof; i++) {
+            for (int j = i; j < dof; j++) {
+                a[i * dof + j] = a[i + j * dof];
+            }
         }
     }
 }
 
 
-void dyn2b_jnt_inv_abi3(
+// D = d + S^T M^A S
+static void jnt_dstms(
         int dof,
         const double *restrict jac,
         const double *restrict m,
         const double *restrict d,
         double *restrict dstms)
 {
-    assert(dof >= 1);
-    assert(dof <= 6);
-    assert(jac);
-    assert(m);
-    assert(d);
-    assert(dstms);
-
-    // D = d + S^T M^A S
-    //
     double ms[DYN2B_SCREW3_SIZE * dof];
 
     // M^A S
@@ -1070,28 +1172,51 @@ void dyn2b_jnt_inv_abi3(
             1.0, jac, DYN2B_SCREW3_SIZE,
             ms, DYN2B_SCREW3_SIZE,
             1.0, dstms, dof);
+}
+
+
+void dyn2b_jnt_inv_abi3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict m,
+        const double *restrict d,
+        double *restrict dstms)
+{
+    assert(dof >= 1);
+    assert(dof <= 6);
+    assert(jac);
+    assert(m);
+    assert(d);
+    assert(dstms);
+
+    // D = d + S^T M^A S
+    jnt_dstms(dof, jac, m, d, dstms);
 
     // D^{-1}
-    if (dof == 1) {
-        dstms[0] = 1.0 / dstms[0];
-    } else {
-        int piv[dof];
-        // LU decomposition
-        //LAPACKE_dgetrf(LAPACK_COL_MAJOR, dof, dof, dstms, dof, piv);
-        //LAPACKE_dgetri(LAPACK_COL_MAJOR, dof, dstms, dof, piv);
+    inv_sym(dof, dstms);
+}
 
-        // Cholesky decomposition: more efficient than LU decomposition but only
-        // fills out upper triangular matrix ...
-        LAPACKE_dsytrf(LAPACK_COL_MAJOR, 'U', dof, dstms, dof, piv);
-        LAPACKE_dsytri(LAPACK_COL_MAJOR, 'U', dof, dstms, dof, piv);
 
-        // ... copy upper triangular matrix to lower triangular matrix
-        for (int i = 0; i < dof; i++) {
-            for (int j = i; j < dof; j++) {
-                dstms[i * dof + j] = dstms[i + j * dof];
-            }
-        }
-    }
+void dyn2b_jnt_fct_abi3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict m,
+        const double *restrict d,
+        double *restrict fct)
+{
+    assert(dof >= 1);
+    assert(dof <= 6);
+    assert(jac);
+    assert(m);
+    assert(d);
+    assert(fct);
+
+    // D = d + S^T M^A S
+    double dstms[dof * dof];
+    jnt_dstms(dof, jac, m, d, dstms);
+
+    // D = L D' L^T
+    dyn2b_ldl_fct_mat(dof, dstms, dof, fct);
 }
 
 
@@ -1114,23 +1239,26 @@ void dyn2b_jnt_to_proj3(
     double m_mat[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
     dyn2b_to_mat_abi3(m, m_mat);
 
-    // D^{-1} = (d + S^T M^A S)^{-1}
-    double d_inv[dof * dof];
-    dyn2b_jnt_inv_abi3(dof, jac, m_mat, d, d_inv);
+    // D = d + S^T M^A S (factorized)
+    double fct[dof * dof];
+    dyn2b_jnt_fct_abi3(dof, jac, m_mat, d, fct);
+
+    // D^{-1} S^T
+    double st[dof * DYN2B_SCREW3_SIZE];
+    double dist[dof * DYN2B_SCREW3_SIZE];
+    for (int c = 0; c < DYN2B_SCREW3_SIZE; c++) {
+        for (int r = 0; r < dof; r++) {
+            st[(dof * c) + r] = jac[(DYN2B_SCREW3_SIZE * r) + c];
+        }
+    }
+    dyn2b_ldl_slv_mat(dof, DYN2B_SCREW3_SIZE, fct, st, dof, dist, dof);
 
     // S D^{-1} S^T
-    double sdi[DYN2B_SCREW3_SIZE * dof];
     double sdist[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
-
-    cblas_dsymm(CblasColMajor, CblasRight, CblasUpper,
-            DYN2B_SCREW3_SIZE, dof,
-            1.0, d_inv, dof,
-            jac, DYN2B_SCREW3_SIZE,
-            0.0, sdi, DYN2B_SCREW3_SIZE);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans,
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
             DYN2B_SCREW3_SIZE, DYN2B_SCREW3_SIZE, dof,
-            1.0, sdi, DYN2B_SCREW3_SIZE,
-            jac, DYN2B_SCREW3_SIZE,
+            1.0, jac, DYN2B_SCREW3_SIZE,
+            dist, dof,
             0.0, sdist, DYN2B_SCREW3_SIZE);
 
 
@@ -1156,99 +1284,223 @@ void dyn2b_jnt_proj_abi3(
         double *restrict m_out)
 {
     assert(dof >= 1);
+    assert(dof <= 6);
     assert(jac);
     assert(d);
     assert(m_in);
     assert(m_out);
 
-    double proj[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
-    dyn2b_jnt_to_proj3(dof, jac, d, m_in, proj);
+    double jpc[DYN2B_JPC3_SIZE(dof)];
+    dyn2b_jnt_to_jpc3(dof, jac, d, m_in, jpc);
+    dyn2b_jnt_proj_abi3_jpc(dof, jpc, m_in, m_out);
+}
+
 
-    // TODO: Remove duplicated computations. The previous function already
-    //       constructs a dense representation of the ABI internally.
-    double m_mat[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
-    dyn2b_to_mat_abi3(m_in, m_mat);
+void dyn2b_jnt_proj_wrench3(
+        int n,
+        int dof,
+        const double *restrict jac,
+        const double *restrict d,
+        const double *restrict m,
+        const double *restrict f_in,
+        double *restrict f_out)
+{
+    assert(n >= 0);
+    assert(dof >= 1);
+    assert(dof <= 6);
 
-    double m_proj[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
-    cblas_dsymm(CblasColMajor, CblasRight, CblasUpper,
-            DYN2B_SCREW3_SIZE, DYN2B_SCREW3_SIZE,
-            1.0, m_mat, DYN2B_SCREW3_SIZE,
-            proj, DYN2B_SCREW3_SIZE,
-            0.0, m_proj, DYN2B_SCREW3_SIZE);
+    // At least one element to avoid a zero-length array
+    double ws[dyn2b_workspace_size_jnt_proj_wrench3(n, dof) + 1];
+    dyn2b_jnt_proj_wrench3_ws(n, dof, jac, d, m, f_in, f_out, ws);
+}
+
+
+int dyn2b_workspace_size_jnt_proj_wrench3(
+        int n,
+        int dof)
+{
+    assert(n >= 0);
+    assert(dof >= 1);
+    assert(dof <= 6);
 
-    dyn2b_to_tup_abi3(m_proj, m_out);
+    // S^T F
+    return dof * n;
 }
 
 
-void dyn2b_jnt_proj_wrench3(
+void dyn2b_jnt_proj_wrench3_ws(
         int n,
         int dof,
         const double *restrict jac,
         const double *restrict d,
         const double *restrict m,
         const double *restrict f_in,
-        double *restrict f_out)
+        double *restrict f_out,
+        double *restrict ws)
 {
     assert(n >= 0);
-    assert(dof >= 0);
+    assert(dof >= 1);
     assert(dof <= 6);
     assert(jac);
     assert(d);
     assert(m);
     assert(f_in);
     assert(f_out);
+    assert(ws);
 
-    // Construct inertia matrix to simplify the code below (at the expense of
-    // slightly more computations)
-    double m_mat[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
-    dyn2b_to_mat_abi3(m, m_mat);
+    double jpc[DYN2B_JPC3_SIZE(dof)];
+    dyn2b_jnt_to_jpc3(dof, jac, d, m, jpc);
+    dyn2b_jnt_proj_wrench3_jpc(n, dof, jac, jpc, f_in, f_out, ws);
+}
 
-    // D^{-1}
-    double d_inv[dof * dof];
-    dyn2b_jnt_inv_abi3(dof, jac, m_mat, d, d_inv);
 
+void dyn2b_jnt_to_jpc3(
+        int dof,
+        const double *restrict jac,
+        const double *restrict d,
+        const double *restrict m,
+        double *restrict jpc)
+{
+    assert(dof >= 1);
+    assert(dof <= 6);
+    assert(jac);
+    assert(d);
+    assert(m);
+    assert(jpc);
+
+    double *u = &jpc[DYN2B_JPC3_U_OFFSET(dof)];
+    double *k = &jpc[DYN2B_JPC3_K_OFFSET(dof)];
+    double *fct = &jpc[DYN2B_JPC3_FCT_OFFSET(dof)];
 
-    // S^T F
-    // Note: S (angular-before-linear) vs. F (linear-before-angular)
-    double stf[dof * n];
-    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans,
-            dof, n, DYN2B_SCREW3_DIR_SIZE,
-            1.0, &jac[DYN2B_TWIST3_ANG_OFFSET], DYN2B_TWIST3_SIZE,
-            &f_in[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_WRENCH3_SIZE,
-            0.0, stf, dof);
-    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans,
-            dof, n, DYN2B_SCREW3_MOM_SIZE,
-            1.0, &jac[DYN2B_TWIST3_LIN_OFFSET], DYN2B_TWIST3_SIZE,
-            &f_in[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_WRENCH3_SIZE,
-            1.0, stf, dof);
-
-    // D^{-1} (S^T F)
-    double distf[dof * n];
-    cblas_dsymm(CblasColMajor, CblasLeft, CblasUpper, dof, n,
-            1.0, d_inv, n,
-            stf, dof,
-            0.0, distf, dof);
-
-    // S (D^{-1} S^T F)
-    double sdistf[DYN2B_TWIST3_SIZE * n];
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
-            DYN2B_TWIST3_SIZE, n, dof,
-            1.0, jac, DYN2B_TWIST3_SIZE,
-            distf, dof,
-            0.0, sdistf, DYN2B_TWIST3_SIZE);
+    // U = I^A S
+    // Note: U is a collection of wrenches (linear-before-angular)
+    dyn2b_abi_to_wrench3(dof, m, jac, u);
+
+    // D = d + S^T U (factorized)
+    double dstms[dof * dof];
+    dyn2b_dot_screw3(dof, dof, u, jac, dstms);
+    for (int i = 0; i < dof * dof; i++) {
+        dstms[i] += d[i];
+    }
+    dyn2b_ldl_fct_mat(dof, dstms, dof, fct);
+
+    // K = U D^{-1} = (D^{-1} U^T)^T
+    double ut[dof * DYN2B_WRENCH3_SIZE];
+    double diut[dof * DYN2B_WRENCH3_SIZE];
+    for (int c = 0; c < DYN2B_WRENCH3_SIZE; c++) {
+        for (int r = 0; r < dof; r++) {
+            ut[(dof * c) + r] = u[(DYN2B_JPC3_U_LD * r) + c];
+        }
+    }
+    dyn2b_ldl_slv_mat(dof, DYN2B_WRENCH3_SIZE, fct, ut, dof, diut, dof);
+    for (int c = 0; c < DYN2B_WRENCH3_SIZE; c++) {
+        for (int r = 0; r < dof; r++) {
+            k[(DYN2B_JPC3_K_LD * r) + c] = diut[(dof * c) + r];
+        }
+    }
+}
+
+
+void dyn2b_jnt_proj_abi3_jpc(
+        int dof,
+        const double *restrict jpc,
+        const double *restrict m_in,
+        double *restrict m_out)
+{
+    assert(dof >= 1);
+    assert(dof <= 6);
+    assert(jpc);
+    assert(m_in);
+    assert(m_out);
+
+    const double *u = &jpc[DYN2B_JPC3_U_OFFSET(dof)];
+    const double *k = &jpc[DYN2B_JPC3_K_OFFSET(dof)];
+
+    // Rank-dof update of the blocks with K = U D^{-1}:
+    // I' = I - K_n U_n^T
+    // H' = H - K_n U_f^T
+    // M' = M - K_f U_f^T
+    memcpy(m_out, m_in, DYN2B_ABI3_SIZE * sizeof(double));
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans,
+            3, 3, dof,
+            -1.0, &k[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_JPC3_K_LD,
+            &u[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_JPC3_U_LD,
+            1.0, &m_out[DYN2B_ABI3_I_OFFSET], DYN2B_ABI3_I_LD);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans,
+            3, 3, dof,
+            -1.0, &k[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_JPC3_K_LD,
+            &u[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_JPC3_U_LD,
+            1.0, &m_out[DYN2B_ABI3_H_OFFSET], DYN2B_ABI3_H_LD);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans,
+            3, 3, dof,
+            -1.0, &k[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_JPC3_K_LD,
+            &u[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_JPC3_U_LD,
+            1.0, &m_out[DYN2B_ABI3_M_OFFSET], DYN2B_ABI3_M_LD);
+}
 
-    // F - (M^A S D^{-1} S^T F)
-    // Note: S (angular-before-linear) vs. F (linear-before-angular)
+
+void dyn2b_jnt_proj_wrench3_jpc(
+        int n,
+        int dof,
+        const double *restrict jac,
+        const double *restrict jpc,
+        const double *restrict f_in,
+        double *restrict f_out,
+        double *restrict ws)
+{
+    assert(n >= 0);
+    assert(dof >= 1);
+    assert(dof <= 6);
+    assert(jac);
+    assert(jpc);
+    assert(f_in);
+    assert(f_out);
+    assert(ws);
+
+    if (n == 0) {
+        return;
+    }
+
+    const double *k = &jpc[DYN2B_JPC3_K_OFFSET(dof)];
+
+    // (S^T F)^T
+    double *stf = ws;
+    dyn2b_dot_screw3(n, dof, f_in, jac, stf);
+
+    // F - K (S^T F)
     memcpy(f_out, f_in, DYN2B_WRENCH3_SIZE * n * sizeof(double));
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans,
+            DYN2B_WRENCH3_SIZE, n, dof,
+            -1.0, k, DYN2B_JPC3_K_LD,
+            stf, n,
+            1.0, f_out, DYN2B_WRENCH3_SIZE);
+}
 
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
-            DYN2B_SCREW3_DIR_SIZE, n, DYN2B_SCREW3_SIZE,
-            -1.0, &m_mat[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE,
-            sdistf, DYN2B_SCREW3_SIZE,
-            1.0, &f_out[DYN2B_WRENCH3_ANG_OFFSET], DYN2B_SCREW3_SIZE);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
-            DYN2B_SCREW3_MOM_SIZE, n, DYN2B_SCREW3_SIZE,
-            -1.0, &m_mat[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE,
-            sdistf, DYN2B_SCREW3_SIZE,
-            1.0, &f_out[DYN2B_WRENCH3_LIN_OFFSET], DYN2B_SCREW3_SIZE);
+
+void dyn2b_jnt_acc3_jpc(
+        int dof,
+        const double *restrict jpc,
+        const double *restrict tau,
+        const double *restrict xdd,
+        double *restrict qdd)
+{
+    assert(dof >= 1);
+    assert(dof <= 6);
+    assert(jpc);
+    assert(tau);
+    assert(xdd);
+    assert(qdd);
+
+    const double *k = &jpc[DYN2B_JPC3_K_OFFSET(dof)];
+    const double *fct = &jpc[DYN2B_JPC3_FCT_OFFSET(dof)];
+
+    // D^{-1} tau
+    dyn2b_ldl_slv_mat(dof, 1, fct, tau, dof, qdd, dof);
+
+    // - K^T Xdd = - D^{-1} U^T Xdd
+    double kx[dof];
+    dyn2b_dot_screw3(dof, 1, k, xdd, kx);
+    for (int i = 0; i < dof; i++) {
+        qdd[i] -= kx[i];
+    }
 }
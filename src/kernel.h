@@ -0,0 +1,430 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SRC_KERNEL_H
+#define DYN2B_SRC_KERNEL_H
+
+/*
+ * Kernels for the fixed-size (3x3) matrix operations that occur inside the
+ * spatial operators. All matrices are stored in column-major layout with a
+ * leading dimension of 3 (cf. DYN2B_POSE3_ANG_LD, DYN2B_ABI3_*_LD).
+ *
+ * The backend is selected at build time:
+ * - DYN2B_KERNEL_BLAS: forward to the CBLAS routines
+ * - otherwise: fully unrolled C kernels whose operands stay in registers
+ *
+ * The "op" arguments select whether an operand is transposed. They are
+ * expected to be compile-time constants so that the unused branches vanish.
+ *
+ * The "_strided" kernels are always unrolled, independent of the backend.
+ * Their "inc" arguments denote the distance between two consecutive entries of
+ * an operand. That covers the structure-of-arrays layout of the batched
+ * operators where consecutive entries belong to the same instance.
+ */
+
+#ifdef DYN2B_KERNEL_BLAS
+#  include <cblas.h>
+#endif
+
+
+#define DYN2B_KRN_NO_TRANS 0
+#define DYN2B_KRN_TRANS    1
+
+
+// Declare that the iterations of the following loop are independent. The
+// batched operators need it: the compiler cannot prove on its own that rows
+// which are ld apart do not overlap and would otherwise not vectorize the loop.
+#if defined(__clang__)
+#  define DYN2B_KRN_INDEPENDENT _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#  define DYN2B_KRN_INDEPENDENT _Pragma("GCC ivdep")
+#else
+#  define DYN2B_KRN_INDEPENDENT
+#endif
+
+
+// Fully unroll the following loop whose trip count is a (small) compile-time
+// constant after inlining. GCC only does so on its own at -O3.
+#if defined(__clang__)
+#  define DYN2B_KRN_UNROLL _Pragma("clang loop unroll(full)")
+#elif defined(__GNUC__)
+#  define DYN2B_KRN_UNROLL _Pragma("GCC unroll 8")
+#else
+#  define DYN2B_KRN_UNROLL
+#endif
+
+
+// Load the 3x3 matrix a (or its transpose) into the local variables
+// <p>00 ... <p>22 where the digits denote row and column
+#define DYN2B_KRN_LOAD3(p, a, inc, op) \
+    const double p##00 = (a)[0 * (inc)]; \
+    const double p##11 = (a)[4 * (inc)]; \
+    const double p##22 = (a)[8 * (inc)]; \
+    const double p##10 = (op) ? (a)[3 * (inc)] : (a)[1 * (inc)]; \
+    const double p##20 = (op) ? (a)[6 * (inc)] : (a)[2 * (inc)]; \
+    const double p##01 = (op) ? (a)[1 * (inc)] : (a)[3 * (inc)]; \
+    const double p##21 = (op) ? (a)[7 * (inc)] : (a)[5 * (inc)]; \
+    const double p##02 = (op) ? (a)[2 * (inc)] : (a)[6 * (inc)]; \
+    const double p##12 = (op) ? (a)[5 * (inc)] : (a)[7 * (inc)]
+
+
+/*
+ * c = alpha * op(a) * op(b) + beta * c
+ *
+ * a, b, c: [3 x 3] with entries that are inc_a, inc_b, inc_c apart
+ */
+static inline void dyn2b_krn_gemm3_strided(
+        int op_a,
+        int op_b,
+        double alpha,
+        const double *restrict a,
+        int inc_a,
+        const double *restrict b,
+        int inc_b,
+        double beta,
+        double *restrict c,
+        int inc_c)
+{
+    DYN2B_KRN_LOAD3(a, a, inc_a, op_a);
+    DYN2B_KRN_LOAD3(b, b, inc_b, op_b);
+
+    const double c00 = a00 * b00 + a01 * b10 + a02 * b20;
+    const double c10 = a10 * b00 + a11 * b10 + a12 * b20;
+    const double c20 = a20 * b00 + a21 * b10 + a22 * b20;
+    const double c01 = a00 * b01 + a01 * b11 + a02 * b21;
+    const double c11 = a10 * b01 + a11 * b11 + a12 * b21;
+    const double c21 = a20 * b01 + a21 * b11 + a22 * b21;
+    const double c02 = a00 * b02 + a01 * b12 + a02 * b22;
+    const double c12 = a10 * b02 + a11 * b12 + a12 * b22;
+    const double c22 = a20 * b02 + a21 * b12 + a22 * b22;
+
+    // BLAS semantics: c is not read if beta is zero
+    if (beta == 0.0) {
+        c[0 * inc_c] = alpha * c00;
+        c[1 * inc_c] = alpha * c10;
+        c[2 * inc_c] = alpha * c20;
+        c[3 * inc_c] = alpha * c01;
+        c[4 * inc_c] = alpha * c11;
+        c[5 * inc_c] = alpha * c21;
+        c[6 * inc_c] = alpha * c02;
+        c[7 * inc_c] = alpha * c12;
+        c[8 * inc_c] = alpha * c22;
+    } else {
+        c[0 * inc_c] = alpha * c00 + beta * c[0 * inc_c];
+        c[1 * inc_c] = alpha * c10 + beta * c[1 * inc_c];
+        c[2 * inc_c] = alpha * c20 + beta * c[2 * inc_c];
+        c[3 * inc_c] = alpha * c01 + beta * c[3 * inc_c];
+        c[4 * inc_c] = alpha * c11 + beta * c[4 * inc_c];
+        c[5 * inc_c] = alpha * c21 + beta * c[5 * inc_c];
+        c[6 * inc_c] = alpha * c02 + beta * c[6 * inc_c];
+        c[7 * inc_c] = alpha * c12 + beta * c[7 * inc_c];
+        c[8 * inc_c] = alpha * c22 + beta * c[8 * inc_c];
+    }
+}
+
+
+/*
+ * y = alpha * op(a) * x + beta * y
+ *
+ * a: [3 x 3] with entries that are inc_a apart
+ * x, y: [3 x 1] with entries that are inc_x, inc_y apart
+ */
+static inline void dyn2b_krn_gemv3_strided(
+        int op_a,
+        double alpha,
+        const double *restrict a,
+        int inc_a,
+        const double *restrict x,
+        int inc_x,
+        double beta,
+        double *restrict y,
+        int inc_y)
+{
+    DYN2B_KRN_LOAD3(a, a, inc_a, op_a);
+
+    const double x0 = x[0 * inc_x];
+    const double x1 = x[1 * inc_x];
+    const double x2 = x[2 * inc_x];
+
+    const double y0 = a00 * x0 + a01 * x1 + a02 * x2;
+    const double y1 = a10 * x0 + a11 * x1 + a12 * x2;
+    const double y2 = a20 * x0 + a21 * x1 + a22 * x2;
+
+    if (beta == 0.0) {
+        y[0 * inc_y] = alpha * y0;
+        y[1 * inc_y] = alpha * y1;
+        y[2 * inc_y] = alpha * y2;
+    } else {
+        y[0 * inc_y] = alpha * y0 + beta * y[0 * inc_y];
+        y[1 * inc_y] = alpha * y1 + beta * y[1 * inc_y];
+        y[2 * inc_y] = alpha * y2 + beta * y[2 * inc_y];
+    }
+}
+
+
+/*
+ * out = in1 + in2 x in3
+ *
+ * in1, in2, in3, out: [3 x 1] with entries that are inc1, ..., inc_o apart
+ */
+static inline void dyn2b_krn_cad3_strided(
+        const double *restrict in1,
+        int inc1,
+        const double *restrict in2,
+        int inc2,
+        const double *restrict in3,
+        int inc3,
+        double *restrict out,
+        int inc_o)
+{
+    const double a0 = in2[0 * inc2];
+    const double a1 = in2[1 * inc2];
+    const double a2 = in2[2 * inc2];
+    const double b0 = in3[0 * inc3];
+    const double b1 = in3[1 * inc3];
+    const double b2 = in3[2 * inc3];
+
+    out[0 * inc_o] = in1[0 * inc1] + a1 * b2 - a2 * b1;
+    out[1 * inc_o] = in1[1 * inc1] + a2 * b0 - a0 * b2;
+    out[2 * inc_o] = in1[2 * inc1] + a0 * b1 - a1 * b0;
+}
+
+
+/*
+ * out = in1 x in2
+ *
+ * in1, in2, out: [3 x 1] with entries that are inc1, inc2, inc_o apart
+ */
+static inline void dyn2b_krn_crs3_strided(
+        const double *restrict in1,
+        int inc1,
+        const double *restrict in2,
+        int inc2,
+        double *restrict out,
+        int inc_o)
+{
+    const double a0 = in1[0 * inc1];
+    const double a1 = in1[1 * inc1];
+    const double a2 = in1[2 * inc1];
+    const double b0 = in2[0 * inc2];
+    const double b1 = in2[1 * inc2];
+    const double b2 = in2[2 * inc2];
+
+    out[0 * inc_o] = a1 * b2 - a2 * b1;
+    out[1 * inc_o] = a2 * b0 - a0 * b2;
+    out[2 * inc_o] = a0 * b1 - a1 * b0;
+}
+
+
+/*
+ * Unpack a symmetric matrix
+ *
+ * in: [6], packed (cf. DYN2B_SYM3_IDX)
+ * out: [3 x 3]
+ */
+static inline void dyn2b_krn_unp3p(
+        const double *restrict in,
+        double *restrict out)
+{
+    out[0] = in[0]; out[3] = in[1]; out[6] = in[3];
+    out[1] = in[1]; out[4] = in[2]; out[7] = in[4];
+    out[2] = in[3]; out[5] = in[4]; out[8] = in[5];
+}
+
+
+/*
+ * Pack the upper triangle of a symmetric matrix
+ *
+ * in: [3 x 3]
+ * out: [6], packed (cf. DYN2B_SYM3_IDX)
+ */
+static inline void dyn2b_krn_pck3p(
+        const double *restrict in,
+        double *restrict out)
+{
+    out[0] = in[0];
+    out[1] = in[3];
+    out[2] = in[4];
+    out[3] = in[6];
+    out[4] = in[7];
+    out[5] = in[8];
+}
+
+
+/*
+ * out = r * a * r^T
+ *
+ * r: [3 x 3]
+ * a, out: [6], symmetric and packed (cf. DYN2B_SYM3_IDX)
+ */
+static inline void dyn2b_krn_rart3p(
+        const double *restrict r,
+        const double *restrict a,
+        double *restrict out)
+{
+    DYN2B_KRN_LOAD3(r, r, 1, DYN2B_KRN_NO_TRANS);
+
+    // t = a * r^T
+    const double t00 = a[0] * r00 + a[1] * r01 + a[3] * r02;
+    const double t10 = a[1] * r00 + a[2] * r01 + a[4] * r02;
+    const double t20 = a[3] * r00 + a[4] * r01 + a[5] * r02;
+    const double t01 = a[0] * r10 + a[1] * r11 + a[3] * r12;
+    const double t11 = a[1] * r10 + a[2] * r11 + a[4] * r12;
+    const double t21 = a[3] * r10 + a[4] * r11 + a[5] * r12;
+    const double t02 = a[0] * r20 + a[1] * r21 + a[3] * r22;
+    const double t12 = a[1] * r20 + a[2] * r21 + a[4] * r22;
+    const double t22 = a[3] * r20 + a[4] * r21 + a[5] * r22;
+
+    // Upper triangle of r * t
+    out[0] = r00 * t00 + r01 * t10 + r02 * t20;
+    out[1] = r00 * t01 + r01 * t11 + r02 * t21;
+    out[2] = r10 * t01 + r11 * t11 + r12 * t21;
+    out[3] = r00 * t02 + r01 * t12 + r02 * t22;
+    out[4] = r10 * t02 + r11 * t12 + r12 * t22;
+    out[5] = r20 * t02 + r21 * t12 + r22 * t22;
+}
+
+
+/*
+ * c = alpha * op(a) * op(b) + beta * c
+ *
+ * a, b, c: [3 x 3]
+ */
+static inline void dyn2b_krn_gemm3(
+        int op_a,
+        int op_b,
+        double alpha,
+        const double *restrict a,
+        const double *restrict b,
+        double beta,
+        double *restrict c)
+{
+#ifdef DYN2B_KERNEL_BLAS
+    cblas_dgemm(CblasColMajor,
+            op_a ? CblasTrans : CblasNoTrans,
+            op_b ? CblasTrans : CblasNoTrans,
+            3, 3, 3,
+            alpha, a, 3,
+            b, 3,
+            beta, c, 3);
+#else
+    dyn2b_krn_gemm3_strided(op_a, op_b, alpha, a, 1, b, 1, beta, c, 1);
+#endif
+}
+
+
+/*
+ * c[:, j] = alpha * op(a) * b[:, j] + beta * c[:, j]    for j = 0 ... n-1
+ *
+ * a: [3 x 3]
+ * b: [3 x n] with leading dimension ldb
+ * c: [3 x n] with leading dimension ldc
+ */
+static inline void dyn2b_krn_gemm3n(
+        int op_a,
+        int n,
+        double alpha,
+        const double *restrict a,
+        const double *restrict b,
+        int ldb,
+        double beta,
+        double *restrict c,
+        int ldc)
+{
+#ifdef DYN2B_KERNEL_BLAS
+    cblas_dgemm(CblasColMajor,
+            op_a ? CblasTrans : CblasNoTrans, CblasNoTrans,
+            3, n, 3,
+            alpha, a, 3,
+            b, ldb,
+            beta, c, ldc);
+#else
+    for (int j = 0; j < n; j++) {
+        dyn2b_krn_gemv3_strided(op_a,
+                alpha, a, 1,
+                &b[j * ldb], 1,
+                beta, &c[j * ldc], 1);
+    }
+#endif
+}
+
+
+/*
+ * y = alpha * op(a) * x + beta * y
+ *
+ * a: [3 x 3]
+ * x, y: [3 x 1]
+ */
+static inline void dyn2b_krn_gemv3(
+        int op_a,
+        double alpha,
+        const double *restrict a,
+        const double *restrict x,
+        double beta,
+        double *restrict y)
+{
+#ifdef DYN2B_KERNEL_BLAS
+    cblas_dgemv(CblasColMajor, op_a ? CblasTrans : CblasNoTrans, 3, 3,
+            alpha, a, 3,
+            x, 1,
+            beta, y, 1);
+#else
+    dyn2b_krn_gemv3_strided(op_a, alpha, a, 1, x, 1, beta, y, 1);
+#endif
+}
+
+
+/*
+ * y = alpha * a * x + beta * y
+ *
+ * a: [6], symmetric and packed (cf. DYN2B_SYM3_IDX)
+ * x, y: [3 x 1]
+ */
+static inline void dyn2b_krn_spmv3(
+        double alpha,
+        const double *restrict a,
+        const double *restrict x,
+        double beta,
+        double *restrict y)
+{
+#ifdef DYN2B_KERNEL_BLAS
+    cblas_dspmv(CblasColMajor, CblasUpper, 3,
+            alpha, a,
+            x, 1,
+            beta, y, 1);
+#else
+    const double y0 = a[0] * x[0] + a[1] * x[1] + a[3] * x[2];
+    const double y1 = a[1] * x[0] + a[2] * x[1] + a[4] * x[2];
+    const double y2 = a[3] * x[0] + a[4] * x[1] + a[5] * x[2];
+
+    if (beta == 0.0) {
+        y[0] = alpha * y0;
+        y[1] = alpha * y1;
+        y[2] = alpha * y2;
+    } else {
+        y[0] = alpha * y0 + beta * y[0];
+        y[1] = alpha * y1 + beta * y[1];
+        y[2] = alpha * y2 + beta * y[2];
+    }
+#endif
+}
+
+
+/*
+ * y = alpha * x + y
+ *
+ * x, y: [3 x 1]
+ */
+static inline void dyn2b_krn_axpy3(
+        double alpha,
+        const double *restrict x,
+        double *restrict y)
+{
+#ifdef DYN2B_KERNEL_BLAS
+    cblas_daxpy(3, alpha, x, 1, y, 1);
+#else
+    y[0] += alpha * x[0];
+    y[1] += alpha * x[1];
+    y[2] += alpha * x[2];
+#endif
+}
+
+#endif
@@ -1,5 +1,9 @@
 // SPDX-License-Identifier: LGPL-3.0
 #include <dyn2b/functions/matrix.h>
+#include <string.h>
+#include <assert.h>
+
+#include "kernel.h"
 
 
 void dyn2b_cpy_mat(
@@ -39,3 +43,288 @@ void dyn2b_mad_mat(
         }
     }
 }
+
+
+// LDL^T factorization. This is meant to be inlined with a constant n so that
+// the loops fully unroll and the factor stays in registers.
+static inline void ldl_fct(
+        int n,
+        const double *restrict a,
+        int lda,
+        double *restrict fct)
+{
+    double l[n * n];    // strict lower triangle used
+    double d[n];
+
+    DYN2B_KRN_UNROLL
+    for (int j = 0; j < n; j++) {
+        // v_k = l_jk d_k
+        double v[n];
+        DYN2B_KRN_UNROLL
+        for (int k = 0; k < j; k++) {
+            v[k] = l[(k * n) + j] * d[k];
+        }
+
+        // d_j = a_jj - sum_k l_jk v_k
+        double d_j = a[(j * lda) + j];
+        DYN2B_KRN_UNROLL
+        for (int k = 0; k < j; k++) {
+            d_j -= l[(k * n) + j] * v[k];
+        }
+        assert(d_j > 0.0);    // positive-definite (cf. dyn2b_ldl_fct_mat())
+        d[j] = d_j;
+
+        // l_ij = (a_ij - sum_k l_ik v_k) / d_j
+        double d_j_inv = 1.0 / d_j;
+        DYN2B_KRN_UNROLL
+        for (int i = j + 1; i < n; i++) {
+            double l_ij = a[(j * lda) + i];
+            DYN2B_KRN_UNROLL
+            for (int k = 0; k < j; k++) {
+                l_ij -= l[(k * n) + i] * v[k];
+            }
+            l[(j * n) + i] = l_ij * d_j_inv;
+        }
+
+        // Column j of the result
+        DYN2B_KRN_UNROLL
+        for (int i = 0; i < j; i++) {
+            fct[(j * n) + i] = 0.0;
+        }
+        fct[(j * n) + j] = d_j_inv;
+        DYN2B_KRN_UNROLL
+        for (int i = j + 1; i < n; i++) {
+            fct[(j * n) + i] = l[(j * n) + i];
+        }
+    }
+}
+
+
+// Solve with an LDL^T factorization (cf. ldl_fct)
+static inline void ldl_slv(
+        int n,
+        int nrhs,
+        const double *restrict fct,
+        const double *restrict b,
+        int ldb,
+        double *restrict x,
+        int ldx)
+{
+    for (int c = 0; c < nrhs; c++) {
+        double y[n];
+
+        // L y = b
+        DYN2B_KRN_UNROLL
+        for (int i = 0; i < n; i++) {
+            double y_i = b[(c * ldb) + i];
+            DYN2B_KRN_UNROLL
+            for (int k = 0; k < i; k++) {
+                y_i -= fct[(k * n) + i] * y[k];
+            }
+            y[i] = y_i;
+        }
+
+        // z = D^{-1} y
+        DYN2B_KRN_UNROLL
+        for (int i = 0; i < n; i++) {
+            y[i] *= fct[(i * n) + i];
+        }
+
+        // L^T x = z
+        DYN2B_KRN_UNROLL
+        for (int i = n - 1; i >= 0; i--) {
+            double x_i = y[i];
+            DYN2B_KRN_UNROLL
+            for (int k = i + 1; k < n; k++) {
+                x_i -= fct[(i * n) + k] * y[k];
+            }
+            y[i] = x_i;
+        }
+
+        DYN2B_KRN_UNROLL
+        for (int i = 0; i < n; i++) {
+            x[(c * ldx) + i] = y[i];
+        }
+    }
+}
+
+
+void dyn2b_ldl_fct_mat(
+        int n,
+        const double *restrict a,
+        int lda,
+        double *restrict fct)
+{
+    assert(n >= 1);
+    assert(lda >= n);
+    assert(a);
+    assert(fct);
+
+    // Specialize on the joints' number of degrees of freedom
+    switch (n) {
+    case 1: ldl_fct(1, a, lda, fct); break;
+    case 2: ldl_fct(2, a, lda, fct); break;
+    case 3: ldl_fct(3, a, lda, fct); break;
+    case 4: ldl_fct(4, a, lda, fct); break;
+    case 5: ldl_fct(5, a, lda, fct); break;
+    case 6: ldl_fct(6, a, lda, fct); break;
+    default: ldl_fct(n, a, lda, fct); break;
+    }
+}
+
+
+void dyn2b_ldl_slv_mat(
+        int n,
+        int nrhs,
+        const double *restrict fct,
+        const double *restrict b,
+        int ldb,
+        double *restrict x,
+        int ldx)
+{
+    assert(n >= 1);
+    assert(nrhs >= 0);
+    assert(ldb >= n);
+    assert(ldx >= n);
+    assert(fct);
+    assert(b);
+    assert(x);
+
+    // Specialize on the joints' number of degrees of freedom
+    switch (n) {
+    case 1: ldl_slv(1, nrhs, fct, b, ldb, x, ldx); break;
+    case 2: ldl_slv(2, nrhs, fct, b, ldb, x, ldx); break;
+    case 3: ldl_slv(3, nrhs, fct, b, ldb, x, ldx); break;
+    case 4: ldl_slv(4, nrhs, fct, b, ldb, x, ldx); break;
+    case 5: ldl_slv(5, nrhs, fct, b, ldb, x, ldx); break;
+    case 6: ldl_slv(6, nrhs, fct, b, ldb, x, ldx); break;
+    default: ldl_slv(n, nrhs, fct, b, ldb, x, ldx); break;
+    }
+}
+
+
+// Start of the run of consecutive ancestors that ends at each row/column,
+// i.e. parent[j] = j - 1 for all j in (run[i], i]. Within a run the
+// ancestors are contiguous in memory so that the walk along the parents is
+// only required between the runs.
+static void ltdl_run(
+        int n,
+        const int *restrict parent,
+        int *restrict run)
+{
+    for (int i = 0; i < n; i++) {
+        assert(parent[i] >= -1 && parent[i] < i);
+
+        run[i] = (i > 0 && parent[i] == i - 1) ? run[i - 1] : i;
+    }
+}
+
+
+void dyn2b_ltdl_fct_mat(
+        int n,
+        const int *restrict parent,
+        const double *restrict a,
+        int lda,
+        double *restrict fct)
+{
+    assert(n >= 1);
+    assert(lda >= n);
+    assert(parent);
+    assert(a);
+    assert(fct);
+
+    int run[n];
+    ltdl_run(n, parent, run);
+
+    // Copy the sparsity pattern: the diagonal and the ancestors of each column
+    memset(fct, 0, n * n * sizeof(double));
+    for (int c = 0; c < n; c++) {
+        const double *a_c = &a[lda * c];
+        double *fct_c = &fct[n * c];
+
+        for (int j = c; j >= 0; j = parent[run[j]]) {
+            for (int r = run[j]; r <= j; r++) {
+                fct_c[r] = a_c[r];
+            }
+        }
+    }
+
+    // Eliminate from the leaves to the root: A_ij -= A_ki A_kj / A_kk for all
+    // ancestors i of k and j of i
+    for (int k = n - 1; k >= 0; k--) {
+        double *col_k = &fct[n * k];
+        double d_inv = 1.0 / col_k[k];
+
+        for (int i = parent[k]; i >= 0; i = parent[i]) {
+            double *col_i = &fct[n * i];
+            double l = col_k[i] * d_inv;
+
+            for (int j = i; j >= 0; j = parent[run[j]]) {
+                for (int r = run[j]; r <= j; r++) {
+                    col_i[r] -= l * col_k[r];
+                }
+            }
+            col_k[i] = l;
+        }
+
+        col_k[k] = d_inv;
+    }
+}
+
+
+void dyn2b_ltdl_slv_mat(
+        int n,
+        int nrhs,
+        const int *restrict parent,
+        const double *restrict fct,
+        const double *restrict b,
+        int ldb,
+        double *restrict x,
+        int ldx)
+{
+    assert(n >= 1);
+    assert(nrhs >= 0);
+    assert(ldb >= n);
+    assert(ldx >= n);
+    assert(parent);
+    assert(fct);
+    assert(b);
+    assert(x);
+
+    int run[n];
+    ltdl_run(n, parent, run);
+
+    for (int k = 0; k < nrhs; k++) {
+        const double *b_k = &b[ldb * k];
+        double *x_k = &x[ldx * k];
+
+        memcpy(x_k, b_k, n * sizeof(double));
+
+        // L^T y = b: from the leaves to the root
+        for (int i = n - 1; i >= 0; i--) {
+            const double *col_i = &fct[n * i];
+            for (int j = parent[i]; j >= 0; j = parent[run[j]]) {
+                for (int r = run[j]; r <= j; r++) {
+                    x_k[r] -= col_i[r] * x_k[i];
+                }
+            }
+        }
+
+        // z = D^{-1} y
+        for (int i = 0; i < n; i++) {
+            x_k[i] *= fct[(n * i) + i];
+        }
+
+        // L x = z: from the root to the leaves
+        for (int i = 0; i < n; i++) {
+            const double *col_i = &fct[n * i];
+            double sum = 0.0;
+            for (int j = parent[i]; j >= 0; j = parent[run[j]]) {
+                for (int r = run[j]; r <= j; r++) {
+                    sum += col_i[r] * x_k[r];
+                }
+            }
+            x_k[i] -= sum;
+        }
+    }
+}
@@ -4,10 +4,12 @@
 #include <dyn2b/functions/vector3.h>
 #include <dyn2b/types/mechanics.h>
 #include <dyn2b/types/screw.h>
-#include <cblas.h>
+#include <dyn2b/types/dual.h>
 #include <string.h>
 #include <assert.h>
 
+#include "kernel.h"
+
 
 void dyn2b_tf_dist_acc3(
         const double *restrict x,
@@ -23,9 +25,42 @@ void dyn2b_tf_dist_acc3(
     assert(xdd_dist);
 
     // X_{i,i+1} xdd_{0,i} + xd_{0,i+1} x xd_{i,i+1}
-    double tmp[DYN2B_SCREW3_SIZE];
-    dyn2b_tf_dist_screw3(1, x, xdd_prox, tmp);
-    dyn2b_cad_screw3(tmp, xd_abs, xd_rel, xdd_dist);
+    //
+    // All steps use the unrolled kernels so that the intermediate results
+    // remain in registers.
+
+    // ang_dist = R^T ang_prox + ang_abs x ang_rel
+    dyn2b_krn_crs3_strided(
+            &xd_abs[DYN2B_TWIST3_ANG_OFFSET], 1,
+            &xd_rel[DYN2B_TWIST3_ANG_OFFSET], 1,
+            &xdd_dist[DYN2B_TWIST3_ANG_OFFSET], 1);
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET], 1,
+            &xdd_prox[DYN2B_TWIST3_ANG_OFFSET], 1,
+            1.0, &xdd_dist[DYN2B_TWIST3_ANG_OFFSET], 1);
+
+    // lin_dist = R^T (lin_prox + ang_prox x r)
+    //          + ang_abs x lin_rel + lin_abs x ang_rel
+    double lin[DYN2B_TWIST3_LIN_SIZE];
+    double crs[DYN2B_TWIST3_LIN_SIZE];
+    dyn2b_krn_cad3_strided(
+            &xdd_prox[DYN2B_TWIST3_LIN_OFFSET], 1,
+            &xdd_prox[DYN2B_TWIST3_ANG_OFFSET], 1,
+            &x[DYN2B_POSE3_LIN_OFFSET], 1,
+            lin, 1);
+    dyn2b_krn_crs3_strided(
+            &xd_abs[DYN2B_TWIST3_LIN_OFFSET], 1,
+            &xd_rel[DYN2B_TWIST3_ANG_OFFSET], 1,
+            crs, 1);
+    dyn2b_krn_cad3_strided(
+            crs, 1,
+            &xd_abs[DYN2B_TWIST3_ANG_OFFSET], 1,
+            &xd_rel[DYN2B_TWIST3_LIN_OFFSET], 1,
+            &xdd_dist[DYN2B_TWIST3_LIN_OFFSET], 1);
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET], 1,
+            lin, 1,
+            1.0, &xdd_dist[DYN2B_TWIST3_LIN_OFFSET], 1);
 }
 
 
@@ -43,10 +78,10 @@ void dyn2b_rbi_to_wrench3(
             &rbi[DYN2B_RBI3_H_OFFSET], 1,
             &xdd[DYN2B_TWIST3_LIN_OFFSET], 1,
             &w[DYN2B_WRENCH3_ANG_OFFSET], 1);
-    cblas_dgemv(CblasColMajor, CblasNoTrans, 3, 3,
-            1.0, &rbi[DYN2B_RBI3_I_OFFSET], DYN2B_RBI3_I_LD,
-            &xdd[DYN2B_TWIST3_ANG_OFFSET], 1,
-            1.0, &w[DYN2B_WRENCH3_ANG_OFFSET], 1);
+    dyn2b_krn_gemv3(DYN2B_KRN_NO_TRANS,
+            1.0, &rbi[DYN2B_RBI3_I_OFFSET],
+            &xdd[DYN2B_TWIST3_ANG_OFFSET],
+            1.0, &w[DYN2B_WRENCH3_ANG_OFFSET]);
 
     // f = m v - h x w
     //   = m v + w x h
@@ -54,9 +89,9 @@ void dyn2b_rbi_to_wrench3(
             &xdd[DYN2B_TWIST3_ANG_OFFSET], 1,
             &rbi[DYN2B_RBI3_H_OFFSET], 1,
             &w[DYN2B_WRENCH3_LIN_OFFSET], 1);
-    cblas_daxpy(3,
-            rbi[DYN2B_RBI3_M_OFFSET], &xdd[DYN2B_TWIST3_LIN_OFFSET], 1,
-            &w[DYN2B_WRENCH3_LIN_OFFSET], 1);
+    dyn2b_krn_axpy3(
+            rbi[DYN2B_RBI3_M_OFFSET], &xdd[DYN2B_TWIST3_LIN_OFFSET],
+            &w[DYN2B_WRENCH3_LIN_OFFSET]);
 }
 
 
@@ -73,3 +108,331 @@ void dyn2b_nrt_wrench3(
     dyn2b_rbi_to_wrench3(rbi, xd, p);
     dyn2b_crs_screw3(xd, p, w);
 }
+
+
+void dyn2b_nrt_wrench3_dxd(
+        int n,
+        const double *restrict rbi,
+        const double *restrict xd,
+        const double *restrict xd_drv,
+        double *restrict w_drv)
+{
+    assert(n >= 1);
+    assert(rbi);
+    assert(xd);
+    assert(xd_drv);
+    assert(w_drv);
+
+    // dw = dxd x (I xd) + xd x (I dxd)
+    double p[DYN2B_SCREW3_SIZE];
+    dyn2b_rbi_to_wrench3(rbi, xd, p);
+    for (int i = 0; i < n; i++) {
+        const double *dxd = &xd_drv[DYN2B_TWIST3_SIZE * i];
+        double dp[DYN2B_SCREW3_SIZE];
+        double tmp[DYN2B_SCREW3_SIZE];
+        dyn2b_rbi_to_wrench3(rbi, dxd, dp);
+        dyn2b_crs_screw3(dxd, p, tmp);
+        dyn2b_cad_screw3(tmp, xd, dp, &w_drv[DYN2B_WRENCH3_SIZE * i]);
+    }
+}
+
+
+void dyn2b_eom_wrench3(
+        const double *restrict rbi,
+        const double *restrict xd,
+        const double *restrict xdd,
+        double *restrict w)
+{
+    assert(rbi);
+    assert(xd);
+    assert(xdd);
+    assert(w);
+
+    const double *h = &rbi[DYN2B_RBI3_H_OFFSET];
+    const double m = rbi[DYN2B_RBI3_M_OFFSET];
+
+    // Momentum p = I xd
+    // f_p = m v + w x h
+    // n_p = I w + h x v
+    double f_p[DYN2B_WRENCH3_LIN_SIZE];
+    double n_p[DYN2B_WRENCH3_ANG_SIZE];
+    dyn2b_krn_crs3_strided(
+            &xd[DYN2B_TWIST3_ANG_OFFSET], 1,
+            h, 1,
+            f_p, 1);
+    dyn2b_krn_crs3_strided(
+            h, 1,
+            &xd[DYN2B_TWIST3_LIN_OFFSET], 1,
+            n_p, 1);
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+            1.0, &rbi[DYN2B_RBI3_I_OFFSET], 1,
+            &xd[DYN2B_TWIST3_ANG_OFFSET], 1,
+            1.0, n_p, 1);
+
+    // Inertial wrench a = I xdd
+    double f_a[DYN2B_WRENCH3_LIN_SIZE];
+    double n_a[DYN2B_WRENCH3_ANG_SIZE];
+    dyn2b_krn_crs3_strided(
+            &xdd[DYN2B_TWIST3_ANG_OFFSET], 1,
+            h, 1,
+            f_a, 1);
+    dyn2b_krn_crs3_strided(
+            h, 1,
+            &xdd[DYN2B_TWIST3_LIN_OFFSET], 1,
+            n_a, 1);
+    dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+            1.0, &rbi[DYN2B_RBI3_I_OFFSET], 1,
+            &xdd[DYN2B_TWIST3_ANG_OFFSET], 1,
+            1.0, n_a, 1);
+
+    for (int i = 0; i < 3; i++) {
+        f_p[i] += m * xd[DYN2B_TWIST3_LIN_OFFSET + i];
+        f_a[i] += m * xdd[DYN2B_TWIST3_LIN_OFFSET + i];
+    }
+
+    // w = a + xd x* p
+    // f = f_a + w x f_p
+    // n = n_a + w x n_p + v x f_p
+    double tmp[DYN2B_WRENCH3_ANG_SIZE];
+    dyn2b_krn_cad3_strided(
+            f_a, 1,
+            &xd[DYN2B_TWIST3_ANG_OFFSET], 1,
+            f_p, 1,
+            &w[DYN2B_WRENCH3_LIN_OFFSET], 1);
+    dyn2b_krn_cad3_strided(
+            n_a, 1,
+            &xd[DYN2B_TWIST3_ANG_OFFSET], 1,
+            n_p, 1,
+            tmp, 1);
+    dyn2b_krn_cad3_strided(
+            tmp, 1,
+            &xd[DYN2B_TWIST3_LIN_OFFSET], 1,
+            f_p, 1,
+            &w[DYN2B_WRENCH3_ANG_OFFSET], 1);
+}
+
+
+void dyn2b_tf_prox_rbi3(
+        const double *restrict tf,
+        const double *restrict in,
+        double *restrict out)
+{
+    assert(tf);
+    assert(in);
+    assert(out);
+
+    const double m = in[DYN2B_RBI3_M_OFFSET];
+    const double *r = &tf[DYN2B_POSE3_LIN_OFFSET];
+
+    // m' = m
+    out[DYN2B_RBI3_M_OFFSET] = m;
+
+    // h' = R h + m r
+    double rh[DYN2B_RBI3_H_SIZE];
+    dyn2b_krn_gemv3(DYN2B_KRN_NO_TRANS,
+            1.0, &tf[DYN2B_POSE3_ANG_OFFSET],
+            &in[DYN2B_RBI3_H_OFFSET],
+            0.0, rh);
+    for (int i = 0; i < DYN2B_RBI3_H_SIZE; i++) {
+        out[DYN2B_RBI3_H_OFFSET + i] = rh[i] + m * r[i];
+    }
+
+    // I' = R I R^T - rx h'x - (R h)x rx
+    double irt[DYN2B_RBI3_I_SIZE];
+    double rx[9];
+    double hx[9];
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_TRANS,
+            1.0, &in[DYN2B_RBI3_I_OFFSET],
+            &tf[DYN2B_POSE3_ANG_OFFSET],
+            0.0, irt);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            1.0, &tf[DYN2B_POSE3_ANG_OFFSET],
+            irt,
+            0.0, &out[DYN2B_RBI3_I_OFFSET]);
+
+    dyn2b_skw_vec3(r, rx);
+    dyn2b_skw_vec3(&out[DYN2B_RBI3_H_OFFSET], hx);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            -1.0, rx,
+            hx,
+            1.0, &out[DYN2B_RBI3_I_OFFSET]);
+
+    dyn2b_skw_vec3(rh, hx);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            -1.0, hx,
+            rx,
+            1.0, &out[DYN2B_RBI3_I_OFFSET]);
+}
+
+
+void dyn2b_pck_rbi3(
+        const double *restrict in,
+        double *restrict out)
+{
+    assert(in);
+    assert(out);
+
+    dyn2b_krn_pck3p(&in[DYN2B_RBI3_I_OFFSET], &out[DYN2B_RBI3P_I_OFFSET]);
+    memcpy(&out[DYN2B_RBI3P_H_OFFSET], &in[DYN2B_RBI3_H_OFFSET],
+            (DYN2B_RBI3_H_SIZE + DYN2B_RBI3_M_SIZE) * sizeof(double));
+}
+
+
+void dyn2b_unp_rbi3(
+        const double *restrict in,
+        double *restrict out)
+{
+    assert(in);
+    assert(out);
+
+    dyn2b_krn_unp3p(&in[DYN2B_RBI3P_I_OFFSET], &out[DYN2B_RBI3_I_OFFSET]);
+    memcpy(&out[DYN2B_RBI3_H_OFFSET], &in[DYN2B_RBI3P_H_OFFSET],
+            (DYN2B_RBI3P_H_SIZE + DYN2B_RBI3P_M_SIZE) * sizeof(double));
+}
+
+
+void dyn2b_rbi_to_wrench3p(
+        const double *restrict rbi,
+        const double *restrict xdd,
+        double *restrict w)
+{
+    assert(rbi);
+    assert(xdd);
+    assert(w);
+
+    // n = I w + h x v
+    dyn2b_krn_crs3_strided(
+            &rbi[DYN2B_RBI3P_H_OFFSET], 1,
+            &xdd[DYN2B_TWIST3_LIN_OFFSET], 1,
+            &w[DYN2B_WRENCH3_ANG_OFFSET], 1);
+    dyn2b_krn_spmv3(
+            1.0, &rbi[DYN2B_RBI3P_I_OFFSET],
+            &xdd[DYN2B_TWIST3_ANG_OFFSET],
+            1.0, &w[DYN2B_WRENCH3_ANG_OFFSET]);
+
+    // f = m v - h x w
+    //   = m v + w x h
+    dyn2b_krn_crs3_strided(
+            &xdd[DYN2B_TWIST3_ANG_OFFSET], 1,
+            &rbi[DYN2B_RBI3P_H_OFFSET], 1,
+            &w[DYN2B_WRENCH3_LIN_OFFSET], 1);
+    dyn2b_krn_axpy3(
+            rbi[DYN2B_RBI3P_M_OFFSET], &xdd[DYN2B_TWIST3_LIN_OFFSET],
+            &w[DYN2B_WRENCH3_LIN_OFFSET]);
+}
+
+
+void dyn2b_nrt_wrench3p(
+        const double *restrict rbi,
+        const double *restrict xd,
+        double *restrict w)
+{
+    assert(rbi);
+    assert(xd);
+    assert(w);
+
+    double p[DYN2B_SCREW3_SIZE];
+    dyn2b_rbi_to_wrench3p(rbi, xd, p);
+    dyn2b_crs_screw3(xd, p, w);
+}
+
+
+void dyn2b_tf_dist_acc3_dual(
+        const double *restrict x,
+        const double *restrict xd_abs,
+        const double *restrict xd_rel,
+        const double *restrict xdd_prox,
+        double *restrict xdd_dist)
+{
+    assert(x);
+    assert(xd_abs);
+    assert(xd_rel);
+    assert(xdd_prox);
+    assert(xdd_dist);
+
+    // X_{i,i+1} xdd_{0,i} + xd_{0,i+1} x xd_{i,i+1}
+    double crs[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+    dyn2b_tf_dist_screw3_dual(1, x, xdd_prox, xdd_dist);
+    dyn2b_crs_screw3_dual(xd_abs, xd_rel, crs);
+    for (int i = 0; i < DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE); i++) {
+        xdd_dist[i] += crs[i];
+    }
+}
+
+
+void dyn2b_rbi_to_wrench3_dual(
+        const double *restrict rbi,
+        const double *restrict xdd,
+        double *restrict w)
+{
+    assert(rbi);
+    assert(xdd);
+    assert(w);
+
+    const int ld = DYN2B_DUAL_TAN_LD;
+    const double *h = &rbi[DYN2B_RBI3_H_OFFSET];
+    const double m = rbi[DYN2B_RBI3_M_OFFSET];
+    const double *t_xdd = &xdd[DYN2B_DUAL_TAN_OFFSET(DYN2B_TWIST3_SIZE)];
+    double *t_w = &w[DYN2B_DUAL_TAN_OFFSET(DYN2B_WRENCH3_SIZE)];
+
+    dyn2b_rbi_to_wrench3(rbi, xdd, w);
+
+    // The map is linear in the twist, i.e. the tangents map alike
+    DYN2B_KRN_INDEPENDENT
+    for (int k = 0; k < DYN2B_DUAL_K; k++) {
+        // n = I w + h x v
+        dyn2b_krn_crs3_strided(
+                h, 1,
+                &t_xdd[(DYN2B_TWIST3_LIN_OFFSET * ld) + k], ld,
+                &t_w[(DYN2B_WRENCH3_ANG_OFFSET * ld) + k], ld);
+        dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                1.0, &rbi[DYN2B_RBI3_I_OFFSET], 1,
+                &t_xdd[(DYN2B_TWIST3_ANG_OFFSET * ld) + k], ld,
+                1.0, &t_w[(DYN2B_WRENCH3_ANG_OFFSET * ld) + k], ld);
+
+        // f = m v + w x h
+        dyn2b_krn_crs3_strided(
+                &t_xdd[(DYN2B_TWIST3_ANG_OFFSET * ld) + k], ld,
+                h, 1,
+                &t_w[(DYN2B_WRENCH3_LIN_OFFSET * ld) + k], ld);
+        for (int i = 0; i < DYN2B_WRENCH3_LIN_SIZE; i++) {
+            t_w[((DYN2B_WRENCH3_LIN_OFFSET + i) * ld) + k]
+                    += m * t_xdd[((DYN2B_TWIST3_LIN_OFFSET + i) * ld) + k];
+        }
+    }
+}
+
+
+void dyn2b_nrt_wrench3_dual(
+        const double *restrict rbi,
+        const double *restrict xd,
+        double *restrict w)
+{
+    assert(rbi);
+    assert(xd);
+    assert(w);
+
+    double p[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE)];
+    dyn2b_rbi_to_wrench3_dual(rbi, xd, p);
+    dyn2b_crs_screw3_dual(xd, p, w);
+}
+
+
+void dyn2b_eom_wrench3_dual(
+        const double *restrict rbi,
+        const double *restrict xd,
+        const double *restrict xdd,
+        double *restrict w)
+{
+    assert(rbi);
+    assert(xd);
+    assert(xdd);
+    assert(w);
+
+    double a[DYN2B_DUAL_SIZE(DYN2B_WRENCH3_SIZE)];
+    dyn2b_rbi_to_wrench3_dual(rbi, xdd, a);
+    dyn2b_nrt_wrench3_dual(rbi, xd, w);
+    for (int i = 0; i < DYN2B_DUAL_SIZE(DYN2B_WRENCH3_SIZE); i++) {
+        w[i] += a[i];
+    }
+}
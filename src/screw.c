@@ -3,11 +3,14 @@
 #include <dyn2b/functions/vector3.h>
 #include <dyn2b/functions/array.h>
 #include <dyn2b/types/screw.h>
+#include <dyn2b/types/dual.h>
 #include <math.h>
 #include <string.h>
 #include <assert.h>
 #include <cblas.h>
 
+#include "kernel.h"
+
 
 void dyn2b_cmp_pose3(
         const double *restrict x_prox,
@@ -19,18 +22,54 @@ void dyn2b_cmp_pose3(
     assert(x_comp);
 
     // R_p R_d
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, 3, 3,
-            1.0, &x_prox[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            &x_dist[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            0.0, &x_comp[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD);
+    dyn2b_krn_gemm3(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+            1.0, &x_prox[DYN2B_POSE3_ANG_OFFSET],
+            &x_dist[DYN2B_POSE3_ANG_OFFSET],
+            0.0, &x_comp[DYN2B_POSE3_ANG_OFFSET]);
 
     // r_p + R_p r_d
     memcpy(&x_comp[DYN2B_POSE3_LIN_OFFSET], &x_prox[DYN2B_POSE3_LIN_OFFSET],
             DYN2B_POSE3_LIN_SIZE * sizeof(double));
-    cblas_dgemv(CblasColMajor, CblasNoTrans, 3, 3,
-            1.0, &x_prox[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
-            &x_dist[DYN2B_POSE3_LIN_OFFSET], 1,
-            1.0, &x_comp[DYN2B_POSE3_LIN_OFFSET], 1);
+    dyn2b_krn_gemv3(DYN2B_KRN_NO_TRANS,
+            1.0, &x_prox[DYN2B_POSE3_ANG_OFFSET],
+            &x_dist[DYN2B_POSE3_LIN_OFFSET],
+            1.0, &x_comp[DYN2B_POSE3_LIN_OFFSET]);
+}
+
+
+void dyn2b_cmp_pose3_batch(
+        int n,
+        int ld,
+        const double *restrict x_prox,
+        const double *restrict x_dist,
+        double *restrict x_comp)
+{
+    assert(n >= 0);
+    assert(ld >= n);
+    assert(x_prox);
+    assert(x_dist);
+    assert(x_comp);
+
+    DYN2B_KRN_INDEPENDENT
+    for (int i = 0; i < n; i++) {
+        // R_p R_d
+        dyn2b_krn_gemm3_strided(DYN2B_KRN_NO_TRANS, DYN2B_KRN_NO_TRANS,
+                1.0, &x_prox[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld,
+                &x_dist[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld,
+                0.0, &x_comp[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld);
+
+        // r_p + R_p r_d
+        x_comp[((DYN2B_POSE3_LIN_OFFSET + 0) * ld) + i]
+                = x_prox[((DYN2B_POSE3_LIN_OFFSET + 0) * ld) + i];
+        x_comp[((DYN2B_POSE3_LIN_OFFSET + 1) * ld) + i]
+                = x_prox[((DYN2B_POSE3_LIN_OFFSET + 1) * ld) + i];
+        x_comp[((DYN2B_POSE3_LIN_OFFSET + 2) * ld) + i]
+                = x_prox[((DYN2B_POSE3_LIN_OFFSET + 2) * ld) + i];
+        dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                1.0, &x_prox[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld,
+                &x_dist[(DYN2B_POSE3_LIN_OFFSET * ld) + i], ld,
+                1.0, &x_comp[(DYN2B_POSE3_LIN_OFFSET * ld) + i], ld);
+    }
 }
 
 
@@ -132,31 +171,91 @@ void dyn2b_tf_dist_screw3(
         double *restrict s_dist)
 {
     assert(n >= 1);
+
+    double ws[dyn2b_workspace_size_tf_dist_screw3(n)];
+    dyn2b_tf_dist_screw3_ws(n, x, s_prox, s_dist, ws);
+}
+
+
+int dyn2b_workspace_size_tf_dist_screw3(
+        int n)
+{
+    assert(n >= 0);
+
+    return 3 * n;
+}
+
+
+void dyn2b_tf_dist_screw3_ws(
+        int n,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist,
+        double *restrict ws)
+{
+    assert(n >= 1);
     assert(x);
     assert(s_prox);
     assert(s_dist);
+    assert(ws);
 
     // dir_dist[i] = R^T * dir_prox[i]
-    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             &s_prox[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE,
             0.0, &s_dist[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE);
 
     // mom_dist[i] = R^T * (mom_prox[i] - r x dir_prox[i])
     //             = R^T * (mom_prox[i] + dir_prox[i] x r)
-    double tmp[3 * n];
+    double *tmp = ws;
     dyn2b_cad_vec3(n,
             &s_prox[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE,
             &s_prox[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE,
             &x[DYN2B_POSE3_LIN_OFFSET], 0,
             tmp, 3);
-    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             tmp, 3,
             0.0, &s_dist[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE);
 }
 
 
+void dyn2b_tf_dist_screw3_batch(
+        int n,
+        int ld,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist)
+{
+    assert(n >= 0);
+    assert(ld >= n);
+    assert(x);
+    assert(s_prox);
+    assert(s_dist);
+
+    DYN2B_KRN_INDEPENDENT
+    for (int i = 0; i < n; i++) {
+        // dir_dist = R^T * dir_prox
+        dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+                1.0, &x[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld,
+                &s_prox[(DYN2B_SCREW3_DIR_OFFSET * ld) + i], ld,
+                0.0, &s_dist[(DYN2B_SCREW3_DIR_OFFSET * ld) + i], ld);
+
+        // mom_dist = R^T * (mom_prox + dir_prox x r)
+        double tmp[DYN2B_SCREW3_MOM_SIZE];
+        dyn2b_krn_cad3_strided(
+                &s_prox[(DYN2B_SCREW3_MOM_OFFSET * ld) + i], ld,
+                &s_prox[(DYN2B_SCREW3_DIR_OFFSET * ld) + i], ld,
+                &x[(DYN2B_POSE3_LIN_OFFSET * ld) + i], ld,
+                tmp, 1);
+        dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+                1.0, &x[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld,
+                tmp, 1,
+                0.0, &s_dist[(DYN2B_SCREW3_MOM_OFFSET * ld) + i], ld);
+    }
+}
+
+
 void dyn2b_rot_dist_screw3(
         int n,
         const double *restrict x,
@@ -169,14 +268,14 @@ void dyn2b_rot_dist_screw3(
     assert(s_dist);
 
     // dir_dist[i] = R^T * dir_prox[i]
-    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             &s_prox[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE,
             0.0, &s_dist[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE);
 
     // mom_dist[i] = R^T * mom_prox[i]
-    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             &s_prox[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE,
             0.0, &s_dist[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE);
 }
@@ -194,8 +293,8 @@ void dyn2b_tf_prox_screw3(
     assert(s_prox);
 
     // dir_prox[i] = R * dir_dist[i]
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             &s_dist[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE,
             0.0, &s_prox[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE);
 
@@ -205,13 +304,47 @@ void dyn2b_tf_prox_screw3(
             &x[DYN2B_POSE3_LIN_OFFSET], 0,
             &s_prox[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE,
             &s_prox[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE);
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             &s_dist[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE,
             1.0, &s_prox[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE);
 }
 
 
+void dyn2b_tf_prox_screw3_batch(
+        int n,
+        int ld,
+        const double *restrict x,
+        const double *restrict s_dist,
+        double *restrict s_prox)
+{
+    assert(n >= 0);
+    assert(ld >= n);
+    assert(x);
+    assert(s_dist);
+    assert(s_prox);
+
+    DYN2B_KRN_INDEPENDENT
+    for (int i = 0; i < n; i++) {
+        // dir_prox = R * dir_dist
+        dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                1.0, &x[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld,
+                &s_dist[(DYN2B_SCREW3_DIR_OFFSET * ld) + i], ld,
+                0.0, &s_prox[(DYN2B_SCREW3_DIR_OFFSET * ld) + i], ld);
+
+        // mom_prox = R * mom_dist + r x dir_prox
+        dyn2b_krn_crs3_strided(
+                &x[(DYN2B_POSE3_LIN_OFFSET * ld) + i], ld,
+                &s_prox[(DYN2B_SCREW3_DIR_OFFSET * ld) + i], ld,
+                &s_prox[(DYN2B_SCREW3_MOM_OFFSET * ld) + i], ld);
+        dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                1.0, &x[(DYN2B_POSE3_ANG_OFFSET * ld) + i], ld,
+                &s_dist[(DYN2B_SCREW3_MOM_OFFSET * ld) + i], ld,
+                1.0, &s_prox[(DYN2B_SCREW3_MOM_OFFSET * ld) + i], ld);
+    }
+}
+
+
 void dyn2b_rot_prox_screw3(
         int n,
         const double *restrict x,
@@ -224,14 +357,556 @@ void dyn2b_rot_prox_screw3(
     assert(s_prox);
 
     // dir_prox[i] = R * dir_dist[i]
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             &s_dist[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE,
             0.0, &s_prox[DYN2B_SCREW3_DIR_OFFSET], DYN2B_SCREW3_SIZE);
 
     // mom_prox[i] = R * mom_dist[i]
-    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 3, n, 3,
-            1.0, &x[DYN2B_POSE3_ANG_OFFSET], DYN2B_POSE3_ANG_LD,
+    dyn2b_krn_gemm3n(DYN2B_KRN_NO_TRANS, n,
+            1.0, &x[DYN2B_POSE3_ANG_OFFSET],
             &s_dist[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE,
             0.0, &s_prox[DYN2B_SCREW3_MOM_OFFSET], DYN2B_SCREW3_SIZE);
 }
+
+
+void dyn2b_tf_dist_screw3_dq(
+        int n,
+        const double *restrict s_jnt,
+        const double *restrict s_dist,
+        double *restrict out)
+{
+    assert(n >= 1);
+    assert(s_jnt);
+    assert(s_dist);
+    assert(out);
+
+    // d/dq (X^{-1}(q) s) = -S x (X^{-1} s) = s_dist x S
+    for (int i = 0; i < n; i++) {
+        dyn2b_crs_screw3(&s_dist[DYN2B_SCREW3_SIZE * i], s_jnt,
+                &out[DYN2B_SCREW3_SIZE * i]);
+    }
+}
+
+
+void dyn2b_tf_prox_screw3_dq(
+        int n,
+        const double *restrict x,
+        const double *restrict s_jnt,
+        const double *restrict s_dist,
+        double *restrict out)
+{
+    assert(n >= 1);
+    assert(x);
+    assert(s_jnt);
+    assert(s_dist);
+    assert(out);
+
+    // d/dq (X(q) s) = X (S x s)
+    double tmp[DYN2B_SCREW3_SIZE * n];
+    for (int i = 0; i < n; i++) {
+        dyn2b_crs_screw3(s_jnt, &s_dist[DYN2B_SCREW3_SIZE * i],
+                &tmp[DYN2B_SCREW3_SIZE * i]);
+    }
+    dyn2b_tf_prox_screw3(n, x, tmp, out);
+}
+
+
+void dyn2b_to_pose3q(
+        const double *restrict x,
+        double *restrict xq)
+{
+    assert(x);
+    assert(xq);
+
+    // Column-major layout
+    const double *rot = &x[DYN2B_POSE3_ANG_OFFSET];
+    const double r00 = rot[0], r10 = rot[1], r20 = rot[2];
+    const double r01 = rot[3], r11 = rot[4], r21 = rot[5];
+    const double r02 = rot[6], r12 = rot[7], r22 = rot[8];
+    const double tr = r00 + r11 + r22;
+    double *v = &xq[DYN2B_POSE3Q_ANG_OFFSET];
+    double *w = &xq[DYN2B_POSE3Q_ANG_OFFSET + DYN2B_POSE3Q_ANG_W];
+
+    // Divide by the largest of 4 w^2, 4 x^2, 4 y^2 and 4 z^2 (Shepperd) so
+    // that the quotients stay accurate for any rotation
+    if (tr >= r00 && tr >= r11 && tr >= r22) {
+        double t = 2.0 * sqrt(1.0 + tr);
+        *w = 0.25 * t;
+        v[0] = (r21 - r12) / t;
+        v[1] = (r02 - r20) / t;
+        v[2] = (r10 - r01) / t;
+    } else if (r00 >= r11 && r00 >= r22) {
+        double t = 2.0 * sqrt(1.0 + r00 - r11 - r22);
+        *w = (r21 - r12) / t;
+        v[0] = 0.25 * t;
+        v[1] = (r01 + r10) / t;
+        v[2] = (r02 + r20) / t;
+    } else if (r11 >= r22) {
+        double t = 2.0 * sqrt(1.0 + r11 - r00 - r22);
+        *w = (r02 - r20) / t;
+        v[0] = (r01 + r10) / t;
+        v[1] = 0.25 * t;
+        v[2] = (r12 + r21) / t;
+    } else {
+        double t = 2.0 * sqrt(1.0 + r22 - r00 - r11);
+        *w = (r10 - r01) / t;
+        v[0] = (r02 + r20) / t;
+        v[1] = (r12 + r21) / t;
+        v[2] = 0.25 * t;
+    }
+
+    // q and -q are the same rotation
+    if (*w < 0.0) {
+        *w = -*w;
+        v[0] = -v[0];
+        v[1] = -v[1];
+        v[2] = -v[2];
+    }
+
+    memcpy(&xq[DYN2B_POSE3Q_LIN_OFFSET], &x[DYN2B_POSE3_LIN_OFFSET],
+            DYN2B_POSE3_LIN_SIZE * sizeof(double));
+}
+
+
+// Rotation matrix (column-major layout) of a quaternion whose norm may have
+// drifted (cf. dyn2b_to_mat_pose3q())
+static inline void quat_to_rot3(
+        const double *restrict q,
+        double *restrict rot)
+{
+    const double *v = q;
+    const double w = q[DYN2B_POSE3Q_ANG_W];
+    const double s = 2.0 / (v[0] * v[0] + v[1] * v[1] + v[2] * v[2] + w * w);
+    assert(isfinite(s));
+
+    const double xx = s * v[0] * v[0], yy = s * v[1] * v[1];
+    const double zz = s * v[2] * v[2];
+    const double xy = s * v[0] * v[1], xz = s * v[0] * v[2];
+    const double yz = s * v[1] * v[2];
+    const double wx = s * w * v[0], wy = s * w * v[1], wz = s * w * v[2];
+
+    rot[0] = 1.0 - yy - zz; rot[3] = xy - wz;       rot[6] = xz + wy;
+    rot[1] = xy + wz;       rot[4] = 1.0 - xx - zz; rot[7] = yz - wx;
+    rot[2] = xz - wy;       rot[5] = yz + wx;       rot[8] = 1.0 - xx - yy;
+}
+
+
+void dyn2b_to_mat_pose3q(
+        const double *restrict xq,
+        double *restrict x)
+{
+    assert(xq);
+    assert(x);
+
+    quat_to_rot3(&xq[DYN2B_POSE3Q_ANG_OFFSET], &x[DYN2B_POSE3_ANG_OFFSET]);
+    memcpy(&x[DYN2B_POSE3_LIN_OFFSET], &xq[DYN2B_POSE3Q_LIN_OFFSET],
+            DYN2B_POSE3_LIN_SIZE * sizeof(double));
+}
+
+
+void dyn2b_cmp_pose3q(
+        const double *restrict x_prox,
+        const double *restrict x_dist,
+        double *restrict x_comp)
+{
+    assert(x_prox);
+    assert(x_dist);
+    assert(x_comp);
+
+    const double *vp = &x_prox[DYN2B_POSE3Q_ANG_OFFSET];
+    const double *vd = &x_dist[DYN2B_POSE3Q_ANG_OFFSET];
+    const double wp = vp[DYN2B_POSE3Q_ANG_W];
+    const double wd = vd[DYN2B_POSE3Q_ANG_W];
+    const double *rp = &x_prox[DYN2B_POSE3Q_LIN_OFFSET];
+    const double *rd = &x_dist[DYN2B_POSE3Q_LIN_OFFSET];
+    double *vc = &x_comp[DYN2B_POSE3Q_ANG_OFFSET];
+    double *rc = &x_comp[DYN2B_POSE3Q_LIN_OFFSET];
+
+    // q_p q_d = (w_p v_d + w_d v_p + v_p x v_d, w_p w_d - v_p . v_d)
+    vc[0] = wp * vd[0] + wd * vp[0] + vp[1] * vd[2] - vp[2] * vd[1];
+    vc[1] = wp * vd[1] + wd * vp[1] + vp[2] * vd[0] - vp[0] * vd[2];
+    vc[2] = wp * vd[2] + wd * vp[2] + vp[0] * vd[1] - vp[1] * vd[0];
+    vc[DYN2B_POSE3Q_ANG_W] = wp * wd
+            - vp[0] * vd[0] - vp[1] * vd[1] - vp[2] * vd[2];
+
+    // r_p + q_p r_d q_p^* = r_p + r_d + w_p t + v_p x t with t = 2 v_p x r_d
+    const double t[3] = {
+        2.0 * (vp[1] * rd[2] - vp[2] * rd[1]),
+        2.0 * (vp[2] * rd[0] - vp[0] * rd[2]),
+        2.0 * (vp[0] * rd[1] - vp[1] * rd[0])
+    };
+    rc[0] = rp[0] + rd[0] + wp * t[0] + vp[1] * t[2] - vp[2] * t[1];
+    rc[1] = rp[1] + rd[1] + wp * t[1] + vp[2] * t[0] - vp[0] * t[2];
+    rc[2] = rp[2] + rd[2] + wp * t[2] + vp[0] * t[1] - vp[1] * t[0];
+}
+
+
+void dyn2b_nrm_pose3q(
+        double *restrict xq)
+{
+    assert(xq);
+
+    double *q = &xq[DYN2B_POSE3Q_ANG_OFFSET];
+    const double n2 = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+    assert(n2 > 0.0);
+
+    const double s = 1.0 / sqrt(n2);
+    for (int i = 0; i < DYN2B_POSE3Q_ANG_SIZE; i++) {
+        q[i] *= s;
+    }
+}
+
+
+// The rotation matrix of dyn2b_to_mat_pose3q() stays in local variables instead
+// of going through a matrix pose in memory: for a single screw the stores and
+// reloads would cost more than the transformation itself, for more screws the
+// matrix pose's kernels win (cf. screw.h)
+void dyn2b_tf_dist_screw3q(
+        int n,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist)
+{
+    assert(n >= 1);
+    assert(x);
+    assert(s_prox);
+    assert(s_dist);
+
+    double rot[9];
+    quat_to_rot3(&x[DYN2B_POSE3Q_ANG_OFFSET], rot);
+    const double *r = &x[DYN2B_POSE3Q_LIN_OFFSET];
+
+    for (int i = 0; i < n; i++) {
+        const double *d = &s_prox[(DYN2B_SCREW3_SIZE * i)
+                                  + DYN2B_SCREW3_DIR_OFFSET];
+        const double *m = &s_prox[(DYN2B_SCREW3_SIZE * i)
+                                  + DYN2B_SCREW3_MOM_OFFSET];
+        double *d_dist = &s_dist[(DYN2B_SCREW3_SIZE * i)
+                                 + DYN2B_SCREW3_DIR_OFFSET];
+        double *m_dist = &s_dist[(DYN2B_SCREW3_SIZE * i)
+                                 + DYN2B_SCREW3_MOM_OFFSET];
+
+        // dir_dist = R^T dir_prox, mom_dist = R^T (mom_prox - r x dir_prox)
+        const double u[3] = {
+            m[0] - (r[1] * d[2] - r[2] * d[1]),
+            m[1] - (r[2] * d[0] - r[0] * d[2]),
+            m[2] - (r[0] * d[1] - r[1] * d[0])
+        };
+        for (int k = 0; k < 3; k++) {
+            const double *rot_k = &rot[DYN2B_POSE3_ANG_LD * k];
+            d_dist[k] = rot_k[0] * d[0] + rot_k[1] * d[1] + rot_k[2] * d[2];
+            m_dist[k] = rot_k[0] * u[0] + rot_k[1] * u[1] + rot_k[2] * u[2];
+        }
+    }
+}
+
+
+void dyn2b_tf_prox_screw3q(
+        int n,
+        const double *restrict x,
+        const double *restrict s_dist,
+        double *restrict s_prox)
+{
+    assert(n >= 1);
+    assert(x);
+    assert(s_dist);
+    assert(s_prox);
+
+    double rot[9];
+    quat_to_rot3(&x[DYN2B_POSE3Q_ANG_OFFSET], rot);
+    const double *r = &x[DYN2B_POSE3Q_LIN_OFFSET];
+
+    for (int i = 0; i < n; i++) {
+        const double *d = &s_dist[(DYN2B_SCREW3_SIZE * i)
+                                  + DYN2B_SCREW3_DIR_OFFSET];
+        const double *m = &s_dist[(DYN2B_SCREW3_SIZE * i)
+                                  + DYN2B_SCREW3_MOM_OFFSET];
+        double *d_prox = &s_prox[(DYN2B_SCREW3_SIZE * i)
+                                 + DYN2B_SCREW3_DIR_OFFSET];
+        double *m_prox = &s_prox[(DYN2B_SCREW3_SIZE * i)
+                                 + DYN2B_SCREW3_MOM_OFFSET];
+
+        // dir_prox = R dir_dist, mom_prox = R mom_dist + r x dir_prox
+        double rd[3];
+        double rm[3];
+        for (int k = 0; k < 3; k++) {
+            rd[k] = rot[k] * d[0] + rot[3 + k] * d[1] + rot[6 + k] * d[2];
+            rm[k] = rot[k] * m[0] + rot[3 + k] * m[1] + rot[6 + k] * m[2];
+        }
+        d_prox[0] = rd[0];
+        d_prox[1] = rd[1];
+        d_prox[2] = rd[2];
+        m_prox[0] = rm[0] + r[1] * rd[2] - r[2] * rd[1];
+        m_prox[1] = rm[1] + r[2] * rd[0] - r[0] * rd[2];
+        m_prox[2] = rm[2] + r[0] * rd[1] - r[1] * rd[0];
+    }
+}
+
+
+// out = beta * out + s1 x s2 (cf. dyn2b_crs_screw3()) with entries that are
+// inc1, inc2, inc_o apart
+static inline void crs_screw3_strided(
+        double beta,
+        const double *restrict s1,
+        int inc1,
+        const double *restrict s2,
+        int inc2,
+        double *restrict out,
+        int inc_o)
+{
+    const double *d1 = &s1[DYN2B_SCREW3_DIR_OFFSET * inc1];
+    const double *m1 = &s1[DYN2B_SCREW3_MOM_OFFSET * inc1];
+    const double *d2 = &s2[DYN2B_SCREW3_DIR_OFFSET * inc2];
+    const double *m2 = &s2[DYN2B_SCREW3_MOM_OFFSET * inc2];
+
+    // dir_out = dir_1 x dir_2
+    double dir[DYN2B_SCREW3_DIR_SIZE];
+    dyn2b_krn_crs3_strided(d1, inc1, d2, inc2, dir, 1);
+
+    // mom_out = dir_1 x mom_2 + mom_1 x dir_2
+    double tmp[DYN2B_SCREW3_MOM_SIZE];
+    double mom[DYN2B_SCREW3_MOM_SIZE];
+    dyn2b_krn_crs3_strided(d1, inc1, m2, inc2, tmp, 1);
+    dyn2b_krn_cad3_strided(tmp, 1, m1, inc1, d2, inc2, mom, 1);
+
+    double *d_o = &out[DYN2B_SCREW3_DIR_OFFSET * inc_o];
+    double *m_o = &out[DYN2B_SCREW3_MOM_OFFSET * inc_o];
+    if (beta == 0.0) {
+        for (int i = 0; i < 3; i++) {
+            d_o[i * inc_o] = dir[i];
+            m_o[i * inc_o] = mom[i];
+        }
+    } else {
+        for (int i = 0; i < 3; i++) {
+            d_o[i * inc_o] = dir[i] + beta * d_o[i * inc_o];
+            m_o[i * inc_o] = mom[i] + beta * m_o[i * inc_o];
+        }
+    }
+}
+
+
+void dyn2b_cmp_pose3_dual(
+        const double *restrict x_prox,
+        const double *restrict x_dist,
+        double *restrict x_comp)
+{
+    assert(x_prox);
+    assert(x_dist);
+    assert(x_comp);
+
+    const int ld = DYN2B_DUAL_TAN_LD;
+    const double *t_prox = &x_prox[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE)];
+    const double *t_dist = &x_dist[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE)];
+    double *t_comp = &x_comp[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE)];
+
+    dyn2b_cmp_pose3(x_prox, x_dist, x_comp);
+
+    // Entry-wise product rule so that the innermost loops run over the
+    // contiguous tangents (instead of calling the strided 3x3 kernels per
+    // tangent twice which the compiler does not inline)
+    const double *r_p = &x_prox[DYN2B_POSE3_ANG_OFFSET];
+    const double *r_d = &x_dist[DYN2B_POSE3_ANG_OFFSET];
+    const double *p_d = &x_dist[DYN2B_POSE3_LIN_OFFSET];
+    const double *dr_p = &t_prox[DYN2B_POSE3_ANG_OFFSET * ld];
+    const double *dr_d = &t_dist[DYN2B_POSE3_ANG_OFFSET * ld];
+    const double *dp_d = &t_dist[DYN2B_POSE3_LIN_OFFSET * ld];
+
+    // dR_c = dR_p R_d + R_p dR_d
+    for (int c = 0; c < 3; c++) {
+        for (int r = 0; r < 3; r++) {
+            double *out = &t_comp[(DYN2B_POSE3_ANG_OFFSET + (3 * c) + r) * ld];
+            for (int k = 0; k < DYN2B_DUAL_K; k++) {
+                out[k] = 0.0;
+            }
+            for (int i = 0; i < 3; i++) {
+                const double a = r_d[(3 * c) + i];
+                const double b = r_p[(3 * i) + r];
+                const double *da = &dr_p[((3 * i) + r) * ld];
+                const double *db = &dr_d[((3 * c) + i) * ld];
+                for (int k = 0; k < DYN2B_DUAL_K; k++) {
+                    out[k] += da[k] * a + b * db[k];
+                }
+            }
+        }
+    }
+
+    // dr_c = dr_p + dR_p r_d + R_p dr_d
+    for (int r = 0; r < DYN2B_POSE3_LIN_SIZE; r++) {
+        double *out = &t_comp[(DYN2B_POSE3_LIN_OFFSET + r) * ld];
+        const double *in = &t_prox[(DYN2B_POSE3_LIN_OFFSET + r) * ld];
+        for (int k = 0; k < DYN2B_DUAL_K; k++) {
+            out[k] = in[k];
+        }
+        for (int i = 0; i < 3; i++) {
+            const double a = p_d[i];
+            const double b = r_p[(3 * i) + r];
+            const double *da = &dr_p[((3 * i) + r) * ld];
+            const double *db = &dp_d[i * ld];
+            for (int k = 0; k < DYN2B_DUAL_K; k++) {
+                out[k] += da[k] * a + b * db[k];
+            }
+        }
+    }
+}
+
+
+void dyn2b_crs_screw3_dual(
+        const double *restrict s1,
+        const double *restrict s2,
+        double *restrict out)
+{
+    assert(s1);
+    assert(s2);
+    assert(out);
+
+    const int ld = DYN2B_DUAL_TAN_LD;
+    const double *t1 = &s1[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE)];
+    const double *t2 = &s2[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE)];
+    double *t_out = &out[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE)];
+
+    dyn2b_crs_screw3(s1, s2, out);
+
+    // d(s1 x s2) = ds1 x s2 + s1 x ds2
+    DYN2B_KRN_INDEPENDENT
+    for (int k = 0; k < DYN2B_DUAL_K; k++) {
+        crs_screw3_strided(0.0, &t1[k], ld, s2, 1, &t_out[k], ld);
+        crs_screw3_strided(1.0, s1, 1, &t2[k], ld, &t_out[k], ld);
+    }
+}
+
+
+void dyn2b_tf_dist_screw3_dual(
+        int n,
+        const double *restrict x,
+        const double *restrict s_prox,
+        double *restrict s_dist)
+{
+    assert(n >= 1);
+    assert(x);
+    assert(s_prox);
+    assert(s_dist);
+
+    const int ld = DYN2B_DUAL_TAN_LD;
+    const double *t_x = &x[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE)];
+    const double *t_prox = &s_prox[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE * n)];
+    double *t_dist = &s_dist[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE * n)];
+
+    dyn2b_tf_dist_screw3(n, x, s_prox, s_dist);
+
+    for (int i = 0; i < n; i++) {
+        const double *s = &s_prox[DYN2B_SCREW3_SIZE * i];
+        const double *ts = &t_prox[DYN2B_SCREW3_SIZE * ld * i];
+        double *to = &t_dist[DYN2B_SCREW3_SIZE * ld * i];
+
+        // mom_prox + dir_prox x r
+        double mom[DYN2B_SCREW3_MOM_SIZE];
+        dyn2b_krn_cad3_strided(
+                &s[DYN2B_SCREW3_MOM_OFFSET], 1,
+                &s[DYN2B_SCREW3_DIR_OFFSET], 1,
+                &x[DYN2B_POSE3_LIN_OFFSET], 1,
+                mom, 1);
+
+        DYN2B_KRN_INDEPENDENT
+        for (int k = 0; k < DYN2B_DUAL_K; k++) {
+            // d dir_dist = dR^T dir_prox + R^T d dir_prox
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+                    1.0, &t_x[(DYN2B_POSE3_ANG_OFFSET * ld) + k], ld,
+                    &s[DYN2B_SCREW3_DIR_OFFSET], 1,
+                    0.0, &to[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld);
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+                    1.0, &x[DYN2B_POSE3_ANG_OFFSET], 1,
+                    &ts[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld,
+                    1.0, &to[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld);
+
+            // d mom_dist = dR^T (mom_prox + dir_prox x r)
+            //            + R^T (d mom_prox + d dir_prox x r + dir_prox x dr)
+            double tmp[DYN2B_SCREW3_MOM_SIZE];
+            double dmom[DYN2B_SCREW3_MOM_SIZE];
+            dyn2b_krn_cad3_strided(
+                    &ts[(DYN2B_SCREW3_MOM_OFFSET * ld) + k], ld,
+                    &ts[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld,
+                    &x[DYN2B_POSE3_LIN_OFFSET], 1,
+                    tmp, 1);
+            dyn2b_krn_cad3_strided(
+                    tmp, 1,
+                    &s[DYN2B_SCREW3_DIR_OFFSET], 1,
+                    &t_x[(DYN2B_POSE3_LIN_OFFSET * ld) + k], ld,
+                    dmom, 1);
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+                    1.0, &t_x[(DYN2B_POSE3_ANG_OFFSET * ld) + k], ld,
+                    mom, 1,
+                    0.0, &to[(DYN2B_SCREW3_MOM_OFFSET * ld) + k], ld);
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_TRANS,
+                    1.0, &x[DYN2B_POSE3_ANG_OFFSET], 1,
+                    dmom, 1,
+                    1.0, &to[(DYN2B_SCREW3_MOM_OFFSET * ld) + k], ld);
+        }
+    }
+}
+
+
+void dyn2b_tf_prox_screw3_dual(
+        int n,
+        const double *restrict x,
+        const double *restrict s_dist,
+        double *restrict s_prox)
+{
+    assert(n >= 1);
+    assert(x);
+    assert(s_dist);
+    assert(s_prox);
+
+    const int ld = DYN2B_DUAL_TAN_LD;
+    const double *t_x = &x[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE)];
+    const double *t_dist = &s_dist[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE * n)];
+    double *t_prox = &s_prox[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE * n)];
+
+    dyn2b_tf_prox_screw3(n, x, s_dist, s_prox);
+
+    for (int i = 0; i < n; i++) {
+        const double *s = &s_dist[DYN2B_SCREW3_SIZE * i];
+        const double *dir_prox = &s_prox[(DYN2B_SCREW3_SIZE * i)
+                + DYN2B_SCREW3_DIR_OFFSET];
+        const double *ts = &t_dist[DYN2B_SCREW3_SIZE * ld * i];
+        double *to = &t_prox[DYN2B_SCREW3_SIZE * ld * i];
+
+        DYN2B_KRN_INDEPENDENT
+        for (int k = 0; k < DYN2B_DUAL_K; k++) {
+            // d dir_prox = dR dir_dist + R d dir_dist
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                    1.0, &t_x[(DYN2B_POSE3_ANG_OFFSET * ld) + k], ld,
+                    &s[DYN2B_SCREW3_DIR_OFFSET], 1,
+                    0.0, &to[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld);
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                    1.0, &x[DYN2B_POSE3_ANG_OFFSET], 1,
+                    &ts[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld,
+                    1.0, &to[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld);
+
+            // d mom_prox = dR mom_dist + R d mom_dist
+            //            + dr x dir_prox + r x d dir_prox
+            double tmp[DYN2B_SCREW3_MOM_SIZE];
+            double crs[DYN2B_SCREW3_MOM_SIZE];
+            dyn2b_krn_crs3_strided(
+                    &t_x[(DYN2B_POSE3_LIN_OFFSET * ld) + k], ld,
+                    dir_prox, 1,
+                    tmp, 1);
+            dyn2b_krn_cad3_strided(
+                    tmp, 1,
+                    &x[DYN2B_POSE3_LIN_OFFSET], 1,
+                    &to[(DYN2B_SCREW3_DIR_OFFSET * ld) + k], ld,
+                    crs, 1);
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                    1.0, &t_x[(DYN2B_POSE3_ANG_OFFSET * ld) + k], ld,
+                    &s[DYN2B_SCREW3_MOM_OFFSET], 1,
+                    0.0, &to[(DYN2B_SCREW3_MOM_OFFSET * ld) + k], ld);
+            dyn2b_krn_gemv3_strided(DYN2B_KRN_NO_TRANS,
+                    1.0, &x[DYN2B_POSE3_ANG_OFFSET], 1,
+                    &ts[(DYN2B_SCREW3_MOM_OFFSET * ld) + k], ld,
+                    1.0, &to[(DYN2B_SCREW3_MOM_OFFSET * ld) + k], ld);
+            for (int j = 0; j < DYN2B_SCREW3_MOM_SIZE; j++) {
+                to[((DYN2B_SCREW3_MOM_OFFSET + j) * ld) + k] += crs[j];
+            }
+        }
+    }
+}
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/fk.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/mechanics.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dispatch.h"
+#include "aba_ws.h"
+
+
+int dyn2b_workspace_size_aba(
+        int nb)
+{
+    assert(nb >= 0);
+
+    return ABA_BODY_SIZE * nb;
+}
+
+
+void dyn2b_aba(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict tau,
+        const double *restrict f_ext,
+        double *restrict qdd,
+        double *restrict ws)
+{
+    dyn2b_aba_vel(nb, parent, jnt, axis, x_tree, rbi, q, qd, f_ext, ws);
+    dyn2b_aba_abi(nb, parent, jnt, axis, rbi, d, tau, ws);
+    dyn2b_aba_acc(nb, parent, jnt, axis, xdd_base, qdd, ws);
+}
+
+
+void dyn2b_aba_vel(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict f_ext,
+        double *restrict ws)
+{
+    assert(nb >= 0);
+    assert(parent);
+    assert(jnt);
+    assert(x_tree);
+    assert(rbi);
+    assert(q);
+    assert(qd);
+    assert(ws);
+
+    struct aba_ws w = aba_split(nb, ws);
+    const double xd_base[DYN2B_TWIST3_SIZE] = { 0.0 };
+    const double xdd_zero[DYN2B_TWIST3_SIZE] = { 0.0 };
+
+    // Pose of each body with respect to its parent
+    dyn2b_jnt_cmp_pose3(nb, jnt, axis, x_tree, q, w.x);
+
+    for (int i = 0; i < nb; i++) {
+        int p = parent[i];
+        assert(p >= -1 && p < i);
+        assert(jnt[i] >= DYN2B_JNT_REV_X && jnt[i] <= DYN2B_JNT_TRANS);
+
+        const struct dyn2b_dsp_ops *ops = &dyn2b_dsp_ops[jnt[i]];
+        const double *axis_i = dyn2b_dsp_axis(jnt, axis, i);
+        double *x_i = &w.x[ABA_X_SIZE * i];
+        double *xd_i = &w.xd[ABA_XD_SIZE * i];
+        double *c_i = &w.c[ABA_C_SIZE * i];
+        double *b_i = &w.b[ABA_B_SIZE * i];
+        const double *xd_p = (p < 0) ? xd_base : &w.xd[ABA_XD_SIZE * p];
+
+        // Velocity
+        double xd_rel[DYN2B_TWIST3_SIZE];
+        ops->to_twist3(axis_i, &qd[i], xd_rel);
+        dyn2b_tf_dist_screw3(1, x_i, xd_p, xd_i);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xd_i[k] += xd_rel[k];
+        }
+
+        // Velocity-product acceleration
+        dyn2b_tf_dist_acc3(x_i, xd_i, xd_rel, xdd_zero, c_i);
+
+        // Bias wrench of the body alone
+        dyn2b_nrt_wrench3(&rbi[DYN2B_RBI3_SIZE * i], xd_i, b_i);
+        if (f_ext) {
+            for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+                b_i[k] -= f_ext[(DYN2B_WRENCH3_SIZE * i) + k];
+            }
+        }
+    }
+}
+
+
+void dyn2b_aba_abi(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict tau,
+        double *restrict ws)
+{
+    assert(nb >= 0);
+    assert(parent);
+    assert(jnt);
+    assert(rbi);
+    assert(d);
+    assert(tau);
+    assert(ws);
+
+    struct aba_ws w = aba_split(nb, ws);
+    const double one = 1.0;
+
+    // Start from the bodies alone so that the sweep can be repeated
+    for (int i = 0; i < nb; i++) {
+        dyn2b_to_abi3(&rbi[DYN2B_RBI3_SIZE * i], &w.abi[ABA_ABI_SIZE * i]);
+    }
+    memcpy(w.p, w.b, ABA_P_SIZE * nb * sizeof(double));
+
+    for (int i = nb - 1; i >= 0; i--) {
+        int p = parent[i];
+
+        const struct dyn2b_dsp_ops *ops = &dyn2b_dsp_ops[jnt[i]];
+        const double *axis_i = dyn2b_dsp_axis(jnt, axis, i);
+        const double *abi_i = &w.abi[ABA_ABI_SIZE * i];
+        double *u_i = &w.u[ABA_U_SIZE * i];
+
+        // U = I^A S and D^{-1} = (d + S^T U)^{-1}
+        double s[DYN2B_TWIST3_SIZE];
+        double stu;
+        ops->to_twist3(axis_i, &one, s);
+        dyn2b_abi_to_wrench3(1, abi_i, s, u_i);
+        ops->from_wrench3(1, axis_i, u_i, &stu);
+        w.d_inv[i] = 1.0 / (d[i] + stu);
+
+        // Remaining joint force tau - S^T p^A
+        const double *p_i = &w.p[ABA_P_SIZE * i];
+        double stp;
+        ops->from_wrench3(1, axis_i, p_i, &stp);
+        w.tau_a[i] = tau[i] - stp;
+
+        if (p < 0) {
+            continue;
+        }
+
+        // Apparent inertia and bias wrench:
+        // I^a = P^T I^A
+        // p^a = P^T (p^A + I^A c) + U D^{-1} tau
+        //     = p^A + I^a c + U D^{-1} (tau - S^T p^A)
+        double abi_a[DYN2B_ABI3_SIZE];
+        double b[DYN2B_WRENCH3_SIZE];
+        double p_a[DYN2B_WRENCH3_SIZE];
+        ops->proj_abi3(axis_i, &d[i], abi_i, abi_a);
+        dyn2b_abi_to_wrench3(1, abi_i, &w.c[ABA_C_SIZE * i], b);
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            b[k] += p_i[k];
+        }
+        ops->proj_wrench3(1, axis_i, &d[i], abi_i, b, p_a);
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            p_a[k] += u_i[k] * w.d_inv[i] * tau[i];
+        }
+
+        // Accumulate in the parent
+        double abi_prox[DYN2B_ABI3_SIZE];
+        double p_prox[DYN2B_WRENCH3_SIZE];
+        const double *x_i = &w.x[ABA_X_SIZE * i];
+        dyn2b_tf_prox_abi3(x_i, abi_a, abi_prox);
+        dyn2b_tf_prox_screw3(1, x_i, p_a, p_prox);
+        for (int k = 0; k < DYN2B_ABI3_SIZE; k++) {
+            w.abi[(ABA_ABI_SIZE * p) + k] += abi_prox[k];
+        }
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            w.p[(ABA_P_SIZE * p) + k] += p_prox[k];
+        }
+    }
+}
+
+
+void dyn2b_aba_acc(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict xdd_base,
+        double *restrict qdd,
+        double *restrict ws)
+{
+    assert(nb >= 0);
+    assert(parent);
+    assert(jnt);
+    assert(xdd_base);
+    assert(qdd);
+    assert(ws);
+
+    struct aba_ws w = aba_split(nb, ws);
+
+    for (int i = 0; i < nb; i++) {
+        int p = parent[i];
+
+        const struct dyn2b_dsp_ops *ops = &dyn2b_dsp_ops[jnt[i]];
+        const double *u_i = &w.u[ABA_U_SIZE * i];
+        const double *c_i = &w.c[ABA_C_SIZE * i];
+        double *xdd_i = &w.xdd[ABA_XDD_SIZE * i];
+        const double *xdd_p = (p < 0) ? xdd_base : &w.xdd[ABA_XDD_SIZE * p];
+
+        // Acceleration without the joint's contribution
+        dyn2b_tf_dist_screw3(1, &w.x[ABA_X_SIZE * i], xdd_p, xdd_i);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xdd_i[k] += c_i[k];
+        }
+
+        // qdd = D^{-1} (tau - S^T p^A - U^T xdd)
+        // Note: U (linear-before-angular) vs. xdd (angular-before-linear)
+        double uxdd = 0.0;
+        for (int k = 0; k < 3; k++) {
+            uxdd += u_i[DYN2B_WRENCH3_LIN_OFFSET + k]
+                    * xdd_i[DYN2B_TWIST3_LIN_OFFSET + k];
+            uxdd += u_i[DYN2B_WRENCH3_ANG_OFFSET + k]
+                    * xdd_i[DYN2B_TWIST3_ANG_OFFSET + k];
+        }
+        qdd[i] = w.d_inv[i] * (w.tau_a[i] - uxdd);
+
+        // Add the joint's contribution
+        double xdd_rel[DYN2B_TWIST3_SIZE];
+        ops->to_twist3(dyn2b_dsp_axis(jnt, axis, i), &qdd[i], xdd_rel);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xdd_i[k] += xdd_rel[k];
+        }
+    }
+}
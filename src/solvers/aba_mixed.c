@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/aba_mixed.h>
+#include <dyn2b/solvers/abaf.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/screwf.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dispatch.h"
+#include "aba_wsf.h"
+
+
+static inline void to_dbl(
+        int n,
+        const float *restrict in,
+        double *restrict out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = in[i];
+    }
+}
+
+
+// Axis of joint i in double precision (cf. dyn2b_dsp_axis()): only the
+// arbitrary-axis joints convert it, the axis-aligned joints get NULL.
+static inline const double *axis_to_dbl(
+        const int *restrict jnt,
+        const float *restrict axis,
+        int i,
+        double *restrict out)
+{
+    if (jnt[i] != DYN2B_JNT_REV && jnt[i] != DYN2B_JNT_TRANS) {
+        return NULL;
+    }
+
+    assert(axis);
+    to_dbl(DYN2B_AXIS3_SIZE, &axis[DYN2B_AXIS3_SIZE * i], out);
+    return out;
+}
+
+
+int dyn2b_workspace_size_aba_mixed(
+        int nb)
+{
+    return dyn2b_workspace_size_abaf(nb);
+}
+
+
+int dyn2b_workspace_size_aba_mixed_abi(
+        int nb)
+{
+    assert(nb >= 0);
+
+    return ABA_ABI_SIZE * nb;
+}
+
+
+// Inward sweep of the ABA (cf. dyn2b_aba_abi()) with the articulated-body
+// inertias in double precision. It leaves the single-precision workspace as
+// dyn2b_aba_accf() expects it, except for the unused single-precision
+// inertias.
+static void aba_mixed_abi(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const float *restrict axis,
+        const float *restrict rbi,
+        const float *restrict d,
+        const float *restrict tau,
+        float *restrict ws,
+        double *restrict abi)
+{
+    struct aba_ws w = aba_split(nb, ws);
+    const double one = 1.0;
+
+    // Start from the bodies alone
+    for (int i = 0; i < nb; i++) {
+        double rbi_i[DYN2B_RBI3_SIZE];
+        to_dbl(DYN2B_RBI3_SIZE, &rbi[DYN2B_RBI3_SIZE * i], rbi_i);
+        dyn2b_to_abi3(rbi_i, &abi[ABA_ABI_SIZE * i]);
+    }
+    memcpy(w.p, w.b, ABA_P_SIZE * nb * sizeof(float));
+
+    for (int i = nb - 1; i >= 0; i--) {
+        int p = parent[i];
+
+        const struct dyn2b_dsp_ops *ops = &dyn2b_dsp_ops[jnt[i]];
+        const double *abi_i = &abi[ABA_ABI_SIZE * i];
+        const double d_i = d[i];
+        double axis_d[DYN2B_AXIS3_SIZE];
+        const double *axis_i = axis_to_dbl(jnt, axis, i, axis_d);
+        double p_i[DYN2B_WRENCH3_SIZE];
+        to_dbl(DYN2B_WRENCH3_SIZE, &w.p[ABA_P_SIZE * i], p_i);
+
+        // U = I^A S and D^{-1} = (d + S^T U)^{-1}
+        double s[DYN2B_TWIST3_SIZE];
+        double u[DYN2B_WRENCH3_SIZE];
+        double stu;
+        ops->to_twist3(axis_i, &one, s);
+        dyn2b_abi_to_wrench3(1, abi_i, s, u);
+        ops->from_wrench3(1, axis_i, u, &stu);
+        const double d_inv = 1.0 / (d_i + stu);
+        w.d_inv[i] = (float)d_inv;
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            w.u[(ABA_U_SIZE * i) + k] = (float)u[k];
+        }
+
+        // Remaining joint force tau - S^T p^A
+        double stp;
+        ops->from_wrench3(1, axis_i, p_i, &stp);
+        w.tau_a[i] = (float)(tau[i] - stp);
+
+        if (p < 0) {
+            continue;
+        }
+
+        // Apparent inertia and bias wrench (cf. dyn2b_aba_abi())
+        double abi_a[DYN2B_ABI3_SIZE];
+        double c_i[DYN2B_TWIST3_SIZE];
+        double b[DYN2B_WRENCH3_SIZE];
+        double p_a[DYN2B_WRENCH3_SIZE];
+        float p_af[DYN2B_WRENCH3_SIZE];
+        ops->proj_abi3(axis_i, &d_i, abi_i, abi_a);
+        to_dbl(DYN2B_TWIST3_SIZE, &w.c[ABA_C_SIZE * i], c_i);
+        dyn2b_abi_to_wrench3(1, abi_i, c_i, b);
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            b[k] += p_i[k];
+        }
+        ops->proj_wrench3(1, axis_i, &d_i, abi_i, b, p_a);
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            p_af[k] = (float)(p_a[k] + u[k] * d_inv * tau[i]);
+        }
+
+        // Accumulate in the parent: the inertia in double, the wrench in float
+        double x_i[DYN2B_POSE3_SIZE];
+        double abi_prox[DYN2B_ABI3_SIZE];
+        float p_prox[DYN2B_WRENCH3_SIZE];
+        to_dbl(DYN2B_POSE3_SIZE, &w.x[ABA_X_SIZE * i], x_i);
+        dyn2b_tf_prox_abi3(x_i, abi_a, abi_prox);
+        dyn2b_tf_prox_screw3f(1, &w.x[ABA_X_SIZE * i], p_af, p_prox);
+        for (int k = 0; k < DYN2B_ABI3_SIZE; k++) {
+            abi[(ABA_ABI_SIZE * p) + k] += abi_prox[k];
+        }
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            w.p[(ABA_P_SIZE * p) + k] += p_prox[k];
+        }
+    }
+}
+
+
+void dyn2b_aba_mixed(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const float *restrict axis,
+        const float *restrict x_tree,
+        const float *restrict rbi,
+        const float *restrict d,
+        const float *restrict xdd_base,
+        const float *restrict q,
+        const float *restrict qd,
+        const float *restrict tau,
+        const float *restrict f_ext,
+        float *restrict qdd,
+        float *restrict ws,
+        double *restrict ws_abi)
+{
+    assert(d);
+    assert(tau);
+    assert(ws_abi);
+
+    dyn2b_aba_velf(nb, parent, jnt, axis, x_tree, rbi, q, qd, f_ext, ws);
+    aba_mixed_abi(nb, parent, jnt, axis, rbi, d, tau, ws, ws_abi);
+    dyn2b_aba_accf(nb, parent, jnt, axis, xdd_base, qdd, ws);
+}
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_ABA_WS_H
+#define DYN2B_SOLVERS_ABA_WS_H
+
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+
+/*
+ * Layout of the ABA workspace. It is shared with the solvers that extend the
+ * ABA's sweeps (e.g. the ACHD) and place their own quantities after it.
+ */
+
+// Per-body quantities in the workspace
+#define ABA_X_SIZE     DYN2B_POSE3_SIZE     // pose w.r.t. the parent
+#define ABA_XD_SIZE    DYN2B_TWIST3_SIZE    // velocity
+#define ABA_C_SIZE     DYN2B_TWIST3_SIZE    // velocity-product acceleration
+#define ABA_ABI_SIZE   DYN2B_ABI3_SIZE      // articulated-body inertia
+#define ABA_B_SIZE     DYN2B_WRENCH3_SIZE   // bias wrench of the body alone
+#define ABA_P_SIZE     DYN2B_WRENCH3_SIZE   // articulated-body bias wrench
+#define ABA_U_SIZE     DYN2B_WRENCH3_SIZE   // U = I^A S
+#define ABA_XDD_SIZE   DYN2B_TWIST3_SIZE    // acceleration
+#define ABA_BODY_SIZE  (ABA_X_SIZE + ABA_XD_SIZE + ABA_C_SIZE + ABA_ABI_SIZE \
+                        + ABA_B_SIZE + ABA_P_SIZE + ABA_U_SIZE + ABA_XDD_SIZE \
+                        + 2)
+
+struct aba_ws {
+    double *x;
+    double *xd;
+    double *c;
+    double *abi;
+    double *b;
+    double *p;
+    double *u;
+    double *xdd;
+    double *d_inv;      // D^{-1} = (d + S^T U)^{-1}
+    double *tau_a;      // tau - S^T p^A
+};
+
+
+static inline struct aba_ws aba_split(
+        int nb,
+        double *ws)
+{
+    struct aba_ws w;
+    w.x = ws;
+    w.xd = &w.x[ABA_X_SIZE * nb];
+    w.c = &w.xd[ABA_XD_SIZE * nb];
+    w.abi = &w.c[ABA_C_SIZE * nb];
+    w.b = &w.abi[ABA_ABI_SIZE * nb];
+    w.p = &w.b[ABA_B_SIZE * nb];
+    w.u = &w.p[ABA_P_SIZE * nb];
+    w.xdd = &w.u[ABA_U_SIZE * nb];
+    w.d_inv = &w.xdd[ABA_XDD_SIZE * nb];
+    w.tau_a = &w.d_inv[nb];
+
+    return w;
+}
+
+#endif
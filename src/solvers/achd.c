@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/achd.h>
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/matrix.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/joint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dispatch.h"
+#include "aba_ws.h"
+
+
+// Quantities in the workspace after the ABA's workspace
+struct achd_ws {
+    double *e;          // unit constraint wrenches of each body [6 x nc]
+    double *ste;        // S^T E of each body [1 x nc]
+    double *e_a;        // apparent unit constraint wrenches [6 x nc]
+    double *tmp;        // [6 x nc]
+    double *l;          // constraint coupling matrix [nc x nc]
+    double *fct;        // its factorization / coupling of one body [nc x nc]
+    double *g;          // acceleration energy of the unconstrained motion
+};
+
+
+static struct achd_ws achd_split(
+        int nb,
+        int nc,
+        double *ws)
+{
+    struct achd_ws w;
+    w.e = &ws[ABA_BODY_SIZE * nb];
+    w.ste = &w.e[DYN2B_WRENCH3_SIZE * nc * nb];
+    w.e_a = &w.ste[nc * nb];
+    w.tmp = &w.e_a[DYN2B_WRENCH3_SIZE * nc];
+    w.l = &w.tmp[DYN2B_WRENCH3_SIZE * nc];
+    w.fct = &w.l[nc * nc];
+    w.g = &w.fct[nc * nc];
+
+    return w;
+}
+
+
+int dyn2b_workspace_size_achd(
+        int nb,
+        int nc)
+{
+    assert(nb >= 0);
+    assert(nc >= 0);
+
+    return ABA_BODY_SIZE * nb
+            + (DYN2B_WRENCH3_SIZE + 1) * nc * nb
+            + 2 * DYN2B_WRENCH3_SIZE * nc
+            + 2 * nc * nc
+            + nc;
+}
+
+
+void dyn2b_achd(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict tau,
+        const double *restrict f_ext,
+        int nc,
+        const int *restrict con_body,
+        const double *restrict alpha,
+        const double *restrict beta,
+        double *restrict qdd,
+        double *restrict nu,
+        double *restrict ws)
+{
+    assert(nc >= 0);
+    assert(nc == 0 || (con_body && alpha && beta && nu));
+
+    dyn2b_aba_vel(nb, parent, jnt, axis, x_tree, rbi, q, qd, f_ext, ws);
+    dyn2b_aba_abi(nb, parent, jnt, axis, rbi, d, tau, ws);
+
+    if (nc > 0) {
+        struct aba_ws wa = aba_split(nb, ws);
+        struct achd_ws w = achd_split(nb, nc, ws);
+        const int ne = DYN2B_WRENCH3_SIZE * nc;
+        const double one = 1.0;
+
+        // Each constraint's unit wrench starts at its body
+        memset(w.e, 0, ne * nb * sizeof(double));
+        for (int k = 0; k < nc; k++) {
+            assert(con_body[k] >= 0 && con_body[k] < nb);
+
+            memcpy(&w.e[(ne * con_body[k]) + (DYN2B_WRENCH3_SIZE * k)],
+                    &alpha[DYN2B_WRENCH3_SIZE * k],
+                    DYN2B_WRENCH3_SIZE * sizeof(double));
+        }
+        memset(w.l, 0, nc * nc * sizeof(double));
+        memset(w.g, 0, nc * sizeof(double));
+
+        // Inward sweep of the unit constraint wrenches
+        for (int i = nb - 1; i >= 0; i--) {
+            int p = parent[i];
+
+            const struct dyn2b_dsp_ops *ops = &dyn2b_dsp_ops[jnt[i]];
+            const double *axis_i = dyn2b_dsp_axis(jnt, axis, i);
+            const double *e_i = &w.e[ne * i];
+            double *ste_i = &w.ste[nc * i];
+
+            // Apparent unit constraint wrenches E^a = P^T E
+            ops->from_wrench3(nc, axis_i, e_i, ste_i);
+            ops->proj_wrench3(nc, axis_i, &d[i], &wa.abi[ABA_ABI_SIZE * i],
+                    e_i, w.e_a);
+
+            // Coupling over the joint: L += E^T (S D^{-1} S^T E)
+            double s[DYN2B_TWIST3_SIZE];
+            ops->to_twist3(axis_i, &one, s);
+            for (int k = 0; k < nc; k++) {
+                for (int j = 0; j < DYN2B_TWIST3_SIZE; j++) {
+                    w.tmp[(DYN2B_TWIST3_SIZE * k) + j] =
+                            s[j] * wa.d_inv[i] * ste_i[k];
+                }
+            }
+            dyn2b_dot_screw3(nc, nc, e_i, w.tmp, w.fct);
+            for (int k = 0; k < nc * nc; k++) {
+                w.l[k] += w.fct[k];
+            }
+
+            // Acceleration energy of the unconstrained motion:
+            // g += E^T S D^{-1} (tau - S^T p^A) + E^{aT} (X xdd_p + c)
+            // where the parent's acceleration enters via its bodies' E
+            // except for the base
+            double a[DYN2B_TWIST3_SIZE];
+            memcpy(a, &wa.c[ABA_C_SIZE * i], sizeof(a));
+            if (p < 0) {
+                double a_base[DYN2B_TWIST3_SIZE];
+                dyn2b_tf_dist_screw3(1, &wa.x[ABA_X_SIZE * i], xdd_base,
+                        a_base);
+                for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+                    a[k] += a_base[k];
+                }
+            }
+            dyn2b_dot_screw3(nc, 1, w.e_a, a, w.tmp);
+            for (int k = 0; k < nc; k++) {
+                w.g[k] += w.tmp[k] + (ste_i[k] * wa.d_inv[i] * wa.tau_a[i]);
+            }
+
+            // Accumulate in the parent
+            if (p >= 0) {
+                double *e_p = &w.e[ne * p];
+                dyn2b_tf_prox_screw3(nc, &wa.x[ABA_X_SIZE * i], w.e_a, w.tmp);
+                for (int k = 0; k < ne; k++) {
+                    e_p[k] += w.tmp[k];
+                }
+            }
+        }
+
+        // Constraint magnitudes: L nu = beta - g
+        for (int k = 0; k < nc; k++) {
+            w.g[k] = beta[k] - w.g[k];
+        }
+        dyn2b_ldl_fct_mat(nc, w.l, nc, w.fct);
+        dyn2b_ldl_slv_mat(nc, 1, w.fct, w.g, nc, nu, nc);
+
+        // Joint forces that the constraint wrenches cause: S^T E nu
+        for (int i = 0; i < nb; i++) {
+            const double *ste_i = &w.ste[nc * i];
+            for (int k = 0; k < nc; k++) {
+                wa.tau_a[i] += ste_i[k] * nu[k];
+            }
+        }
+    }
+
+    dyn2b_aba_acc(nb, parent, jnt, axis, xdd_base, qdd, ws);
+}
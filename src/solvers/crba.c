@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/crba.h>
+#include <dyn2b/solvers/fk.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/mechanics.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dispatch.h"
+
+
+int dyn2b_workspace_size_crba(
+        int nb)
+{
+    assert(nb >= 0);
+
+    // Pose and composite inertia of each body
+    return (DYN2B_POSE3_SIZE + DYN2B_RBI3_SIZE) * nb;
+}
+
+
+void dyn2b_crba(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict d,
+        const double *restrict q,
+        double *restrict h,
+        double *restrict ws)
+{
+    assert(nb >= 0);
+    assert(parent);
+    assert(jnt);
+    assert(x_tree);
+    assert(rbi);
+    assert(d);
+    assert(q);
+    assert(h);
+    assert(ws);
+
+    double *x = ws;
+    double *ic = &x[DYN2B_POSE3_SIZE * nb];
+    const double one = 1.0;
+
+    // Pose of each body with respect to its parent
+    dyn2b_jnt_cmp_pose3(nb, jnt, axis, x_tree, q, x);
+
+    memcpy(ic, rbi, DYN2B_RBI3_SIZE * nb * sizeof(double));
+    memset(h, 0, nb * nb * sizeof(double));
+
+    // Inward sweep: composite inertias and the rows/columns of H
+    for (int i = nb - 1; i >= 0; i--) {
+        int p = parent[i];
+        const double *ic_i = &ic[DYN2B_RBI3_SIZE * i];
+        const double *axis_i = dyn2b_dsp_axis(jnt, axis, i);
+
+        if (p >= 0) {
+            double ic_prox[DYN2B_RBI3_SIZE];
+            dyn2b_tf_prox_rbi3(&x[DYN2B_POSE3_SIZE * i], ic_i, ic_prox);
+            for (int k = 0; k < DYN2B_RBI3_SIZE; k++) {
+                ic[(DYN2B_RBI3_SIZE * p) + k] += ic_prox[k];
+            }
+        }
+
+        // F = I^c S and H_ii = S^T F + d
+        double s[DYN2B_TWIST3_SIZE];
+        double f[DYN2B_WRENCH3_SIZE];
+        dyn2b_dsp_ops[jnt[i]].to_twist3(axis_i, &one, s);
+        dyn2b_rbi_to_wrench3(ic_i, s, f);
+        dyn2b_dsp_ops[jnt[i]].from_wrench3(1, axis_i, f, &h[(nb * i) + i]);
+        h[(nb * i) + i] += d[i];
+
+        // H_ij = H_ji = S_j^T X_j^* ... F for all ancestors j
+        for (int j = i; parent[j] >= 0; j = parent[j]) {
+            double f_prox[DYN2B_WRENCH3_SIZE];
+            dyn2b_tf_prox_screw3(1, &x[DYN2B_POSE3_SIZE * j], f, f_prox);
+            memcpy(f, f_prox, sizeof(f));
+
+            int a = parent[j];
+            dyn2b_dsp_ops[jnt[a]].from_wrench3(1, dyn2b_dsp_axis(jnt, axis, a),
+                    f, &h[(nb * i) + a]);
+            h[(nb * a) + i] = h[(nb * i) + a];
+        }
+    }
+}
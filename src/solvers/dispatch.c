@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/solvers/tree.h>
+
+#include "dispatch.h"
+
+
+// Adapt the axis-aligned joints to the signature of the arbitrary-axis joints
+#define DYN2B_DSP_ALIGNED(jnt, type, k) \
+    static void jnt##_to_twist3( \
+            const double *restrict axis, \
+            const double *restrict q, \
+            double *restrict cart) \
+    { \
+        (void)axis; \
+        dyn2b_##jnt##_to_twist3(q, cart); \
+    } \
+    \
+    static void jnt##_from_wrench3( \
+            int n, \
+            const double *restrict axis, \
+            const double *restrict cart, \
+            double *restrict q) \
+    { \
+        (void)axis; \
+        dyn2b_##jnt##_from_wrench3(n, cart, q); \
+    } \
+    \
+    static void jnt##_proj_abi3( \
+            const double *restrict axis, \
+            const double *restrict d, \
+            const double *restrict m_in, \
+            double *restrict m_out) \
+    { \
+        (void)axis; \
+        dyn2b_##jnt##_proj_abi3(d, m_in, m_out); \
+    } \
+    \
+    static void jnt##_proj_wrench3( \
+            int n, \
+            const double *restrict axis, \
+            const double *restrict d, \
+            const double *restrict m, \
+            const double *restrict f_in, \
+            double *restrict f_out) \
+    { \
+        (void)axis; \
+        dyn2b_##jnt##_proj_wrench3(n, d, m, f_in, f_out); \
+    }
+
+DYN2B_JNT_ALIGNED(DYN2B_DSP_ALIGNED)
+
+// The arbitrary-axis joints already have the signature but are wrapped as well
+// so that the table refers to functions of the same precision (cf. float.cmake)
+#define DYN2B_DSP_GENERIC(jnt) \
+    static void jnt##_to_twist3( \
+            const double *restrict axis, \
+            const double *restrict q, \
+            double *restrict cart) \
+    { \
+        dyn2b_##jnt##_to_twist3(axis, q, cart); \
+    } \
+    \
+    static void jnt##_from_wrench3( \
+            int n, \
+            const double *restrict axis, \
+            const double *restrict cart, \
+            double *restrict q) \
+    { \
+        dyn2b_##jnt##_from_wrench3(n, axis, cart, q); \
+    } \
+    \
+    static void jnt##_proj_abi3( \
+            const double *restrict axis, \
+            const double *restrict d, \
+            const double *restrict m_in, \
+            double *restrict m_out) \
+    { \
+        dyn2b_##jnt##_proj_abi3(axis, d, m_in, m_out); \
+    } \
+    \
+    static void jnt##_proj_wrench3( \
+            int n, \
+            const double *restrict axis, \
+            const double *restrict d, \
+            const double *restrict m, \
+            const double *restrict f_in, \
+            double *restrict f_out) \
+    { \
+        dyn2b_##jnt##_proj_wrench3(n, axis, d, m, f_in, f_out); \
+    }
+
+DYN2B_DSP_GENERIC(rev)
+DYN2B_DSP_GENERIC(trans)
+
+#define DYN2B_DSP_OPS(jnt) \
+    { \
+        jnt##_to_twist3, \
+        jnt##_from_wrench3, \
+        jnt##_proj_abi3, \
+        jnt##_proj_wrench3 \
+    }
+
+
+const struct dyn2b_dsp_ops dyn2b_dsp_ops[] = {
+    [DYN2B_JNT_REV_X] = DYN2B_DSP_OPS(rev_x),
+    [DYN2B_JNT_REV_Y] = DYN2B_DSP_OPS(rev_y),
+    [DYN2B_JNT_REV_Z] = DYN2B_DSP_OPS(rev_z),
+    [DYN2B_JNT_TRANS_X] = DYN2B_DSP_OPS(trans_x),
+    [DYN2B_JNT_TRANS_Y] = DYN2B_DSP_OPS(trans_y),
+    [DYN2B_JNT_TRANS_Z] = DYN2B_DSP_OPS(trans_z),
+    [DYN2B_JNT_REV] = DYN2B_DSP_OPS(rev),
+    [DYN2B_JNT_TRANS] = DYN2B_DSP_OPS(trans)
+};
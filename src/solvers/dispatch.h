@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_SOLVERS_DISPATCH_H
+#define DYN2B_SOLVERS_DISPATCH_H
+
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/types/joint.h>
+#include <stddef.h>
+#include <assert.h>
+
+/*
+ * Joint-specific operators of each joint type (cf. tree.h). The joint types
+ * of a tree are fixed when the tree is described, so that the solvers look up
+ * the operators in a constant table instead of branching on the joint type for
+ * every operator. The lookup is a single indexed load per joint and sweep;
+ * resolving the entries once per tree would need a model object which the
+ * flat-array description of tree.h deliberately does not have, and the
+ * indirect calls remain either way.
+ *
+ * All entries share the signature of the arbitrary-axis joints; the
+ * axis-aligned joints ignore the axis. The joint poses are not part of the
+ * table since the solvers compute them for all joints at once (cf.
+ * dyn2b_jnt_cmp_pose3()).
+ */
+struct dyn2b_dsp_ops {
+    void (*to_twist3)(
+            const double *restrict axis,
+            const double *restrict jnt,
+            double *restrict cart);
+    void (*from_wrench3)(
+            int n,
+            const double *restrict axis,
+            const double *restrict cart,
+            double *restrict jnt);
+    void (*proj_abi3)(
+            const double *restrict axis,
+            const double *restrict d,
+            const double *restrict m_in,
+            double *restrict m_out);
+    void (*proj_wrench3)(
+            int n,
+            const double *restrict axis,
+            const double *restrict d,
+            const double *restrict m,
+            const double *restrict f_in,
+            double *restrict f_out);
+};
+
+
+// Indexed by the joint type
+extern const struct dyn2b_dsp_ops dyn2b_dsp_ops[];
+
+
+// Axis of joint i for the table's operators. Only the arbitrary-axis joints
+// read it and the axes may be NULL for trees without such joints (cf.
+// tree.h), so the axis-aligned joints get NULL.
+static inline const double *dyn2b_dsp_axis(
+        const int *restrict jnt,
+        const double *restrict axis,
+        int i)
+{
+    if (jnt[i] != DYN2B_JNT_REV && jnt[i] != DYN2B_JNT_TRANS) {
+        return NULL;
+    }
+
+    assert(axis);
+    return &axis[DYN2B_AXIS3_SIZE * i];
+}
+
+#endif
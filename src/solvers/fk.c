@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: LGPL-3.0
+// The sparse compositions of the axis-aligned joints are inlined (cf.
+// dyn2b/inline/api.h)
+#define DYN2B_INLINE
+#include <dyn2b/solvers/fk.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/types/vector3.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/joint.h>
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+
+// Number of joints whose sines and cosines are evaluated in one pass
+#define FK_CHUNK 64
+
+// Largest joint position of the polynomial sine and cosine (cf. fk.h). The
+// first two parts of pi/2 below have 12 significant bits, so that their
+// products with the quadrant n are exact for |n| < 2^12 even in single
+// precision.
+#define FK_SINCOS_MAX 4096.0
+
+// Round to the nearest integer. With SSE4.1 rint() vectorizes (roundpd),
+// otherwise it does not and adding and subtracting 1.5 / eps, which leaves no
+// fractional bits, takes its place. The latter relies on strict evaluation:
+// -fassociative-math (part of -ffast-math) folds it to the identity, so that
+// -ffast-math always takes rint() even though the build disables
+// -fassociative-math for this file (cf. fk.h).
+#if defined(__SSE4_1__) || defined(__FAST_MATH__)
+#  define FK_RINT(x) rint(x)
+#else
+#  define FK_RINT(x) (((x) + 1.5 / DBL_EPSILON) - 1.5 / DBL_EPSILON)
+#endif
+
+
+/*
+ * s = sin(x), c = cos(x)
+ *
+ * Branch-free so that the compiler vectorizes the loop. The reduction
+ * r = x - n pi/2 subtracts the parts of pi/2 one after the other (Cody-Waite)
+ * with n rounded to the nearest integer (FK_RINT). The polynomials on
+ * [-pi/4, pi/4] are the ones of fdlibm's __kernel_sin and __kernel_cos.
+ *
+ * The quadrant stays a floating-point number: converting it to an integer
+ * would be undefined for out-of-range positions and masking those beforehand
+ * takes an ordered comparison which the compiler does not if-convert (it may
+ * raise an exception). The large positions yield garbage here and are replaced
+ * afterwards. Infinite and NaN positions already yield NaN here (x - n pi/2 is
+ * NaN), like sin() and cos(), so that the fallback does not depend on
+ * comparisons with NaN which -ffinite-math-only would drop.
+ */
+static void sincos_arr(
+        int n,
+        const double *restrict x,
+        double *restrict s,
+        double *restrict c)
+{
+    for (int i = 0; i < n; i++) {
+        const double nq = FK_RINT(x[i] * 0.63661977236758134308);
+        const double r = ((x[i] - nq * 1.57080078125)
+                + nq * 4.453584551811218e-06)
+                + nq * 8.705515695504166e-10;
+
+        const double z = r * r;
+        const double w = z * z;
+
+        const double ps = 8.33333333332248946124e-03
+                + z * (-1.98412698298579493134e-04
+                + z * 2.75573137070700676789e-06)
+                + z * w * (-2.50507602534068634195e-08
+                + z * 1.58969099521155010221e-10);
+        const double sr = r + z * r * (-1.66666666666666324348e-01 + z * ps);
+
+        const double pc = z * (4.16666666666666019037e-02
+                + z * (-1.38888888888741095749e-03
+                + z * 2.48015872894767294178e-05))
+                + w * w * (-2.75573143513906633035e-07
+                + z * (2.08757232129817482790e-09
+                + z * -1.13596475577881948265e-11));
+        const double hz = 0.5 * z;
+        const double v = 1.0 - hz;
+        const double cr = v + (((1.0 - v) - hz) + z * pc);
+
+        // Quadrant j = n mod 4 in {-2, -1, 0, 1, 2}
+        const double j = nq - 4.0 * FK_RINT(nq * 0.25);
+        const double s0 = (j * j == 1.0) ? cr : sr;
+        const double c0 = (j * j == 1.0) ? sr : cr;
+        s[i] = (j == -1.0 || j * j == 4.0) ? -s0 : s0;
+        c[i] = (j == 1.0 || j * j == 4.0) ? -c0 : c0;
+    }
+
+    for (int i = 0; i < n; i++) {
+        if (fabs(x[i]) > FK_SINCOS_MAX) {
+            s[i] = sin(x[i]);
+            c[i] = cos(x[i]);
+        }
+    }
+}
+
+
+/*
+ * Pose of an axis-aligned joint (cf. DYN2B_JNT_ALIGNED) from the joint
+ * position and, for revolute joints, its cosine and sine
+ */
+static inline void aligned_to_pose3(
+        int type,
+        int k,
+        double q,
+        double cq,
+        double sq,
+        double *restrict cart)
+{
+    const int rev = (type == DYN2B_JNT_ALIGNED_REV);
+    const int a = (k + 1) % 3;
+    const int b = (k + 2) % 3;
+    double *rot = &cart[DYN2B_POSE3_ANG_OFFSET];
+    double *pos = &cart[DYN2B_POSE3_LIN_OFFSET];
+
+    if (!rev) {
+        cq = 1.0;
+        sq = 0.0;
+    }
+
+    // Column-major layout
+    rot[(DYN2B_POSE3_ANG_LD * k) + k] = 1.0;
+    rot[(DYN2B_POSE3_ANG_LD * k) + a] = 0.0;
+    rot[(DYN2B_POSE3_ANG_LD * k) + b] = 0.0;
+    rot[(DYN2B_POSE3_ANG_LD * a) + k] = 0.0;
+    rot[(DYN2B_POSE3_ANG_LD * a) + a] = cq;
+    rot[(DYN2B_POSE3_ANG_LD * a) + b] = sq;
+    rot[(DYN2B_POSE3_ANG_LD * b) + k] = 0.0;
+    rot[(DYN2B_POSE3_ANG_LD * b) + a] = -sq;
+    rot[(DYN2B_POSE3_ANG_LD * b) + b] = cq;
+    pos[k] = rev ? 0.0 : q;
+    pos[a] = 0.0;
+    pos[b] = 0.0;
+}
+
+
+// Pose of a revolute joint about an arbitrary axis (cf. dyn2b_rev_to_pose3())
+static void rev_to_pose3(
+        const double *restrict axis,
+        double cq,
+        double sq,
+        double *restrict cart)
+{
+    const double *a = &axis[DYN2B_AXIS3_DIR_OFFSET];
+    const double *aa = &axis[DYN2B_AXIS3_OUT_OFFSET];
+    double vq = 1.0 - cq;
+
+    // R = cq 1 + sq [a]x + vq a a^T
+    double a00 = vq * aa[DYN2B_SYM3_IDX(0, 0)] + cq;
+    double a11 = vq * aa[DYN2B_SYM3_IDX(1, 1)] + cq;
+    double a22 = vq * aa[DYN2B_SYM3_IDX(2, 2)] + cq;
+    double a01 = vq * aa[DYN2B_SYM3_IDX(0, 1)];
+    double a02 = vq * aa[DYN2B_SYM3_IDX(0, 2)];
+    double a12 = vq * aa[DYN2B_SYM3_IDX(1, 2)];
+    double s0 = sq * a[0];
+    double s1 = sq * a[1];
+    double s2 = sq * a[2];
+
+    // Column-major layout
+    cart[0] = a00     ; cart[ 1] = a01 + s2; cart[ 2] = a02 - s1;
+    cart[3] = a01 - s2; cart[ 4] = a11     ; cart[ 5] = a12 + s0;
+    cart[6] = a02 + s1; cart[ 7] = a12 - s0; cart[ 8] = a22     ;
+    cart[9] = 0.0     ; cart[10] = 0.0     ; cart[11] = 0.0     ;
+}
+
+
+/*
+ * Joint poses x_i = X_jnt(q_i) or, if x_tree is given, the poses of the bodies
+ * with respect to their parents x_i = x_tree_i X_jnt(q_i). The axis-aligned
+ * joints compose sparsely (cf. dyn2b_*_cmp_pose3()).
+ */
+static void jnt_pose3(
+        int nb,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict q,
+        double *restrict x)
+{
+    assert(nb >= 0);
+    assert(jnt);
+    assert(q);
+    assert(x);
+
+    for (int i0 = 0; i0 < nb; i0 += FK_CHUNK) {
+        const int m = (nb - i0 < FK_CHUNK) ? nb - i0 : FK_CHUNK;
+
+        // The prismatic joints' entries are computed as well but unused, which
+        // is cheaper than gathering the revolute joints' positions
+        double sq[FK_CHUNK];
+        double cq[FK_CHUNK];
+        sincos_arr(m, &q[i0], sq, cq);
+
+        for (int l = 0; l < m; l++) {
+            const int i = i0 + l;
+            const double *x_tree_i = x_tree ? &x_tree[DYN2B_POSE3_SIZE * i]
+                                            : NULL;
+            double *x_i = &x[DYN2B_POSE3_SIZE * i];
+            double x_jnt[DYN2B_POSE3_SIZE];
+            assert(jnt[i] >= DYN2B_JNT_REV_X && jnt[i] <= DYN2B_JNT_TRANS);
+
+            switch (jnt[i]) {
+#define DYN2B_FK_CMP_POSE3_REV(name) \
+                dyn2b_##name##_cmp_pose3(x_tree_i, cq[l], sq[l], x_i)
+#define DYN2B_FK_CMP_POSE3_TRANS(name) \
+                dyn2b_##name##_cmp_pose3(x_tree_i, &q[i], x_i)
+#define DYN2B_FK_ALIGNED(name, type, k) \
+            case DYN2B_JNT_##type##_X + k: \
+                if (x_tree_i) { \
+                    DYN2B_FK_CMP_POSE3_##type(name); \
+                } else { \
+                    aligned_to_pose3(DYN2B_JNT_ALIGNED_##type, k, q[i], \
+                            cq[l], sq[l], x_i); \
+                } \
+                break;
+
+            DYN2B_JNT_ALIGNED(DYN2B_FK_ALIGNED)
+#undef DYN2B_FK_ALIGNED
+#undef DYN2B_FK_CMP_POSE3_REV
+#undef DYN2B_FK_CMP_POSE3_TRANS
+
+            case DYN2B_JNT_REV:
+                assert(axis);
+                rev_to_pose3(&axis[DYN2B_AXIS3_SIZE * i], cq[l], sq[l],
+                        x_tree_i ? x_jnt : x_i);
+                if (x_tree_i) {
+                    dyn2b_cmp_pose3(x_tree_i, x_jnt, x_i);
+                }
+                break;
+
+            case DYN2B_JNT_TRANS:
+                assert(axis);
+                dyn2b_trans_to_pose3(&axis[DYN2B_AXIS3_SIZE * i], &q[i],
+                        x_tree_i ? x_jnt : x_i);
+                if (x_tree_i) {
+                    dyn2b_cmp_pose3(x_tree_i, x_jnt, x_i);
+                }
+                break;
+            }
+        }
+    }
+}
+
+
+void dyn2b_jnt_to_pose3(
+        int nb,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict q,
+        double *restrict x_jnt)
+{
+    jnt_pose3(nb, jnt, axis, NULL, q, x_jnt);
+}
+
+
+void dyn2b_jnt_cmp_pose3(
+        int nb,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict q,
+        double *restrict x)
+{
+    assert(x_tree);
+
+    jnt_pose3(nb, jnt, axis, x_tree, q, x);
+}
+
+
+void dyn2b_fk(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict q,
+        double *restrict x)
+{
+    assert(nb >= 0);
+    assert(parent);
+    assert(x);
+
+    dyn2b_jnt_cmp_pose3(nb, jnt, axis, x_tree, q, x);
+
+    for (int i = 0; i < nb; i++) {
+        int p = parent[i];
+        assert(p >= -1 && p < i);
+
+        if (p >= 0) {
+            double *x_i = &x[DYN2B_POSE3_SIZE * i];
+            double x_rel[DYN2B_POSE3_SIZE];
+            memcpy(x_rel, x_i, sizeof(x_rel));
+            dyn2b_cmp_pose3(&x[DYN2B_POSE3_SIZE * p], x_rel, x_i);
+        }
+    }
+}
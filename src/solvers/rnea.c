@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/rnea.h>
+#include <dyn2b/solvers/fk.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/mechanics.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dispatch.h"
+
+
+int dyn2b_workspace_size_rnea(
+        int nb)
+{
+    assert(nb >= 0);
+
+    // Pose, velocity, acceleration and wrench of each body
+    return (DYN2B_POSE3_SIZE + DYN2B_TWIST3_SIZE + DYN2B_TWIST3_SIZE
+            + DYN2B_WRENCH3_SIZE) * nb;
+}
+
+
+void dyn2b_rnea(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict qdd,
+        const double *restrict f_ext,
+        double *restrict tau,
+        double *restrict ws)
+{
+    assert(nb >= 0);
+    assert(parent);
+    assert(jnt);
+    assert(x_tree);
+    assert(rbi);
+    assert(xdd_base);
+    assert(q);
+    assert(qd);
+    assert(qdd);
+    assert(tau);
+    assert(ws);
+
+    double *x = ws;
+    double *xd = &x[DYN2B_POSE3_SIZE * nb];
+    double *xdd = &xd[DYN2B_TWIST3_SIZE * nb];
+    double *f = &xdd[DYN2B_TWIST3_SIZE * nb];
+
+    const double xd_base[DYN2B_TWIST3_SIZE] = { 0.0 };
+
+    // Pose of each body with respect to its parent
+    dyn2b_jnt_cmp_pose3(nb, jnt, axis, x_tree, q, x);
+
+    // Outward sweep: motion and the wrenches that realize it
+    for (int i = 0; i < nb; i++) {
+        int p = parent[i];
+        assert(p >= -1 && p < i);
+        assert(jnt[i] >= DYN2B_JNT_REV_X && jnt[i] <= DYN2B_JNT_TRANS);
+
+        const struct dyn2b_dsp_ops *ops = &dyn2b_dsp_ops[jnt[i]];
+        const double *axis_i = dyn2b_dsp_axis(jnt, axis, i);
+        double *x_i = &x[DYN2B_POSE3_SIZE * i];
+        double *xd_i = &xd[DYN2B_TWIST3_SIZE * i];
+        double *xdd_i = &xdd[DYN2B_TWIST3_SIZE * i];
+        double *f_i = &f[DYN2B_WRENCH3_SIZE * i];
+        const double *xd_p = (p < 0) ? xd_base : &xd[DYN2B_TWIST3_SIZE * p];
+        const double *xdd_p = (p < 0) ? xdd_base : &xdd[DYN2B_TWIST3_SIZE * p];
+
+        // Velocity
+        double xd_rel[DYN2B_TWIST3_SIZE];
+        ops->to_twist3(axis_i, &qd[i], xd_rel);
+        dyn2b_tf_dist_screw3(1, x_i, xd_p, xd_i);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xd_i[k] += xd_rel[k];
+        }
+
+        // Acceleration
+        double xdd_rel[DYN2B_TWIST3_SIZE];
+        ops->to_twist3(axis_i, &qdd[i], xdd_rel);
+        dyn2b_tf_dist_acc3(x_i, xd_i, xd_rel, xdd_p, xdd_i);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xdd_i[k] += xdd_rel[k];
+        }
+
+        // Wrench
+        dyn2b_eom_wrench3(&rbi[DYN2B_RBI3_SIZE * i], xd_i, xdd_i, f_i);
+        if (f_ext) {
+            for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+                f_i[k] -= f_ext[(DYN2B_WRENCH3_SIZE * i) + k];
+            }
+        }
+    }
+
+    // Inward sweep: joint forces and accumulation in the parents
+    for (int i = nb - 1; i >= 0; i--) {
+        int p = parent[i];
+        const double *f_i = &f[DYN2B_WRENCH3_SIZE * i];
+
+        dyn2b_dsp_ops[jnt[i]].from_wrench3(1, dyn2b_dsp_axis(jnt, axis, i),
+                f_i, &tau[i]);
+
+        if (p >= 0) {
+            double f_prox[DYN2B_WRENCH3_SIZE];
+            dyn2b_tf_prox_screw3(1, &x[DYN2B_POSE3_SIZE * i], f_i, f_prox);
+            for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+                f[(DYN2B_WRENCH3_SIZE * p) + k] += f_prox[k];
+            }
+        }
+    }
+}
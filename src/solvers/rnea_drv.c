@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/rnea_drv.h>
+#include <dyn2b/solvers/fk.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/mechanics.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dispatch.h"
+
+
+// Bias matrix B that maps the angular part of a twist to a wrench [6 x 3]
+#define DRV_B_SIZE (DYN2B_WRENCH3_SIZE * DYN2B_TWIST3_ANG_SIZE)
+
+// Quantities of each body as seen by the base frame
+#define DRV_BODY_SIZE (DYN2B_POSE3_SIZE + 5 * DYN2B_TWIST3_SIZE \
+        + DYN2B_RBI3_SIZE + DRV_B_SIZE + DYN2B_WRENCH3_SIZE)
+
+
+// Energy of a wrench w.r.t. a twist
+static inline double pair(
+        const double *restrict w,
+        const double *restrict t)
+{
+    double e = 0.0;
+    for (int k = 0; k < 3; k++) {
+        e += w[DYN2B_WRENCH3_LIN_OFFSET + k] * t[DYN2B_TWIST3_LIN_OFFSET + k];
+        e += w[DYN2B_WRENCH3_ANG_OFFSET + k] * t[DYN2B_TWIST3_ANG_OFFSET + k];
+    }
+
+    return e;
+}
+
+
+// w += B t
+static inline void bias_add(
+        const double *restrict b,
+        const double *restrict t,
+        double *restrict w)
+{
+    for (int c = 0; c < DYN2B_TWIST3_ANG_SIZE; c++) {
+        for (int r = 0; r < DYN2B_WRENCH3_SIZE; r++) {
+            w[r] += b[(DYN2B_WRENCH3_SIZE * c) + r]
+                    * t[DYN2B_TWIST3_ANG_OFFSET + c];
+        }
+    }
+}
+
+
+int dyn2b_workspace_size_rnea_drv(
+        int nb)
+{
+    assert(nb >= 0);
+
+    return DRV_BODY_SIZE * nb;
+}
+
+
+void dyn2b_rnea_drv(
+        int nb,
+        const int *restrict parent,
+        const int *restrict jnt,
+        const double *restrict axis,
+        const double *restrict x_tree,
+        const double *restrict rbi,
+        const double *restrict xdd_base,
+        const double *restrict q,
+        const double *restrict qd,
+        const double *restrict qdd,
+        const double *restrict f_ext,
+        double *restrict tau,
+        double *restrict dtau_dq,
+        double *restrict dtau_dqd,
+        double *restrict dtau_dqdd,
+        double *restrict ws)
+{
+    assert(nb >= 0);
+    assert(parent);
+    assert(jnt);
+    assert(x_tree);
+    assert(rbi);
+    assert(xdd_base);
+    assert(q);
+    assert(qd);
+    assert(qdd);
+    assert(tau);
+    assert(dtau_dq);
+    assert(dtau_dqd);
+    assert(dtau_dqdd);
+    assert(ws);
+
+    // Pose, joint twist S, velocity, acceleration, the derivatives of the
+    // velocity-product acceleration psid = xd_p x S and
+    // psidd = xdd_p x S + xd_p x psid, as well as the composite inertia, bias
+    // matrix and wrench of each body's subtree
+    double *x = ws;
+    double *s = &x[DYN2B_POSE3_SIZE * nb];
+    double *xd = &s[DYN2B_TWIST3_SIZE * nb];
+    double *xdd = &xd[DYN2B_TWIST3_SIZE * nb];
+    double *psid = &xdd[DYN2B_TWIST3_SIZE * nb];
+    double *psidd = &psid[DYN2B_TWIST3_SIZE * nb];
+    double *rbi_c = &psidd[DYN2B_TWIST3_SIZE * nb];
+    double *b_c = &rbi_c[DYN2B_RBI3_SIZE * nb];
+    double *f_c = &b_c[DRV_B_SIZE * nb];
+
+    const double xd_base[DYN2B_TWIST3_SIZE] = { 0.0 };
+    const double one = 1.0;
+    double unit[DYN2B_TWIST3_SIZE * DYN2B_TWIST3_ANG_SIZE] = { 0.0 };
+    for (int k = 0; k < DYN2B_TWIST3_ANG_SIZE; k++) {
+        unit[(DYN2B_TWIST3_SIZE * k) + DYN2B_TWIST3_ANG_OFFSET + k] = 1.0;
+    }
+
+    memset(dtau_dq, 0, nb * nb * sizeof(double));
+    memset(dtau_dqd, 0, nb * nb * sizeof(double));
+    memset(dtau_dqdd, 0, nb * nb * sizeof(double));
+
+    // Poses of the bodies with respect to their parents, replaced by the ones
+    // with respect to the base below
+    dyn2b_jnt_cmp_pose3(nb, jnt, axis, x_tree, q, x);
+
+    // Outward sweep: motion and wrenches as seen by the base frame so that
+    // each joint rotates the quantities of its whole subtree alike
+    for (int i = 0; i < nb; i++) {
+        int p = parent[i];
+        assert(p >= -1 && p < i);
+        assert(jnt[i] >= DYN2B_JNT_REV_X && jnt[i] <= DYN2B_JNT_TRANS);
+
+        const struct dyn2b_dsp_ops *ops = &dyn2b_dsp_ops[jnt[i]];
+        const double *axis_i = dyn2b_dsp_axis(jnt, axis, i);
+        double *x_i = &x[DYN2B_POSE3_SIZE * i];
+        double *s_i = &s[DYN2B_TWIST3_SIZE * i];
+        double *xd_i = &xd[DYN2B_TWIST3_SIZE * i];
+        double *xdd_i = &xdd[DYN2B_TWIST3_SIZE * i];
+        double *psid_i = &psid[DYN2B_TWIST3_SIZE * i];
+        double *psidd_i = &psidd[DYN2B_TWIST3_SIZE * i];
+        double *rbi_i = &rbi_c[DYN2B_RBI3_SIZE * i];
+        double *b_i = &b_c[DRV_B_SIZE * i];
+        double *f_i = &f_c[DYN2B_WRENCH3_SIZE * i];
+        const double *xd_p = (p < 0) ? xd_base : &xd[DYN2B_TWIST3_SIZE * p];
+        const double *xdd_p = (p < 0) ? xdd_base : &xdd[DYN2B_TWIST3_SIZE * p];
+
+        // Pose of the body with respect to the base
+        if (p >= 0) {
+            double x_rel[DYN2B_POSE3_SIZE];
+            memcpy(x_rel, x_i, sizeof(x_rel));
+            dyn2b_cmp_pose3(&x[DYN2B_POSE3_SIZE * p], x_rel, x_i);
+        }
+
+        // Joint twist
+        double s_jnt[DYN2B_TWIST3_SIZE];
+        ops->to_twist3(axis_i, &one, s_jnt);
+        dyn2b_tf_prox_screw3(1, x_i, s_jnt, s_i);
+
+        // Velocity and acceleration:
+        // xd = xd_p + S qd
+        // xdd = xdd_p + S qdd + psid qd
+        double tmp[DYN2B_TWIST3_SIZE];
+        dyn2b_crs_screw3(xd_p, s_i, psid_i);
+        dyn2b_crs_screw3(xdd_p, s_i, tmp);
+        dyn2b_cad_screw3(tmp, xd_p, psid_i, psidd_i);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xd_i[k] = xd_p[k] + s_i[k] * qd[i];
+            xdd_i[k] = xdd_p[k] + s_i[k] * qdd[i] + psid_i[k] * qd[i];
+        }
+
+        // Inertia and wrench
+        dyn2b_tf_prox_rbi3(x_i, &rbi[DYN2B_RBI3_SIZE * i], rbi_i);
+        dyn2b_eom_wrench3(rbi_i, xd_i, xdd_i, f_i);
+        if (f_ext) {
+            double f_prox[DYN2B_WRENCH3_SIZE];
+            dyn2b_tf_prox_screw3(1, x_i, &f_ext[DYN2B_WRENCH3_SIZE * i],
+                    f_prox);
+            for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+                f_i[k] -= f_prox[k];
+            }
+        }
+
+        // Bias matrix: variation of the wrench due to a variation dxd of the
+        // velocity that also rotates the acceleration by dxd x xd
+        // B dxd = dxd x (I xd) + xd x (I dxd) + I (dxd x xd)
+        // The three terms cancel for the linear part of dxd (Jacobi identity)
+        // so that only the columns of the angular part remain
+        dyn2b_nrt_wrench3_dxd(DYN2B_TWIST3_ANG_SIZE, rbi_i, xd_i, unit, b_i);
+        for (int c = 0; c < DYN2B_TWIST3_ANG_SIZE; c++) {
+            double w[DYN2B_WRENCH3_SIZE];
+            dyn2b_crs_screw3(&unit[DYN2B_TWIST3_SIZE * c], xd_i, tmp);
+            dyn2b_rbi_to_wrench3(rbi_i, tmp, w);
+            for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+                b_i[(DYN2B_WRENCH3_SIZE * c) + k] += w[k];
+            }
+        }
+    }
+
+    // Inward sweep: joint forces and their derivatives from the composite
+    // quantities of each body's subtree. They yield the derivatives of tau_i
+    // with respect to the joints j between body i and the base (left) and the
+    // derivatives of the ancestors' joint forces tau_a with respect to joint i
+    // (right):
+    //
+    //       d tau_i / d(.)_j                      d tau_a / d(.)_i
+    // q:    S_i^T (I^C_i psidd_j + B^C_i psid_j)  S_a^T (S_i x f^C_i
+    //                                                + I^C_i psidd_i
+    //                                                + B^C_i psid_i)
+    // qd:   S_i^T (B^C_i S_j + 2 I^C_i psid_j)    S_a^T (B^C_i S_i
+    //                                                + 2 I^C_i psid_i)
+    // qdd:  S_i^T I^C_i S_j                       S_a^T I^C_i S_i
+    for (int i = nb - 1; i >= 0; i--) {
+        int p = parent[i];
+
+        const double *s_i = &s[DYN2B_TWIST3_SIZE * i];
+        const double *psid_i = &psid[DYN2B_TWIST3_SIZE * i];
+        const double *psidd_i = &psidd[DYN2B_TWIST3_SIZE * i];
+        const double *rbi_i = &rbi_c[DYN2B_RBI3_SIZE * i];
+        const double *b_i = &b_c[DRV_B_SIZE * i];
+        const double *f_i = &f_c[DYN2B_WRENCH3_SIZE * i];
+
+        tau[i] = pair(f_i, s_i);
+
+        // u1 = I^C S and u2 = B^{C T} S (as a wrench)
+        double u1[DYN2B_WRENCH3_SIZE];
+        double u2[DYN2B_WRENCH3_SIZE] = { 0.0 };
+        dyn2b_rbi_to_wrench3(rbi_i, s_i, u1);
+        for (int k = 0; k < DYN2B_TWIST3_ANG_SIZE; k++) {
+            u2[DYN2B_WRENCH3_ANG_OFFSET + k] =
+                    pair(&b_i[DYN2B_WRENCH3_SIZE * k], s_i);
+        }
+
+        for (int j = i; j >= 0; j = parent[j]) {
+            const double *s_j = &s[DYN2B_TWIST3_SIZE * j];
+            const double *psid_j = &psid[DYN2B_TWIST3_SIZE * j];
+            const double *psidd_j = &psidd[DYN2B_TWIST3_SIZE * j];
+
+            dtau_dq[(nb * j) + i] = pair(u1, psidd_j) + pair(u2, psid_j);
+            dtau_dqd[(nb * j) + i] = pair(u2, s_j) + 2.0 * pair(u1, psid_j);
+            dtau_dqdd[(nb * j) + i] = pair(u1, s_j);
+        }
+
+        if (p < 0) {
+            continue;
+        }
+
+        // Effect of the joint on the subtree's wrench which all ancestors
+        // feel, including the joint's rotation of the wrench itself
+        double w_q[DYN2B_WRENCH3_SIZE];
+        double w_qd[DYN2B_WRENCH3_SIZE];
+        double w[DYN2B_WRENCH3_SIZE];
+        dyn2b_crs_screw3(s_i, f_i, w_q);
+        dyn2b_rbi_to_wrench3(rbi_i, psidd_i, w);
+        bias_add(b_i, psid_i, w_q);
+        dyn2b_rbi_to_wrench3(rbi_i, psid_i, w_qd);
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            w_q[k] += w[k];
+            w_qd[k] *= 2.0;
+        }
+        bias_add(b_i, s_i, w_qd);
+
+        for (int a = p; a >= 0; a = parent[a]) {
+            const double *s_a = &s[DYN2B_TWIST3_SIZE * a];
+
+            dtau_dq[(nb * i) + a] = pair(w_q, s_a);
+            dtau_dqd[(nb * i) + a] = pair(w_qd, s_a);
+            dtau_dqdd[(nb * i) + a] = pair(u1, s_a);
+        }
+
+        // Accumulate in the parent; all quantities refer to the base frame
+        double *rbi_p = &rbi_c[DYN2B_RBI3_SIZE * p];
+        double *b_p = &b_c[DRV_B_SIZE * p];
+        double *f_p = &f_c[DYN2B_WRENCH3_SIZE * p];
+        for (int k = 0; k < DYN2B_RBI3_SIZE; k++) {
+            rbi_p[k] += rbi_i[k];
+        }
+        for (int k = 0; k < DRV_B_SIZE; k++) {
+            b_p[k] += b_i[k];
+        }
+        for (int k = 0; k < DYN2B_WRENCH3_SIZE; k++) {
+            f_p[k] += f_i[k];
+        }
+    }
+}
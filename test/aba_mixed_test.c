@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/abaf.h>
+#include <dyn2b/solvers/aba_mixed.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+#include <math.h>
+#include <string.h>
+
+#include "common.h"
+#include "tree_model.h"
+
+
+// Serial chain of the accuracy benchmark (cf. aba_accuracy.c)
+#define NB_CHAIN 128
+
+
+// Round to single precision such that the reference sees the same inputs
+static void to_flt(
+        int n,
+        double *inout,
+        float *out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = (float)inout[i];
+        inout[i] = out[i];
+    }
+}
+
+
+// Error relative to the largest joint acceleration of the reference
+static double error(
+        int n,
+        const float *res,
+        const double *ref)
+{
+    double err = 0.0;
+    double scale = 0.0;
+    for (int i = 0; i < n; i++) {
+        err = fmax(err, fabs((double)res[i] - ref[i]));
+        scale = fmax(scale, fabs(ref[i]));
+    }
+
+    return err / scale;
+}
+
+
+START_TEST(test_aba_mixed_pendulum)
+{
+    // Point mass m at (l, 0, 0) of a link that rotates about the z-axis
+    // (cf. test_aba_pendulum), without axes as only axis-aligned joints occur
+    const float m = 2.0f;
+    const float l = 0.5f;
+    const float g = 9.81f;
+    const int par[1] = { -1 };
+    const int type[1] = { DYN2B_JNT_REV_Z };
+    float x[DYN2B_POSE3_SIZE] = {
+        1.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 1.0f,  0.0f, 0.0f, 1.0f
+    };
+    float inertia[DYN2B_RBI3_SIZE] = {
+        0.0f, 0.0f, 0.0f,  0.0f, m * l * l, 0.0f,  0.0f, 0.0f, m * l * l,
+        m * l, 0.0f, 0.0f,
+        m
+    };
+    float xdd_base[DYN2B_TWIST3_SIZE] = { 0.0f, 0.0f, 0.0f, 0.0f, g, 0.0f };
+    float d = 0.0f;
+    float q0 = 0.0f, qd0 = 0.0f, tau0 = 0.0f;
+    float qdd;
+    float ws[dyn2b_workspace_size_aba_mixed(1)];
+    double ws_abi[dyn2b_workspace_size_aba_mixed_abi(1)];
+
+    // Free fall from the horizontal configuration
+    dyn2b_aba_mixed(1, par, type, NULL, x, inertia, &d, xdd_base,
+            &q0, &qd0, &tau0, NULL, &qdd, ws, ws_abi);
+    ck_assert_flt_eq(qdd, -g / l);
+
+    // The actuator's inertia slows down the fall
+    d = m * l * l;
+    dyn2b_aba_mixed(1, par, type, NULL, x, inertia, &d, xdd_base,
+            &q0, &qd0, &tau0, NULL, &qdd, ws, ws_abi);
+    ck_assert_flt_eq(qdd, -g / (2.0f * l));
+}
+END_TEST
+
+
+START_TEST(test_aba_mixed_tree)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB] = { 0.0 };
+    double x[DYN2B_POSE3_SIZE * NB];
+    double inertia[DYN2B_RBI3_SIZE * NB];
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    double d[NB] = { 0.1, 0.2, 0.0, 0.3 };
+    double pos[NB], vel[NB], tau[NB], f_ext[DYN2B_WRENCH3_SIZE * NB];
+    double res[NB];
+    double ws[dyn2b_workspace_size_aba(NB)];
+    tree_axis(axis);
+    memcpy(x, x_tree, sizeof(x));
+    memcpy(inertia, rbi, sizeof(inertia));
+    memcpy(pos, q, sizeof(pos));
+    memcpy(vel, qd, sizeof(vel));
+    for (int i = 0; i < NB; i++) {
+        tau[i] = 0.5 * i - 0.7;
+    }
+    for (int i = 0; i < DYN2B_WRENCH3_SIZE * NB; i++) {
+        f_ext[i] = 0.1 * (i % 7) - 0.3;
+    }
+
+    float axisf[DYN2B_AXIS3_SIZE * NB], xf[DYN2B_POSE3_SIZE * NB];
+    float inertiaf[DYN2B_RBI3_SIZE * NB], xdd_basef[DYN2B_TWIST3_SIZE];
+    float df[NB], posf[NB], velf[NB], tauf[NB];
+    float f_extf[DYN2B_WRENCH3_SIZE * NB], resf[NB];
+    float wsf[dyn2b_workspace_size_aba_mixed(NB)];
+    double ws_abi[dyn2b_workspace_size_aba_mixed_abi(NB)];
+    to_flt(DYN2B_AXIS3_SIZE * NB, axis, axisf);
+    to_flt(DYN2B_POSE3_SIZE * NB, x, xf);
+    to_flt(DYN2B_RBI3_SIZE * NB, inertia, inertiaf);
+    to_flt(DYN2B_TWIST3_SIZE, xdd_base, xdd_basef);
+    to_flt(NB, d, df);
+    to_flt(NB, pos, posf);
+    to_flt(NB, vel, velf);
+    to_flt(NB, tau, tauf);
+    to_flt(DYN2B_WRENCH3_SIZE * NB, f_ext, f_extf);
+
+    dyn2b_aba(NB, parent, jnt, axis, x, inertia, d, xdd_base,
+            pos, vel, tau, f_ext, res, ws);
+
+    // Both the single- and the mixed-precision ABA agree with the reference
+    // on a small tree
+    double err;
+    dyn2b_abaf(NB, parent, jnt, axisf, xf, inertiaf, df, xdd_basef,
+            posf, velf, tauf, f_extf, resf, wsf);
+    err = error(NB, resf, res);
+    ck_assert_msg(err <= 1e-5, "Relative error of dyn2b_abaf: %g", err);
+
+    dyn2b_aba_mixed(NB, parent, jnt, axisf, xf, inertiaf, df, xdd_basef,
+            posf, velf, tauf, f_extf, resf, wsf, ws_abi);
+    err = error(NB, resf, res);
+    ck_assert_msg(err <= 1e-5, "Relative error of dyn2b_aba_mixed: %g", err);
+}
+END_TEST
+
+
+START_TEST(test_aba_mixed_chain)
+{
+    int par[NB_CHAIN], type[NB_CHAIN];
+    double axis[DYN2B_AXIS3_SIZE * NB_CHAIN] = { 0.0 };
+    double x[DYN2B_POSE3_SIZE * NB_CHAIN];
+    double inertia[DYN2B_RBI3_SIZE * NB_CHAIN];
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    double d[NB_CHAIN], pos[NB_CHAIN], vel[NB_CHAIN], tau[NB_CHAIN];
+    double res[NB_CHAIN];
+    double ws[dyn2b_workspace_size_aba(NB_CHAIN)];
+
+    // Each link is 10% heavier than its parent
+    for (int i = 0; i < NB_CHAIN; i++) {
+        const double m = pow(1.1, i);
+        const double link[DYN2B_RBI3_SIZE] = {
+            0.2 * m, 0.0, 0.0,  0.0, 0.3 * m, 0.0,  0.0, 0.0, 0.4 * m,
+            0.1 * m, 0.2 * m, 0.3 * m,
+            m
+        };
+        const double offset[DYN2B_POSE3_SIZE] = {
+            1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  0.0, 0.0, 1.0,  0.0, 0.0, 1.0
+        };
+
+        par[i] = i - 1;
+        type[i] = DYN2B_JNT_REV_X + (i % 3);
+        memcpy(&x[DYN2B_POSE3_SIZE * i], offset, sizeof(offset));
+        memcpy(&inertia[DYN2B_RBI3_SIZE * i], link, sizeof(link));
+        d[i] = 0.0;
+        pos[i] = sin(1.0 + i);
+        vel[i] = 0.5 * cos(2.0 + i);
+        tau[i] = sin(3.0 + 2.0 * i);
+    }
+
+    float axisf[DYN2B_AXIS3_SIZE * NB_CHAIN], xf[DYN2B_POSE3_SIZE * NB_CHAIN];
+    float inertiaf[DYN2B_RBI3_SIZE * NB_CHAIN], xdd_basef[DYN2B_TWIST3_SIZE];
+    float df[NB_CHAIN], posf[NB_CHAIN], velf[NB_CHAIN], tauf[NB_CHAIN];
+    float resf[NB_CHAIN];
+    float wsf[dyn2b_workspace_size_aba_mixed(NB_CHAIN)];
+    double ws_abi[dyn2b_workspace_size_aba_mixed_abi(NB_CHAIN)];
+    to_flt(DYN2B_AXIS3_SIZE * NB_CHAIN, axis, axisf);
+    to_flt(DYN2B_POSE3_SIZE * NB_CHAIN, x, xf);
+    to_flt(DYN2B_RBI3_SIZE * NB_CHAIN, inertia, inertiaf);
+    to_flt(DYN2B_TWIST3_SIZE, xdd_base, xdd_basef);
+    to_flt(NB_CHAIN, d, df);
+    to_flt(NB_CHAIN, pos, posf);
+    to_flt(NB_CHAIN, vel, velf);
+    to_flt(NB_CHAIN, tau, tauf);
+
+    dyn2b_aba(NB_CHAIN, par, type, axis, x, inertia, d, xdd_base,
+            pos, vel, tau, NULL, res, ws);
+
+    // The double-precision inertias keep the mixed-precision ABA accurate
+    // where the single-precision one is about two orders of magnitude off
+    // (cf. dyn2b_aba_accuracy)
+    dyn2b_aba_mixed(NB_CHAIN, par, type, axisf, xf, inertiaf, df, xdd_basef,
+            posf, velf, tauf, NULL, resf, wsf, ws_abi);
+    double err = error(NB_CHAIN, resf, res);
+    ck_assert_msg(err <= 1e-5, "Relative error of dyn2b_aba_mixed: %g", err);
+}
+END_TEST
+
+
+TCase *aba_mixed_test()
+{
+    TCase *tc = tcase_create("Mixed-precision ABA");
+
+    tcase_add_test(tc, test_aba_mixed_pendulum);
+    tcase_add_test(tc, test_aba_mixed_tree);
+    tcase_add_test(tc, test_aba_mixed_chain);
+
+    return tc;
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/rnea.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+#include <math.h>
+
+#include "common.h"
+#include "tree_model.h"
+
+
+START_TEST(test_aba_pendulum)
+{
+    // Point mass m at (l, 0, 0) of a link that rotates about the z-axis
+    const double m = 2.0;
+    const double l = 0.5;
+    const double g = 9.81;
+    const int par[1] = { -1 };
+    const int type[1] = { DYN2B_JNT_REV_Z };
+    double axis[DYN2B_AXIS3_SIZE];
+    double x[DYN2B_POSE3_SIZE] = {
+        1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  0.0, 0.0, 1.0,  0.0, 0.0, 1.0
+    };
+    double inertia[DYN2B_RBI3_SIZE] = {
+        0.0, 0.0, 0.0,  0.0, m * l * l, 0.0,  0.0, 0.0, m * l * l,
+        m * l, 0.0, 0.0,
+        m
+    };
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, g, 0.0 };
+    double d = 0.0;
+    double q0 = 0.0, qd0 = 0.0, tau0 = 0.0;
+    double qdd;
+    double ws[dyn2b_workspace_size_aba(1)];
+
+    // Free fall from the horizontal configuration
+    dyn2b_aba(1, par, type, axis, x, inertia, &d, xdd_base,
+            &q0, &qd0, &tau0, NULL, &qdd, ws);
+    ck_assert_flt_eq(qdd, -g / l);
+
+    // The actuator's inertia slows down the fall
+    d = m * l * l;
+    dyn2b_aba(1, par, type, axis, x, inertia, &d, xdd_base,
+            &q0, &qd0, &tau0, NULL, &qdd, ws);
+    ck_assert_flt_eq(qdd, -g / (2.0 * l));
+}
+END_TEST
+
+
+START_TEST(test_aba_rnea)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    double f_ext[DYN2B_WRENCH3_SIZE * NB];
+    for (int i = 0; i < DYN2B_WRENCH3_SIZE * NB; i++) {
+        f_ext[i] = 0.1 * (i % 7) - 0.3;
+    }
+    const double d[NB] = { 0.1, 0.2, 0.0, 0.3 };
+
+    double ws_rnea[dyn2b_workspace_size_rnea(NB)];
+    double ws[dyn2b_workspace_size_aba(NB)];
+
+    // Forward dynamics inverts the inverse dynamics: RNEA does not know about
+    // the actuator inertia, hence tau = RNEA(qdd) + d qdd
+    double tau[NB];
+    double res[NB];
+    dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, qdd, f_ext, tau, ws_rnea);
+    for (int i = 0; i < NB; i++) {
+        tau[i] += d[i] * qdd[i];
+    }
+
+    dyn2b_aba(NB, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+            q, qd, tau, f_ext, res, ws);
+    for (int i = 0; i < NB; i++) {
+        ck_assert_flt_eq(res[i], qdd[i]);
+    }
+
+    // The individual sweeps compose to the same result, also if the inward
+    // sweep is repeated
+    for (int i = 0; i < NB; i++) {
+        res[i] = NAN;
+    }
+    dyn2b_aba_vel(NB, parent, jnt, axis, x_tree, rbi, q, qd, f_ext, ws);
+    dyn2b_aba_abi(NB, parent, jnt, axis, rbi, d, tau, ws);
+    dyn2b_aba_abi(NB, parent, jnt, axis, rbi, d, tau, ws);
+    dyn2b_aba_acc(NB, parent, jnt, axis, xdd_base, res, ws);
+    for (int i = 0; i < NB; i++) {
+        ck_assert_flt_eq(res[i], qdd[i]);
+    }
+}
+END_TEST
+
+
+TCase *aba_test()
+{
+    TCase *tc = tcase_create("ABA");
+
+    tcase_add_test(tc, test_aba_pendulum);
+    tcase_add_test(tc, test_aba_rnea);
+
+    return tc;
+}
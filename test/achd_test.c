@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/achd.h>
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/rnea.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/mechanics.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+#include <string.h>
+
+#include "common.h"
+#include "tree_model.h"
+
+
+// Body accelerations of the test fixture from the joint accelerations
+static void tree_acc(
+        const double *xdd_base,
+        const double *qdd_in,
+        double *xdd)
+{
+    const double dir[NB][3] = {
+        { 0.0, 0.0, 1.0 }, { 0.0, 1.0, 0.0 }, { 1.0, 0.0, 0.0 },
+        { 1.0, 1.0, 0.0 }
+    };
+    const double zero[DYN2B_TWIST3_SIZE] = { 0.0 };
+    double xd[DYN2B_TWIST3_SIZE * NB];
+
+    for (int i = 0; i < NB; i++) {
+        double ax[DYN2B_AXIS3_SIZE];
+        double x_jnt[DYN2B_POSE3_SIZE];
+        double x[DYN2B_POSE3_SIZE];
+        double xd_rel[DYN2B_TWIST3_SIZE];
+        double xdd_rel[DYN2B_TWIST3_SIZE];
+        const double *xd_p = (parent[i] < 0) ? zero
+                : &xd[DYN2B_TWIST3_SIZE * parent[i]];
+        const double *xdd_p = (parent[i] < 0) ? xdd_base
+                : &xdd[DYN2B_TWIST3_SIZE * parent[i]];
+        double *xd_i = &xd[DYN2B_TWIST3_SIZE * i];
+        double *xdd_i = &xdd[DYN2B_TWIST3_SIZE * i];
+
+        dyn2b_to_axis3(dir[i], ax);
+        if (jnt[i] == DYN2B_JNT_TRANS_X) {
+            dyn2b_trans_to_pose3(ax, &q[i], x_jnt);
+            dyn2b_trans_to_twist3(ax, &qd[i], xd_rel);
+            dyn2b_trans_to_twist3(ax, &qdd_in[i], xdd_rel);
+        } else {
+            dyn2b_rev_to_pose3(ax, &q[i], x_jnt);
+            dyn2b_rev_to_twist3(ax, &qd[i], xd_rel);
+            dyn2b_rev_to_twist3(ax, &qdd_in[i], xdd_rel);
+        }
+        dyn2b_cmp_pose3(&x_tree[DYN2B_POSE3_SIZE * i], x_jnt, x);
+
+        dyn2b_tf_dist_screw3(1, x, xd_p, xd_i);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xd_i[k] += xd_rel[k];
+        }
+        dyn2b_tf_dist_acc3(x, xd_i, xd_rel, xdd_p, xdd_i);
+        for (int k = 0; k < DYN2B_TWIST3_SIZE; k++) {
+            xdd_i[k] += xdd_rel[k];
+        }
+    }
+}
+
+
+START_TEST(test_achd_pendulum)
+{
+    // Point mass m at (l, 0, 0) of a link that rotates about the z-axis
+    const double m = 2.0;
+    const double l = 0.5;
+    const double g = 9.81;
+    const int par[1] = { -1 };
+    const int type[1] = { DYN2B_JNT_REV_Z };
+    double axis[DYN2B_AXIS3_SIZE];
+    double x[DYN2B_POSE3_SIZE] = {
+        1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  0.0, 0.0, 1.0,  0.0, 0.0, 1.0
+    };
+    double inertia[DYN2B_RBI3_SIZE] = {
+        0.0, 0.0, 0.0,  0.0, m * l * l, 0.0,  0.0, 0.0, m * l * l,
+        m * l, 0.0, 0.0,
+        m
+    };
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, g, 0.0 };
+    double d = 0.0;
+    double q0 = 0.0, qd0 = 0.0, tau0 = 0.0;
+    double qdd_res, nu;
+    double ws[dyn2b_workspace_size_achd(1, 1)];
+
+    // Unit force along the y-axis at the point mass
+    const int body[1] = { 0 };
+    const double alpha[DYN2B_WRENCH3_SIZE] = { 0.0, 1.0, 0.0, 0.0, 0.0, l };
+
+    // Keep the point mass at rest: the constraint force carries the weight
+    double beta = g;
+    dyn2b_achd(1, par, type, axis, x, inertia, &d, xdd_base,
+            &q0, &qd0, &tau0, NULL, 1, body, alpha, &beta, &qdd_res, &nu, ws);
+    ck_assert_flt_eq(qdd_res, 0.0);
+    ck_assert_flt_eq(nu, m * g);
+
+    // Constrain to free fall: no constraint force is required
+    beta = 0.0;
+    dyn2b_achd(1, par, type, axis, x, inertia, &d, xdd_base,
+            &q0, &qd0, &tau0, NULL, 1, body, alpha, &beta, &qdd_res, &nu, ws);
+    ck_assert_flt_eq(qdd_res, -g / l);
+    ck_assert_flt_eq(nu, 0.0);
+}
+END_TEST
+
+
+START_TEST(test_achd_tree)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    double f_ext[DYN2B_WRENCH3_SIZE * NB];
+    for (int i = 0; i < DYN2B_WRENCH3_SIZE * NB; i++) {
+        f_ext[i] = 0.1 * (i % 7) - 0.3;
+    }
+    const double d[NB] = { 0.1, 0.2, 0.0, 0.3 };
+    const double tau[NB] = { 0.5, -1.0, 2.0, 0.3 };
+
+    // Constraints on both branches
+    #define NC 3
+    const int body[NC] = { 3, 3, 2 };
+    const double alpha[DYN2B_WRENCH3_SIZE * NC] = {
+        1.0, 0.0, 0.0,  0.0, 0.2, 0.0,
+        0.0, 0.0, 0.0,  0.0, 0.0, 1.0,
+        0.0, 1.0, 0.5,  0.1, 0.0, 0.0
+    };
+    const double beta[NC] = { 0.4, -1.2, 2.5 };
+
+    double res[NB];
+    double nu[NC];
+    double ws[dyn2b_workspace_size_achd(NB, NC)];
+    dyn2b_achd(NB, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+            q, qd, tau, f_ext, NC, body, alpha, beta, res, nu, ws);
+
+    // The accelerations satisfy the constraints
+    double xdd[DYN2B_TWIST3_SIZE * NB];
+    tree_acc(xdd_base, res, xdd);
+    for (int k = 0; k < NC; k++) {
+        double e;
+        dyn2b_dot_screw3(1, 1, &alpha[DYN2B_WRENCH3_SIZE * k],
+                &xdd[DYN2B_TWIST3_SIZE * body[k]], &e);
+        ck_assert_flt_eq(e, beta[k]);
+    }
+
+    // The accelerations are the ones that the joint forces and the constraint
+    // wrenches produce
+    double f[DYN2B_WRENCH3_SIZE * NB];
+    memcpy(f, f_ext, sizeof(f));
+    for (int k = 0; k < NC; k++) {
+        for (int j = 0; j < DYN2B_WRENCH3_SIZE; j++) {
+            f[(DYN2B_WRENCH3_SIZE * body[k]) + j] +=
+                    alpha[(DYN2B_WRENCH3_SIZE * k) + j] * nu[k];
+        }
+    }
+
+    double tau_rnea[NB];
+    double ws_rnea[dyn2b_workspace_size_rnea(NB)];
+    dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, res, f, tau_rnea, ws_rnea);
+    for (int i = 0; i < NB; i++) {
+        ck_assert_flt_eq(tau_rnea[i] + d[i] * res[i], tau[i]);
+    }
+
+    // Without constraints, the solver reduces to the ABA
+    double res_aba[NB];
+    double ws_aba[dyn2b_workspace_size_aba(NB)];
+    dyn2b_achd(NB, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+            q, qd, tau, f_ext, 0, NULL, NULL, NULL, res, NULL, ws);
+    dyn2b_aba(NB, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+            q, qd, tau, f_ext, res_aba, ws_aba);
+    for (int i = 0; i < NB; i++) {
+        ck_assert_flt_eq(res[i], res_aba[i]);
+    }
+    #undef NC
+}
+END_TEST
+
+
+TCase *achd_test()
+{
+    TCase *tc = tcase_create("ACHD");
+
+    tcase_add_test(tc, test_achd_pendulum);
+    tcase_add_test(tc, test_achd_tree);
+
+    return tc;
+}
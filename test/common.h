@@ -2,6 +2,9 @@
 #ifndef DYN2B_TEST_COMMON_H
 #define DYN2B_TEST_COMMON_H
 
+#include <dyn2b/types/dual.h>
+#include <math.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,6 +20,32 @@ extern "C" {
 #endif
 
 
+// Point on the line through a dual quantity's value along its k-th tangent
+static inline void dual_at(
+        int m,
+        const double *in,
+        int k,
+        double eps,
+        double *out)
+{
+    for (int i = 0; i < m; i++) {
+        out[i] = in[i]
+                + eps * in[DYN2B_DUAL_TAN_OFFSET(m) + (i * DYN2B_DUAL_TAN_LD) + k];
+    }
+}
+
+
+// Arbitrary tangents
+static inline void dual_seed(
+        int m,
+        double *inout)
+{
+    for (int i = 0; i < DYN2B_DUAL_TAN_SIZE(m); i++) {
+        inout[DYN2B_DUAL_TAN_OFFSET(m) + i] = sin(1.0 + i);
+    }
+}
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/crba.h>
+#include <dyn2b/solvers/aba.h>
+#include <dyn2b/solvers/rnea.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/matrix.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+
+#include "common.h"
+#include "tree_model.h"
+
+
+START_TEST(test_crba_rnea)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    const double d[NB] = { 0.1, 0.2, 0.0, 0.3 };
+    const double zero[NB] = { 0.0 };
+    const double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0 };
+
+    double h[NB * NB];
+    double ws[dyn2b_workspace_size_crba(NB)];
+    dyn2b_crba(NB, parent, jnt, axis, x_tree, rbi, d, q, h, ws);
+
+    // Without velocity and gravity, RNEA maps a unit joint acceleration to the
+    // respective column of H (except for the actuator inertia)
+    double ws_rnea[dyn2b_workspace_size_rnea(NB)];
+    for (int c = 0; c < NB; c++) {
+        double e[NB] = { 0.0 };
+        double col[NB];
+        e[c] = 1.0;
+        dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+                q, zero, e, NULL, col, ws_rnea);
+
+        for (int r = 0; r < NB; r++) {
+            ck_assert_flt_eq(h[(NB * c) + r], col[r] + d[r] * e[r]);
+        }
+    }
+
+    // Bodies on different branches do not couple
+    ck_assert_flt_eq(h[(NB * 1) + 2], 0.0);
+    ck_assert_flt_eq(h[(NB * 2) + 3], 0.0);
+}
+END_TEST
+
+
+START_TEST(test_crba_ltdl)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    const double d[NB] = { 0.1, 0.2, 0.0, 0.3 };
+    const double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    const double zero[NB] = { 0.0 };
+    const double tau[NB] = { 0.5, -1.0, 2.0, 0.3 };
+
+    // Forward dynamics H qdd = tau - C with the bias forces C from RNEA
+    double h[NB * NB];
+    double fct[NB * NB];
+    double c[NB];
+    double rhs[NB];
+    double res[NB];
+    double ws[dyn2b_workspace_size_crba(NB)];
+    double ws_rnea[dyn2b_workspace_size_rnea(NB)];
+
+    dyn2b_crba(NB, parent, jnt, axis, x_tree, rbi, d, q, h, ws);
+    dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, zero, NULL, c, ws_rnea);
+    for (int i = 0; i < NB; i++) {
+        rhs[i] = tau[i] - c[i];
+    }
+    dyn2b_ltdl_fct_mat(NB, parent, h, NB, fct);
+    dyn2b_ltdl_slv_mat(NB, 1, parent, fct, rhs, NB, res, NB);
+
+    // Same as the ABA
+    double qdd_aba[NB];
+    double ws_aba[dyn2b_workspace_size_aba(NB)];
+    dyn2b_aba(NB, parent, jnt, axis, x_tree, rbi, d, xdd_base,
+            q, qd, tau, NULL, qdd_aba, ws_aba);
+    for (int i = 0; i < NB; i++) {
+        ck_assert_flt_eq(res[i], qdd_aba[i]);
+    }
+}
+END_TEST
+
+
+TCase *crba_test()
+{
+    TCase *tc = tcase_create("CRBA");
+
+    tcase_add_test(tc, test_crba_rnea);
+    tcase_add_test(tc, test_crba_ltdl);
+
+    return tc;
+}
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/fk.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+#include <math.h>
+
+#include "common.h"
+#include "tree_model.h"
+
+
+// More joints than the sines and cosines of one pass
+#define NB_CONF 100
+
+
+START_TEST(test_jnt_to_pose3)
+{
+    int type[NB_CONF];
+    double axis[DYN2B_AXIS3_SIZE * NB_CONF];
+    double pos[NB_CONF];
+    double x_jnt[DYN2B_POSE3_SIZE * NB_CONF];
+
+    // All joint types with positions around the quadrants' boundaries, far
+    // from the origin and beyond the polynomials' range
+    for (int i = 0; i < NB_CONF; i++) {
+        double dir[3] = { 1.0, sin(1.0 + i), 2.0 };
+        dyn2b_to_axis3(dir, &axis[DYN2B_AXIS3_SIZE * i]);
+        type[i] = i % (DYN2B_JNT_TRANS + 1);
+        pos[i] = (i % 3 == 0) ? (i - 50) * M_PI_4 : 10.0 * sin(2.0 + i);
+    }
+    pos[1] = 1.0e3 + 0.1;
+    pos[2] = -4096.0;
+    pos[6] = 5.0e3;
+    pos[14] = -1.0e9;
+
+    dyn2b_jnt_to_pose3(NB_CONF, type, axis, pos, x_jnt);
+
+    for (int i = 0; i < NB_CONF; i++) {
+        const double *axis_i = &axis[DYN2B_AXIS3_SIZE * i];
+        double ref[DYN2B_POSE3_SIZE];
+        switch (type[i]) {
+        case DYN2B_JNT_REV_X: dyn2b_rev_x_to_pose3(&pos[i], ref); break;
+        case DYN2B_JNT_REV_Y: dyn2b_rev_y_to_pose3(&pos[i], ref); break;
+        case DYN2B_JNT_REV_Z: dyn2b_rev_z_to_pose3(&pos[i], ref); break;
+        case DYN2B_JNT_TRANS_X: dyn2b_trans_x_to_pose3(&pos[i], ref); break;
+        case DYN2B_JNT_TRANS_Y: dyn2b_trans_y_to_pose3(&pos[i], ref); break;
+        case DYN2B_JNT_TRANS_Z: dyn2b_trans_z_to_pose3(&pos[i], ref); break;
+        case DYN2B_JNT_REV: dyn2b_rev_to_pose3(axis_i, &pos[i], ref); break;
+        case DYN2B_JNT_TRANS: dyn2b_trans_to_pose3(axis_i, &pos[i], ref); break;
+        }
+
+        // Within the documented error bound of the sines and cosines, which
+        // Rodrigues' formula amplifies by at most a few units
+        for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+            double err = fabs(x_jnt[(DYN2B_POSE3_SIZE * i) + k] - ref[k]);
+            ck_assert_msg(err <= 1.0e-15 * fmax(1.0, fabs(ref[k])),
+                    "Joint %d (type %d, q = %g), entry %d: error %g",
+                    i, type[i], pos[i], k, err);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_fk)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    double x[DYN2B_POSE3_SIZE * NB];
+    double x_jnt[DYN2B_POSE3_SIZE * NB];
+    tree_axis(axis);
+
+    dyn2b_fk(NB, parent, jnt, axis, x_tree, q, x);
+
+    // Compose the joint poses from the base outwards
+    dyn2b_jnt_to_pose3(NB, jnt, axis, q, x_jnt);
+    double ref[DYN2B_POSE3_SIZE * NB];
+    for (int i = 0; i < NB; i++) {
+        double x_rel[DYN2B_POSE3_SIZE];
+        dyn2b_cmp_pose3(&x_tree[DYN2B_POSE3_SIZE * i],
+                &x_jnt[DYN2B_POSE3_SIZE * i], x_rel);
+        if (parent[i] < 0) {
+            for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+                ref[(DYN2B_POSE3_SIZE * i) + k] = x_rel[k];
+            }
+        } else {
+            dyn2b_cmp_pose3(&ref[DYN2B_POSE3_SIZE * parent[i]], x_rel,
+                    &ref[DYN2B_POSE3_SIZE * i]);
+        }
+    }
+
+    for (int i = 0; i < DYN2B_POSE3_SIZE * NB; i++) {
+        ck_assert_flt_eq(x[i], ref[i]);
+    }
+
+    // The bodies' poses with respect to their parents
+    double x_rel[DYN2B_POSE3_SIZE * NB];
+    dyn2b_jnt_cmp_pose3(NB, jnt, axis, x_tree, q, x_rel);
+    for (int i = 0; i < NB; i++) {
+        double res[DYN2B_POSE3_SIZE];
+        dyn2b_cmp_pose3(&x_tree[DYN2B_POSE3_SIZE * i],
+                &x_jnt[DYN2B_POSE3_SIZE * i], res);
+        for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+            ck_assert_flt_eq(x_rel[(DYN2B_POSE3_SIZE * i) + k], res[k]);
+        }
+    }
+
+    // Body 2 sits at the tree's offset (0.3) plus the position of its prismatic
+    // joint (0.2) along body 0's y-axis
+    const double *x_0 = &x[DYN2B_POSE3_SIZE * 0];
+    const double *x_2 = &x[DYN2B_POSE3_SIZE * 2];
+    for (int k = 0; k < 3; k++) {
+        ck_assert_flt_eq(x_2[DYN2B_POSE3_LIN_OFFSET + k],
+                x_0[DYN2B_POSE3_LIN_OFFSET + k]
+                + 0.5 * x_0[DYN2B_POSE3_ANG_OFFSET
+                        + (DYN2B_POSE3_ANG_LD * 1) + k]);
+    }
+}
+END_TEST
+
+
+TCase *fk_test()
+{
+    TCase *tc = tcase_create("FK");
+
+    tcase_add_test(tc, test_jnt_to_pose3);
+    tcase_add_test(tc, test_fk);
+
+    return tc;
+}
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/functions/mechanics.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/jointf.h>
+#include <dyn2b/functions/mechanicsf.h>
+#include <dyn2b/functions/screwf.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+#include <math.h>
+
+#include "common.h"
+
+
+// The single-precision API must agree with the double-precision reference up
+// to a small multiple of the float machine epsilon (~1.2e-7) times the
+// magnitude of the result. The bound leaves room for the accumulation in the
+// longer chains of operations (e.g. the LAPACK inversion).
+#define FLT_TOL 1e-5
+
+#define N 2
+
+
+static void to_flt(
+        int n,
+        const double *in,
+        float *out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = (float)in[i];
+    }
+}
+
+
+static void ck_assert_flt_close(
+        int n,
+        const float *flt,
+        const double *dbl)
+{
+    double scale = 1.0;
+    for (int i = 0; i < n; i++) {
+        scale = fmax(scale, fabs(dbl[i]));
+    }
+
+    for (int i = 0; i < n; i++) {
+        double err = fabs((double)flt[i] - dbl[i]);
+        ck_assert_msg(err <= FLT_TOL * scale,
+                "Entry %d: float %g vs. double %g (error %g > %g)",
+                i, (double)flt[i], dbl[i], err, FLT_TOL * scale);
+    }
+}
+
+
+// Pose: rotation about (1, 2, 2) / 3 by 0.7 rad with an offset
+static void pose(
+        double *x)
+{
+    const double dir[3] = { 1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0 };
+    const double q[1] = { 0.7 };
+    double axis[DYN2B_AXIS3_SIZE];
+
+    dyn2b_to_axis3(dir, axis);
+    dyn2b_rev_to_pose3(axis, q, x);
+    x[DYN2B_POSE3_LIN_OFFSET + 0] = 0.3;
+    x[DYN2B_POSE3_LIN_OFFSET + 1] = -1.2;
+    x[DYN2B_POSE3_LIN_OFFSET + 2] = 0.8;
+}
+
+
+// Arbitrary values of order one
+static void fill(
+        int n,
+        int seed,
+        double *out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = sin(seed + 1.3 * i);
+    }
+}
+
+
+// Rigid-body inertia
+static const double rbi[DYN2B_RBI3_SIZE] = {
+    // I
+    0.9, 0.1, -0.2,
+    0.1, 1.4, 0.05,
+    -0.2, 0.05, 1.1,
+    // h
+    0.2, -0.4, 0.6,
+    // m
+    2.0
+};
+
+
+START_TEST(test_screw3_float)
+{
+    double x1[DYN2B_POSE3_SIZE], x2[DYN2B_POSE3_SIZE], x3[DYN2B_POSE3_SIZE];
+    double s1[DYN2B_SCREW3_SIZE * N], s2[DYN2B_SCREW3_SIZE * N];
+    double sd[DYN2B_SCREW3_SIZE * N];
+    float x1f[DYN2B_POSE3_SIZE], x2f[DYN2B_POSE3_SIZE], x3f[DYN2B_POSE3_SIZE];
+    float s1f[DYN2B_SCREW3_SIZE * N], s2f[DYN2B_SCREW3_SIZE * N];
+    float sdf[DYN2B_SCREW3_SIZE * N];
+
+    pose(x1);
+    dyn2b_cmp_pose3(x1, x1, x2);
+    fill(DYN2B_SCREW3_SIZE * N, 1, s1);
+    fill(DYN2B_SCREW3_SIZE * N, 2, s2);
+    to_flt(DYN2B_POSE3_SIZE, x1, x1f);
+    to_flt(DYN2B_POSE3_SIZE, x2, x2f);
+    to_flt(DYN2B_SCREW3_SIZE * N, s1, s1f);
+    to_flt(DYN2B_SCREW3_SIZE * N, s2, s2f);
+
+    dyn2b_cmp_pose3(x1, x2, x3);
+    dyn2b_cmp_pose3f(x1f, x2f, x3f);
+    ck_assert_flt_close(DYN2B_POSE3_SIZE, x3f, x3);
+
+    dyn2b_crs_screw3(s1, s2, sd);
+    dyn2b_crs_screw3f(s1f, s2f, sdf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE, sdf, sd);
+
+    dyn2b_tf_dist_screw3(N, x3, s1, sd);
+    dyn2b_tf_dist_screw3f(N, x3f, s1f, sdf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE * N, sdf, sd);
+
+    dyn2b_tf_prox_screw3(N, x3, s2, sd);
+    dyn2b_tf_prox_screw3f(N, x3f, s2f, sdf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE * N, sdf, sd);
+}
+END_TEST
+
+
+START_TEST(test_mechanics_float)
+{
+    double x[DYN2B_POSE3_SIZE];
+    double xd[DYN2B_SCREW3_SIZE], xd_rel[DYN2B_SCREW3_SIZE];
+    double xdd[DYN2B_SCREW3_SIZE], out[DYN2B_RBI3_SIZE];
+    float xf[DYN2B_POSE3_SIZE], rbif[DYN2B_RBI3_SIZE];
+    float xdf[DYN2B_SCREW3_SIZE], xd_relf[DYN2B_SCREW3_SIZE];
+    float xddf[DYN2B_SCREW3_SIZE], outf[DYN2B_RBI3_SIZE];
+
+    pose(x);
+    fill(DYN2B_SCREW3_SIZE, 3, xd);
+    fill(DYN2B_SCREW3_SIZE, 4, xd_rel);
+    fill(DYN2B_SCREW3_SIZE, 5, xdd);
+    to_flt(DYN2B_POSE3_SIZE, x, xf);
+    to_flt(DYN2B_RBI3_SIZE, rbi, rbif);
+    to_flt(DYN2B_SCREW3_SIZE, xd, xdf);
+    to_flt(DYN2B_SCREW3_SIZE, xd_rel, xd_relf);
+    to_flt(DYN2B_SCREW3_SIZE, xdd, xddf);
+
+    dyn2b_tf_dist_acc3(x, xd, xd_rel, xdd, out);
+    dyn2b_tf_dist_acc3f(xf, xdf, xd_relf, xddf, outf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE, outf, out);
+
+    dyn2b_rbi_to_wrench3(rbi, xdd, out);
+    dyn2b_rbi_to_wrench3f(rbif, xddf, outf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE, outf, out);
+
+    dyn2b_nrt_wrench3(rbi, xd, out);
+    dyn2b_nrt_wrench3f(rbif, xdf, outf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE, outf, out);
+
+    dyn2b_eom_wrench3(rbi, xd, xdd, out);
+    dyn2b_eom_wrench3f(rbif, xdf, xddf, outf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE, outf, out);
+
+    dyn2b_tf_prox_rbi3(x, rbi, out);
+    dyn2b_tf_prox_rbi3f(xf, rbif, outf);
+    ck_assert_flt_close(DYN2B_RBI3_SIZE, outf, out);
+}
+END_TEST
+
+
+START_TEST(test_joint_float)
+{
+    const double dir[3] = { 0.0, 0.6, 0.8 };
+    const double q[1] = { -1.1 };
+    const double d[N * N] = { 0.5, 0.0, 0.0, 0.7 };
+    double axis[DYN2B_AXIS3_SIZE], x[DYN2B_POSE3_SIZE];
+    double m_dist[DYN2B_ABI3_SIZE], m[DYN2B_ABI3_SIZE];
+    double m_out[DYN2B_ABI3_SIZE], m_mat[36];
+    double jac[DYN2B_SCREW3_SIZE * N], f[DYN2B_SCREW3_SIZE * N];
+    double f_out[DYN2B_SCREW3_SIZE * N], dstms[N * N];
+    float axisf[DYN2B_AXIS3_SIZE], xf[DYN2B_POSE3_SIZE], qf[1], df[N * N];
+    float mf[DYN2B_ABI3_SIZE], m_outf[DYN2B_ABI3_SIZE], m_matf[36];
+    float jacf[DYN2B_SCREW3_SIZE * N], ff[DYN2B_SCREW3_SIZE * N];
+    float f_outf[DYN2B_SCREW3_SIZE * N], dstmsf[N * N];
+
+    dyn2b_to_axis3(dir, axis);
+    fill(DYN2B_SCREW3_SIZE * N, 6, jac);
+    fill(DYN2B_SCREW3_SIZE * N, 7, f);
+    to_flt(DYN2B_AXIS3_SIZE, axis, axisf);
+    to_flt(1, q, qf);
+    to_flt(N * N, d, df);
+    to_flt(DYN2B_SCREW3_SIZE * N, jac, jacf);
+    to_flt(DYN2B_SCREW3_SIZE * N, f, ff);
+
+    dyn2b_rev_to_pose3(axis, q, x);
+    dyn2b_rev_to_pose3f(axisf, qf, xf);
+    ck_assert_flt_close(DYN2B_POSE3_SIZE, xf, x);
+
+    // A non-trivial articulated-body inertia (same input for both precisions)
+    dyn2b_to_abi3(rbi, m_dist);
+    dyn2b_tf_prox_abi3(x, m_dist, m);
+    to_flt(DYN2B_ABI3_SIZE, m, mf);
+
+    dyn2b_tf_prox_abi3(x, m, m_out);
+    dyn2b_tf_prox_abi3f(xf, mf, m_outf);
+    ck_assert_flt_close(DYN2B_ABI3_SIZE, m_outf, m_out);
+
+    dyn2b_rev_proj_abi3(axis, d, m, m_out);
+    dyn2b_rev_proj_abi3f(axisf, df, mf, m_outf);
+    ck_assert_flt_close(DYN2B_ABI3_SIZE, m_outf, m_out);
+
+    dyn2b_rev_proj_wrench3(N, axis, d, m, f, f_out);
+    dyn2b_rev_proj_wrench3f(N, axisf, df, mf, ff, f_outf);
+    ck_assert_flt_close(DYN2B_SCREW3_SIZE * N, f_outf, f_out);
+
+    dyn2b_to_mat_abi3(m, m_mat);
+    dyn2b_to_mat_abi3f(mf, m_matf);
+    ck_assert_flt_close(36, m_matf, m_mat);
+
+    dyn2b_jnt_inv_abi3(N, jac, m_mat, d, dstms);
+    dyn2b_jnt_inv_abi3f(N, jacf, m_matf, df, dstmsf);
+    ck_assert_flt_close(N * N, dstmsf, dstms);
+}
+END_TEST
+
+
+TCase *float_test()
+{
+    TCase *tc = tcase_create("Float");
+
+    tcase_add_test(tc, test_screw3_float);
+    tcase_add_test(tc, test_mechanics_float);
+    tcase_add_test(tc, test_joint_float);
+
+    return tc;
+}
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: LGPL-3.0
+// Compiled with DYN2B_INLINE (cf. CMakeLists.txt), i.e. the tiny operators in
+// this file are the header-only definitions and not the library's
+#include <dyn2b/functions/array.h>
+#include <dyn2b/functions/vector3.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <check.h>
+#include <math.h>
+
+#include "common.h"
+
+#ifndef DYN2B_INLINE
+#  error "inline_test.c must be compiled with DYN2B_INLINE"
+#endif
+
+
+START_TEST(test_inline_vec3)
+{
+    double a[3 * 2] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+    double b[3 * 2] = { 2.0, 3.0, 4.0, 6.0, 7.0, 8.0 };
+    double out[3 * 2];
+    double skw[9];
+
+    double res_crs[3 * 2] = { -1.0, 2.0, -1.0, -2.0, 4.0, -2.0 };
+    dyn2b_crs_vec3(2, a, 3, b, 3, out, 3);
+    for (int i = 0; i < 3 * 2; i++) {
+        ck_assert_flt_eq(out[i], res_crs[i]);
+    }
+
+    double res_cad[3 * 2] = { 0.0, 4.0, 2.0, 2.0, 9.0, 4.0 };
+    dyn2b_cad_vec3(2, a, 3, a, 3, b, 3, out, 3);
+    for (int i = 0; i < 3 * 2; i++) {
+        ck_assert_flt_eq(out[i], res_cad[i]);
+    }
+
+    // Column-major layout
+    double res_skw[9] = {
+         0.0,  3.0, -2.0,
+        -3.0,  0.0,  1.0,
+         2.0, -1.0,  0.0
+    };
+    dyn2b_skw_vec3(a, skw);
+    for (int i = 0; i < 9; i++) {
+        ck_assert_flt_eq(skw[i], res_skw[i]);
+    }
+
+    double res_sub[3] = { -1.0, -1.0, -1.0 };
+    dyn2b_sub_arr(3, a, b, out);
+    for (int i = 0; i < 3; i++) {
+        ck_assert_flt_eq(out[i], res_sub[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_inline_joint)
+{
+    double q = 0.3;
+    double x[DYN2B_POSE3_SIZE];
+    double xd[DYN2B_TWIST3_SIZE];
+    double f[DYN2B_WRENCH3_SIZE * 2] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0,
+        7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    double tau[2];
+
+    double res_x[DYN2B_POSE3_SIZE] = {
+        cos(q), sin(q), 0.0,
+        -sin(q), cos(q), 0.0,
+        0.0, 0.0, 1.0,
+        0.0, 0.0, 0.0
+    };
+    dyn2b_rev_z_to_pose3(&q, x);
+    for (int i = 0; i < DYN2B_POSE3_SIZE; i++) {
+        ck_assert_flt_eq(x[i], res_x[i]);
+    }
+
+    double res_xd[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.3, 0.0, 0.0, 0.0 };
+    dyn2b_rev_z_to_twist3(&q, xd);
+    for (int i = 0; i < DYN2B_TWIST3_SIZE; i++) {
+        ck_assert_flt_eq(xd[i], res_xd[i]);
+    }
+
+    // Linear-before-angular order
+    dyn2b_rev_x_from_wrench3(2, f, tau);
+    ck_assert_flt_eq(tau[0], 4.0);
+    ck_assert_flt_eq(tau[1], 10.0);
+
+    dyn2b_trans_y_from_wrench3(2, f, tau);
+    ck_assert_flt_eq(tau[0], 2.0);
+    ck_assert_flt_eq(tau[1], 8.0);
+}
+END_TEST
+
+
+TCase *inline_test()
+{
+    TCase *tc = tcase_create("Inline");
+
+    tcase_add_test(tc, test_inline_vec3);
+    tcase_add_test(tc, test_inline_joint);
+
+    return tc;
+}
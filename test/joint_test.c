@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: LGPL-3.0
 #include <dyn2b/functions/joint.h>
+#include <dyn2b/functions/matrix.h>
 #include <dyn2b/functions/mechanics.h>
+#include <dyn2b/functions/screw.h>
 #include <dyn2b/types/screw.h>
 #include <dyn2b/types/mechanics.h>
 #include <dyn2b/types/joint.h>
+#include <dyn2b/types/dual.h>
 #include <check.h>
 #include <math.h>
 
@@ -164,6 +167,41 @@ START_TEST(test_trans_z_to_pose3)
 END_TEST
 
 
+// The sparse composition equals the dense one with the joint's pose
+START_TEST(test_cmp_pose3)
+{
+    const double q = 0.7;
+
+    // Rotation about (1, 1, 1) by 2 pi / 3 followed by a translation
+    const double x_prox[DYN2B_POSE3_SIZE] = { // column-major layout
+        0.0, 1.0, 0.0,
+        0.0, 0.0, 1.0,
+        1.0, 0.0, 0.0,
+        1.0, 2.0, 3.0
+    };
+    double x_jnt[DYN2B_POSE3_SIZE];
+    double res[DYN2B_POSE3_SIZE];
+    double out[DYN2B_POSE3_SIZE];
+
+#define CHECK_CMP_POSE3(jnt, ...) \
+    dyn2b_##jnt##_to_pose3(&q, x_jnt); \
+    dyn2b_cmp_pose3(x_prox, x_jnt, res); \
+    dyn2b_##jnt##_cmp_pose3(x_prox, __VA_ARGS__, out); \
+    for (int i = 0; i < DYN2B_POSE3_SIZE; i++) { \
+        ck_assert_flt_eq(out[i], res[i]); \
+    }
+
+    CHECK_CMP_POSE3(rev_x, cos(q), sin(q))
+    CHECK_CMP_POSE3(rev_y, cos(q), sin(q))
+    CHECK_CMP_POSE3(rev_z, cos(q), sin(q))
+    CHECK_CMP_POSE3(trans_x, &q)
+    CHECK_CMP_POSE3(trans_y, &q)
+    CHECK_CMP_POSE3(trans_z, &q)
+#undef CHECK_CMP_POSE3
+}
+END_TEST
+
+
 START_TEST(test_rev_x_to_twist3)
 {
     double in[1] = { 1.0 };
@@ -447,6 +485,47 @@ START_TEST(test_tf_prox_abi3)
     for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
         ck_assert_flt_eq(out[i], res[i]);
     }
+
+    // The same pose with a quaternion: -2 pi / 3 about (1, 1, 1)
+    double tfq[DYN2B_POSE3Q_SIZE] = { -0.5, -0.5, -0.5, 0.5, 1.0, 2.0, 3.0 };
+    dyn2b_tf_prox_abi3q(tfq, in, out);
+    for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_tf_prox_abi3_batch)
+{
+    const int ld = N + 1;
+    double tf[DYN2B_POSE3_SIZE * N] = {
+        0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0,
+        cos(M_PI_4), 0.0, -sin(M_PI_4), 0.0, 1.0, 0.0,
+        sin(M_PI_4), 0.0,  cos(M_PI_4), 3.0, 2.0, 1.0
+    };
+    double tf_soa[DYN2B_POSE3_SIZE * (N + 1)];
+    double in_soa[DYN2B_ABI3_SIZE * (N + 1)];
+    double out_soa[DYN2B_ABI3_SIZE * (N + 1)];
+    double res[DYN2B_ABI3_SIZE];
+
+    // Both instances transform the same articulated-body inertia
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < DYN2B_POSE3_SIZE; j++) {
+            tf_soa[(j * ld) + i] = tf[(i * DYN2B_POSE3_SIZE) + j];
+        }
+        for (int j = 0; j < DYN2B_ABI3_SIZE; j++) {
+            in_soa[(j * ld) + i] = m[j];
+        }
+    }
+
+    dyn2b_tf_prox_abi3_batch(N, ld, tf_soa, in_soa, out_soa);
+    for (int i = 0; i < N; i++) {
+        dyn2b_tf_prox_abi3(&tf[i * DYN2B_POSE3_SIZE], m, res);
+        for (int j = 0; j < DYN2B_ABI3_SIZE; j++) {
+            ck_assert_flt_eq(out_soa[(j * ld) + i], res[j]);
+        }
+    }
 }
 END_TEST
 
@@ -845,6 +924,411 @@ START_TEST(test_to_tup_abi3)
 END_TEST
 
 
+START_TEST(test_pck_abi3)
+{
+    double packed[DYN2B_ABI3P_SIZE];
+    double out[DYN2B_ABI3_SIZE];
+
+    double res[DYN2B_ABI3P_SIZE] = {
+        // I
+        1.0, 2.0, 2.0, 3.0, 3.0, 3.0,
+        // H
+        2.0, 3.0, 4.0,
+        3.0, 3.0, 4.0,
+        4.0, 4.0, 4.0,
+        // M
+        4.0, 5.0, 5.0, 6.0, 6.0, 6.0
+    };
+
+    dyn2b_pck_abi3(m, packed);
+    for (int i = 0; i < DYN2B_ABI3P_SIZE; i++) {
+        ck_assert_flt_eq(packed[i], res[i]);
+    }
+
+    dyn2b_unp_abi3(packed, out);
+    for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], m[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_to_abi3p)
+{
+    double in[DYN2B_RBI3P_SIZE] = {
+        // I
+        3.0, 4.0, 6.0, 5.0, 7.0, 8.0,
+        // h
+        4.0, 6.0, 8.0,
+        // m
+        2.0
+    };
+    double out[DYN2B_ABI3P_SIZE];
+
+    double res[DYN2B_ABI3P_SIZE] = {
+        // I
+         3.0, 4.0, 6.0, 5.0, 7.0, 8.0,
+        // H
+         0.0,  8.0, -6.0,
+        -8.0,  0.0,  4.0,
+         6.0, -4.0,  0.0,
+        // M
+         2.0, 0.0, 2.0, 0.0, 0.0, 2.0
+    };
+    dyn2b_to_abi3p(in, out);
+    for (int i = 0; i < DYN2B_ABI3P_SIZE; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_tf_prox_abi3p)
+{
+    double tf[DYN2B_POSE3_SIZE] = {
+        cos(M_PI_4), 0.0, -sin(M_PI_4),
+            0.0    , 1.0,      0.0    ,
+        sin(M_PI_4), 0.0,  cos(M_PI_4),
+            3.0    , 2.0,      1.0
+    };
+    double in[DYN2B_ABI3P_SIZE];
+    double out[DYN2B_ABI3P_SIZE];
+    double out_unp[DYN2B_ABI3_SIZE];
+
+    double res[DYN2B_ABI3_SIZE];
+    dyn2b_tf_prox_abi3(tf, m, res);
+
+    dyn2b_pck_abi3(m, in);
+    dyn2b_tf_prox_abi3p(tf, in, out);
+    dyn2b_unp_abi3(out, out_unp);
+    for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
+        ck_assert_flt_eq(out_unp[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_abi_to_wrench3p)
+{
+    double xdd[DYN2B_TWIST3_SIZE * N] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0,
+        6.0, 5.0, 4.0, 3.0, 2.0, 1.0
+    };
+    double in[DYN2B_ABI3P_SIZE];
+    double out[DYN2B_WRENCH3_SIZE * N];
+
+    double res[DYN2B_WRENCH3_SIZE * N];
+    dyn2b_abi_to_wrench3(N, m, xdd, res);
+
+    dyn2b_pck_abi3(m, in);
+    dyn2b_abi_to_wrench3p(N, in, xdd, out);
+    for (int i = 0; i < DYN2B_WRENCH3_SIZE * N; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_proj_abi3p)
+{
+    void (*proj[])(const double *, const double *, double *) = {
+        dyn2b_rev_x_proj_abi3, dyn2b_rev_y_proj_abi3, dyn2b_rev_z_proj_abi3,
+        dyn2b_trans_x_proj_abi3, dyn2b_trans_y_proj_abi3,
+        dyn2b_trans_z_proj_abi3
+    };
+    void (*proj_p[])(const double *, const double *, double *) = {
+        dyn2b_rev_x_proj_abi3p, dyn2b_rev_y_proj_abi3p,
+        dyn2b_rev_z_proj_abi3p, dyn2b_trans_x_proj_abi3p,
+        dyn2b_trans_y_proj_abi3p, dyn2b_trans_z_proj_abi3p
+    };
+    double in[DYN2B_ABI3P_SIZE];
+    double out[DYN2B_ABI3P_SIZE];
+    double out_unp[DYN2B_ABI3_SIZE];
+    double res[DYN2B_ABI3_SIZE];
+
+    dyn2b_pck_abi3(m, in);
+    for (int j = 0; j < 6; j++) {
+        proj[j](d, m, res);
+        proj_p[j](d, in, out);
+        dyn2b_unp_abi3(out, out_unp);
+        for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
+            ck_assert_flt_eq(out_unp[i], res[i]);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_proj_wrench3p)
+{
+    void (*proj[])(int, const double *, const double *, const double *,
+            double *) = {
+        dyn2b_rev_x_proj_wrench3, dyn2b_rev_y_proj_wrench3,
+        dyn2b_rev_z_proj_wrench3, dyn2b_trans_x_proj_wrench3,
+        dyn2b_trans_y_proj_wrench3, dyn2b_trans_z_proj_wrench3
+    };
+    void (*proj_p[])(int, const double *, const double *, const double *,
+            double *) = {
+        dyn2b_rev_x_proj_wrench3p, dyn2b_rev_y_proj_wrench3p,
+        dyn2b_rev_z_proj_wrench3p, dyn2b_trans_x_proj_wrench3p,
+        dyn2b_trans_y_proj_wrench3p, dyn2b_trans_z_proj_wrench3p
+    };
+    double in[DYN2B_ABI3P_SIZE];
+    double out[DYN2B_WRENCH3_SIZE * N];
+    double res[DYN2B_WRENCH3_SIZE * N];
+
+    dyn2b_pck_abi3(m, in);
+    for (int j = 0; j < 6; j++) {
+        proj[j](N, d, m, w, res);
+        proj_p[j](N, d, in, w, out);
+        for (int i = 0; i < DYN2B_WRENCH3_SIZE * N; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_to_axis3)
+{
+    double dir[3] = { 0.0, 3.0, 4.0 };
+    double out[DYN2B_AXIS3_SIZE];
+
+    double res[DYN2B_AXIS3_SIZE] = {
+        // a
+        0.0, 0.6, 0.8,
+        // a a^T (packed)
+        0.0, 0.0, 0.36, 0.0, 0.48, 0.64
+    };
+
+    dyn2b_to_axis3(dir, out);
+    for (int i = 0; i < DYN2B_AXIS3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_axis_principal)
+{
+    // An arbitrary axis that coincides with a principal axis must reproduce
+    // the joint-specific functions
+    void (*to_pose[])(const double *, double *) = {
+        dyn2b_rev_x_to_pose3, dyn2b_rev_y_to_pose3, dyn2b_rev_z_to_pose3,
+        dyn2b_trans_x_to_pose3, dyn2b_trans_y_to_pose3,
+        dyn2b_trans_z_to_pose3
+    };
+    void (*to_twist[])(const double *, double *) = {
+        dyn2b_rev_x_to_twist3, dyn2b_rev_y_to_twist3, dyn2b_rev_z_to_twist3,
+        dyn2b_trans_x_to_twist3, dyn2b_trans_y_to_twist3,
+        dyn2b_trans_z_to_twist3
+    };
+    void (*from_wrench[])(int, const double *, double *) = {
+        dyn2b_rev_x_from_wrench3, dyn2b_rev_y_from_wrench3,
+        dyn2b_rev_z_from_wrench3, dyn2b_trans_x_from_wrench3,
+        dyn2b_trans_y_from_wrench3, dyn2b_trans_z_from_wrench3
+    };
+    void (*proj_abi[])(const double *, const double *, double *) = {
+        dyn2b_rev_x_proj_abi3, dyn2b_rev_y_proj_abi3, dyn2b_rev_z_proj_abi3,
+        dyn2b_trans_x_proj_abi3, dyn2b_trans_y_proj_abi3,
+        dyn2b_trans_z_proj_abi3
+    };
+    void (*proj_wrench[])(int, const double *, const double *,
+            const double *, double *) = {
+        dyn2b_rev_x_proj_wrench3, dyn2b_rev_y_proj_wrench3,
+        dyn2b_rev_z_proj_wrench3, dyn2b_trans_x_proj_wrench3,
+        dyn2b_trans_y_proj_wrench3, dyn2b_trans_z_proj_wrench3
+    };
+    // Revolute and prismatic joint with an arbitrary axis
+    void (*ax_to_pose[])(const double *, const double *, double *) = {
+        dyn2b_rev_to_pose3, dyn2b_trans_to_pose3
+    };
+    void (*ax_to_twist[])(const double *, const double *, double *) = {
+        dyn2b_rev_to_twist3, dyn2b_trans_to_twist3
+    };
+    void (*ax_from_wrench[])(int, const double *, const double *,
+            double *) = {
+        dyn2b_rev_from_wrench3, dyn2b_trans_from_wrench3
+    };
+    void (*ax_proj_abi[])(const double *, const double *, const double *,
+            double *) = {
+        dyn2b_rev_proj_abi3, dyn2b_trans_proj_abi3
+    };
+    void (*ax_proj_wrench[])(int, const double *, const double *,
+            const double *, const double *, double *) = {
+        dyn2b_rev_proj_wrench3, dyn2b_trans_proj_wrench3
+    };
+
+    double q[1] = { 0.7 };
+    double axis[DYN2B_AXIS3_SIZE];
+    double out[DYN2B_ABI3_SIZE];
+    double res[DYN2B_ABI3_SIZE];
+
+    for (int j = 0; j < 6; j++) {
+        double dir[3] = { 0.0, 0.0, 0.0 };
+        dir[j % 3] = 2.0;
+        dyn2b_to_axis3(dir, axis);
+
+        to_pose[j](q, res);
+        ax_to_pose[j / 3](axis, q, out);
+        for (int i = 0; i < DYN2B_POSE3_SIZE; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+
+        to_twist[j](q, res);
+        ax_to_twist[j / 3](axis, q, out);
+        for (int i = 0; i < DYN2B_TWIST3_SIZE; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+
+        from_wrench[j](N, w, res);
+        ax_from_wrench[j / 3](N, axis, w, out);
+        for (int i = 0; i < N; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+
+        proj_abi[j](d, m, res);
+        ax_proj_abi[j / 3](axis, d, m, out);
+        for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+
+        proj_wrench[j](N, d, m, w, res);
+        ax_proj_wrench[j / 3](N, axis, d, m, w, out);
+        for (int i = 0; i < DYN2B_WRENCH3_SIZE * N; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_axis_tilted)
+{
+    void (*ax_proj_abi[])(const double *, const double *, const double *,
+            double *) = {
+        dyn2b_rev_proj_abi3, dyn2b_trans_proj_abi3
+    };
+    void (*ax_proj_wrench[])(int, const double *, const double *,
+            const double *, const double *, double *) = {
+        dyn2b_rev_proj_wrench3, dyn2b_trans_proj_wrench3
+    };
+
+    double dir[3] = { 1.0, 1.0, 1.0 };
+    double axis[DYN2B_AXIS3_SIZE];
+    dyn2b_to_axis3(dir, axis);
+
+    // A rotation by 120 degrees about (1, 1, 1) permutes the principal axes
+    double q[1] = { 2.0 * M_PI / 3.0 };
+    double x[DYN2B_POSE3_SIZE];
+    double x_res[DYN2B_POSE3_SIZE] = { // column-major layout
+        0.0, 1.0, 0.0,
+        0.0, 0.0, 1.0,
+        1.0, 0.0, 0.0,
+        0.0, 0.0, 0.0
+    };
+    dyn2b_rev_to_pose3(axis, q, x);
+    for (int i = 0; i < DYN2B_POSE3_SIZE; i++) {
+        ck_assert_flt_eq(x[i], x_res[i]);
+    }
+
+    // Compare the projections with the generic joint: k = 0 is the revolute
+    // joint (S = [a; 0]), k = 1 the prismatic joint (S = [0; a])
+    double out[DYN2B_ABI3_SIZE];
+    double res[DYN2B_ABI3_SIZE];
+    for (int k = 0; k < 2; k++) {
+        double jac[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+        for (int i = 0; i < 3; i++) {
+            jac[(3 * k) + i] = axis[DYN2B_AXIS3_DIR_OFFSET + i];
+        }
+
+        dyn2b_jnt_proj_abi3(1, jac, d, m, res);
+        ax_proj_abi[k](axis, d, m, out);
+        for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+
+        dyn2b_jnt_proj_wrench3(N, 1, jac, d, m, w, res);
+        ax_proj_wrench[k](N, axis, d, m, w, out);
+        for (int i = 0; i < DYN2B_WRENCH3_SIZE * N; i++) {
+            ck_assert_flt_eq(out[i], res[i]);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_axis_dual)
+{
+    void (*ax_to_pose[])(const double *, const double *, double *) = {
+        dyn2b_rev_to_pose3, dyn2b_trans_to_pose3
+    };
+    void (*ax_to_pose_dual[])(const double *, const double *, double *) = {
+        dyn2b_rev_to_pose3_dual, dyn2b_trans_to_pose3_dual
+    };
+    void (*ax_to_twist[])(const double *, const double *, double *) = {
+        dyn2b_rev_to_twist3, dyn2b_trans_to_twist3
+    };
+    void (*ax_to_twist_dual[])(const double *, const double *, double *) = {
+        dyn2b_rev_to_twist3_dual, dyn2b_trans_to_twist3_dual
+    };
+
+    const double eps = 1e-5;
+    double dir[3] = { 1.0, 2.0, 2.0 };
+    double axis[DYN2B_AXIS3_SIZE];
+    dyn2b_to_axis3(dir, axis);
+
+    double q[DYN2B_DUAL_SIZE(1)] = { 0.4 };
+    dual_seed(1, q);
+
+    // k = 0 is the revolute joint, k = 1 the prismatic joint
+    for (int k = 0; k < 2; k++) {
+        double x[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)];
+        double xd[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+        double x_res[DYN2B_POSE3_SIZE];
+        double xd_res[DYN2B_TWIST3_SIZE];
+        ax_to_pose_dual[k](axis, q, x);
+        ax_to_twist_dual[k](axis, q, xd);
+        ax_to_pose[k](axis, q, x_res);
+        ax_to_twist[k](axis, q, xd_res);
+        for (int i = 0; i < DYN2B_POSE3_SIZE; i++) {
+            ck_assert_flt_eq(x[i], x_res[i]);
+        }
+        for (int i = 0; i < DYN2B_TWIST3_SIZE; i++) {
+            ck_assert_flt_eq(xd[i], xd_res[i]);
+        }
+
+        // Central differences along each tangent direction
+        for (int j = 0; j < DYN2B_DUAL_K; j++) {
+            double q_p, q_m;
+            double x_p[DYN2B_POSE3_SIZE], x_m[DYN2B_POSE3_SIZE];
+            double xd_p[DYN2B_TWIST3_SIZE], xd_m[DYN2B_TWIST3_SIZE];
+            dual_at(1, q, j, eps, &q_p);
+            dual_at(1, q, j, -eps, &q_m);
+
+            ax_to_pose[k](axis, &q_p, x_p);
+            ax_to_pose[k](axis, &q_m, x_m);
+            for (int i = 0; i < DYN2B_POSE3_SIZE; i++) {
+                ck_assert_flt_eq(
+                        x[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE)
+                                + (i * DYN2B_DUAL_TAN_LD) + j],
+                        (x_p[i] - x_m[i]) / (2.0 * eps));
+            }
+
+            ax_to_twist[k](axis, &q_p, xd_p);
+            ax_to_twist[k](axis, &q_m, xd_m);
+            for (int i = 0; i < DYN2B_TWIST3_SIZE; i++) {
+                ck_assert_flt_eq(
+                        xd[DYN2B_DUAL_TAN_OFFSET(DYN2B_TWIST3_SIZE)
+                                + (i * DYN2B_DUAL_TAN_LD) + j],
+                        (xd_p[i] - xd_m[i]) / (2.0 * eps));
+            }
+        }
+    }
+}
+END_TEST
+
+
 START_TEST(test_jnt_inv_abi3)
 {
     double s2[DYN2B_SCREW3_SIZE * 2] = {
@@ -881,6 +1365,47 @@ START_TEST(test_jnt_inv_abi3)
 END_TEST
 
 
+START_TEST(test_jnt_fct_abi3)
+{
+    double s2[DYN2B_SCREW3_SIZE * 2] = {
+        0.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0, 0.0
+    };
+    double d2[2 * 2] = {
+         3.0, -2.0,
+        -2.0,  5.0
+    };
+    double eye[2 * 2] = {
+        1.0, 0.0,
+        0.0, 1.0
+    };
+    double fct[2 * 2];
+    double out[2 * 2];
+
+    double m_mat[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
+    dyn2b_to_mat_abi3(m, m_mat);
+
+    // D = [5 1; 1 8] = L D' L^T with L = [1 0; 0.2 1], D' = diag(5, 7.8)
+    double res[2 * 2] = {
+        0.2, 0.2,
+        0.0, 0.12821
+    };
+    dyn2b_jnt_fct_abi3(2, s2, m_mat, d2, fct);
+    for (int i = 0; i < 2 * 2; i++) {
+        ck_assert_flt_eq(fct[i], res[i]);
+    }
+
+    // Solving for the identity reproduces the explicit inverse
+    double res_inv[2 * 2];
+    dyn2b_jnt_inv_abi3(2, s2, m_mat, d2, res_inv);
+    dyn2b_ldl_slv_mat(2, 2, fct, eye, 2, out, 2);
+    for (int i = 0; i < 2 * 2; i++) {
+        ck_assert_flt_eq(out[i], res_inv[i]);
+    }
+}
+END_TEST
+
+
 START_TEST(test_jnt_to_proj3)
 {
     double s2[DYN2B_SCREW3_SIZE * 2] = {
@@ -888,8 +1413,8 @@ START_TEST(test_jnt_to_proj3)
         0.0, 0.0, 1.0, 0.0, 0.0, 0.0
     };
     double d2[2 * 2] = {
-        3.0, 4.0,
-        4.0, 5.0
+         3.0, -2.0,
+        -2.0,  5.0
     };
     double out[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
 
@@ -911,9 +1436,9 @@ START_TEST(test_jnt_to_proj3)
     }
 
     double res2[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE] = {
-         1.0   , 0.0   , 0.0   ,  0.0   ,  0.0   ,  0.0   ,
-        -0.5556, 0.4444, 0.3333, -0.4444, -0.4444,  0.4444,
-         0.1111, 0.1111, 0.3333, -0.1111, -0.1111, -0.8889,
+         1.0   ,  0.0   ,  0.0   ,  0.0   ,  0.0   ,  0.0   ,
+        -0.3333,  0.6667, -0.5385, -0.5128, -0.5128, -0.7179,
+        -0.3333, -0.3333,  0.6923, -0.4359, -0.4359, -0.4103,
          0.0   , 0.0   , 0.0   ,  1.0   ,  0.0   ,  0.0   ,
          0.0   , 0.0   , 0.0   ,  0.0   ,  1.0   ,  0.0   ,
          0.0   , 0.0   , 0.0   ,  0.0   ,  0.0   ,  1.0
@@ -937,8 +1462,8 @@ START_TEST(test_jnt_proj_abi3)
         0.0, 0.0, 1.0, 0.0, 0.0, 0.0
     };
     double d2[2 * 2] = {
-        3.0, 4.0,
-        4.0, 5.0
+         3.0, -2.0,
+        -2.0,  5.0
     };
     double out[27];
 
@@ -963,17 +1488,17 @@ START_TEST(test_jnt_proj_abi3)
 
     double res2[27] = {
         // I
-        0.2222, 1.2222, 1.6667,
-        1.2222, 1.2222, 1.6667,
-        1.6667, 1.6667, 2.0,
+        -0.6667, 0.3333, 1.0,
+         0.3333, 0.3333, 1.0,
+         1.0   , 1.0   , 0.4615,
         // H
-        0.7778, 1.7778, 2.3333,
-        1.7778, 1.7778, 2.3333,
-        2.2222, 2.2222, 2.6667,
+        -0.3333, 0.6667, 1.1538,
+         0.6667, 0.6667, 1.1538,
+         1.3333, 1.3333, 0.6154,
         // M
-        2.2222, 3.2222, 3.7778,
-        3.2222, 3.2222, 3.7778,
-        3.7778, 3.7778, 4.2222
+        0.7179, 1.7179, 2.2051,
+        1.7179, 1.7179, 2.2051,
+        2.2051, 2.2051, 1.4872
     };
     dyn2b_jnt_proj_abi3(2, s2, d2, m, out);
     for (int i = 0; i < 27; i++) {
@@ -990,8 +1515,8 @@ START_TEST(test_jnt_proj_wrench3)
         0.0, 0.0, 1.0, 0.0, 0.0, 0.0
     };
     double d2[2 * 2] = {
-        3.0, 4.0,
-        4.0, 5.0
+         3.0, -2.0,
+        -2.0,  5.0
     };
     double out[DYN2B_SCREW3_SIZE * N];
 
@@ -1009,8 +1534,8 @@ START_TEST(test_jnt_proj_wrench3)
     }
 
     double res2[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE] = {
-        0.7778, 1.7778, 2.2222, 0.2222, 1.2222, 1.6667,
-        5.5556, 7.5556, 8.4444, 0.4444, 2.4444, 3.3333
+        -0.3333, 0.6667, 1.3333, -0.6667, 0.3333, 1.0,
+         3.3333, 5.3333, 6.6667, -1.3333, 0.6667, 2.0
     };
     dyn2b_jnt_proj_wrench3(N, 2, s2, d2, m, w, out);
     for (int i = 0; i < N; i++) {
@@ -1024,6 +1549,155 @@ START_TEST(test_jnt_proj_wrench3)
 END_TEST
 
 
+START_TEST(test_jnt_proj_wrench3_ws)
+{
+    double s2[DYN2B_SCREW3_SIZE * 2] = {
+        0.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0, 0.0
+    };
+    double d2[2 * 2] = {
+         3.0, -2.0,
+        -2.0,  5.0
+    };
+    double out[DYN2B_SCREW3_SIZE * N];
+    double res[DYN2B_SCREW3_SIZE * N];
+
+    // The workspace's initial content must not matter
+    const int size = dyn2b_workspace_size_jnt_proj_wrench3(N, 2);
+    ck_assert_int_eq(size, 2 * N);
+    double ws[size];
+    for (int i = 0; i < size; i++) {
+        ws[i] = NAN;
+    }
+
+    dyn2b_jnt_proj_wrench3(N, 2, s2, d2, m, w, res);
+    dyn2b_jnt_proj_wrench3_ws(N, 2, s2, d2, m, w, out, ws);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE * N; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_jnt_to_jpc3)
+{
+    double s2[DYN2B_SCREW3_SIZE * 2] = {
+        0.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0, 0.0
+    };
+    double d2[2 * 2] = {
+         3.0, -2.0,
+        -2.0,  5.0
+    };
+    double jpc[DYN2B_JPC3_SIZE(2)];
+    ck_assert_int_eq(DYN2B_JPC3_SIZE(2), 2 * 6 + 2 * 6 + 2 * 2);
+
+    dyn2b_jnt_to_jpc3(2, s2, d2, m, jpc);
+
+    // U = I^A S
+    double u[DYN2B_WRENCH3_SIZE * 2];
+    dyn2b_abi_to_wrench3(2, m, s2, u);
+    for (int i = 0; i < DYN2B_JPC3_U_SIZE(2); i++) {
+        ck_assert_flt_eq(jpc[DYN2B_JPC3_U_OFFSET(2) + i], u[i]);
+    }
+
+    // Factorization of D
+    double m_mat[DYN2B_SCREW3_SIZE * DYN2B_SCREW3_SIZE];
+    double fct[2 * 2];
+    dyn2b_to_mat_abi3(m, m_mat);
+    dyn2b_jnt_fct_abi3(2, s2, m_mat, d2, fct);
+    for (int i = 0; i < DYN2B_JPC3_FCT_SIZE(2); i++) {
+        ck_assert_flt_eq(jpc[DYN2B_JPC3_FCT_OFFSET(2) + i], fct[i]);
+    }
+
+    // K = U D^{-1}
+    double dinv[2 * 2];
+    dyn2b_jnt_inv_abi3(2, s2, m_mat, d2, dinv);
+    for (int c = 0; c < 2; c++) {
+        for (int r = 0; r < DYN2B_WRENCH3_SIZE; r++) {
+            double k = 0.0;
+            for (int l = 0; l < 2; l++) {
+                k += u[(DYN2B_WRENCH3_SIZE * l) + r] * dinv[(2 * c) + l];
+            }
+            ck_assert_flt_eq(
+                    jpc[DYN2B_JPC3_K_OFFSET(2) + (DYN2B_JPC3_K_LD * c) + r],
+                    k);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_jnt_proj_jpc3)
+{
+    double s2[DYN2B_SCREW3_SIZE * 2] = {
+        0.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0, 0.0
+    };
+    double d2[2 * 2] = {
+         3.0, -2.0,
+        -2.0,  5.0
+    };
+    double jpc[DYN2B_JPC3_SIZE(2)];
+    double ws[2 * N];
+    double m_out[27];
+    double f_out[DYN2B_WRENCH3_SIZE * N];
+
+    // One context serves both projections
+    dyn2b_jnt_to_jpc3(2, s2, d2, m, jpc);
+
+    double m_res[27];
+    dyn2b_jnt_proj_abi3(2, s2, d2, m, m_res);
+    dyn2b_jnt_proj_abi3_jpc(2, jpc, m, m_out);
+    for (int i = 0; i < 27; i++) {
+        ck_assert_flt_eq(m_out[i], m_res[i]);
+    }
+
+    double f_res[DYN2B_WRENCH3_SIZE * N];
+    dyn2b_jnt_proj_wrench3(N, 2, s2, d2, m, w, f_res);
+    dyn2b_jnt_proj_wrench3_jpc(N, 2, s2, jpc, w, f_out, ws);
+    for (int i = 0; i < DYN2B_WRENCH3_SIZE * N; i++) {
+        ck_assert_flt_eq(f_out[i], f_res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_jnt_acc3_jpc)
+{
+    double s2[DYN2B_SCREW3_SIZE * 2] = {
+        0.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0, 0.0
+    };
+    double d2[2 * 2] = {
+         3.0, -2.0,
+        -2.0,  5.0
+    };
+    double tau[2] = { 1.0, -2.0 };
+    double xdd[DYN2B_TWIST3_SIZE] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+    double jpc[DYN2B_JPC3_SIZE(2)];
+    double qdd[2];
+
+    dyn2b_jnt_to_jpc3(2, s2, d2, m, jpc);
+    dyn2b_jnt_acc3_jpc(2, jpc, tau, xdd, qdd);
+
+    // D qdd = tau - U^T xdd with D = d + S^T U
+    const double *u = &jpc[DYN2B_JPC3_U_OFFSET(2)];
+    double stu[2 * 2];
+    double utx[2];
+    dyn2b_dot_screw3(2, 2, u, s2, stu);
+    dyn2b_dot_screw3(2, 1, u, xdd, utx);
+    for (int i = 0; i < 2; i++) {
+        double lhs = 0.0;
+        for (int j = 0; j < 2; j++) {
+            lhs += (d2[(2 * j) + i] + stu[(2 * j) + i]) * qdd[j];
+        }
+        ck_assert_flt_eq(lhs, tau[i] - utx[i]);
+    }
+}
+END_TEST
+
+
 TCase *joint_test()
 {
     TCase *tc = tcase_create("Joint");
@@ -1034,6 +1708,7 @@ TCase *joint_test()
     tcase_add_test(tc, test_trans_x_to_pose3);
     tcase_add_test(tc, test_trans_y_to_pose3);
     tcase_add_test(tc, test_trans_z_to_pose3);
+    tcase_add_test(tc, test_cmp_pose3);
     tcase_add_test(tc, test_rev_x_to_twist3);
     tcase_add_test(tc, test_rev_y_to_twist3);
     tcase_add_test(tc, test_rev_z_to_twist3);
@@ -1048,6 +1723,7 @@ TCase *joint_test()
     tcase_add_test(tc, test_trans_z_from_wrench3);
     tcase_add_test(tc, test_to_abi3);
     tcase_add_test(tc, test_tf_prox_abi3);
+    tcase_add_test(tc, test_tf_prox_abi3_batch);
     tcase_add_test(tc, test_abi_to_wrench3);
     tcase_add_test(tc, test_rev_x_proj_abi3);
     tcase_add_test(tc, test_rev_y_proj_abi3);
@@ -1063,10 +1739,25 @@ TCase *joint_test()
     tcase_add_test(tc, test_trans_z_proj_wrench3);
     tcase_add_test(tc, test_to_mat_abi3);
     tcase_add_test(tc, test_to_tup_abi3);
+    tcase_add_test(tc, test_pck_abi3);
+    tcase_add_test(tc, test_to_abi3p);
+    tcase_add_test(tc, test_tf_prox_abi3p);
+    tcase_add_test(tc, test_abi_to_wrench3p);
+    tcase_add_test(tc, test_proj_abi3p);
+    tcase_add_test(tc, test_proj_wrench3p);
+    tcase_add_test(tc, test_to_axis3);
+    tcase_add_test(tc, test_axis_principal);
+    tcase_add_test(tc, test_axis_tilted);
+    tcase_add_test(tc, test_axis_dual);
     tcase_add_test(tc, test_jnt_inv_abi3);
+    tcase_add_test(tc, test_jnt_fct_abi3);
     tcase_add_test(tc, test_jnt_to_proj3);
     tcase_add_test(tc, test_jnt_proj_abi3);
     tcase_add_test(tc, test_jnt_proj_wrench3);
+    tcase_add_test(tc, test_jnt_proj_wrench3_ws);
+    tcase_add_test(tc, test_jnt_to_jpc3);
+    tcase_add_test(tc, test_jnt_proj_jpc3);
+    tcase_add_test(tc, test_jnt_acc3_jpc);
 
     return tc;
 }
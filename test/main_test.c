@@ -6,6 +6,10 @@ extern TCase *matrix_test();
 extern TCase *screw_test();
 extern TCase *mechanics_test();
 extern TCase *joint_test();
+extern TCase *inline_test();
+#ifdef DYN2B_TEST_FLOAT
+extern TCase *float_test();
+#endif
 
 
 int main(int argc, char **argv)
@@ -16,6 +20,10 @@ int main(int argc, char **argv)
     suite_add_tcase(s, screw_test());
     suite_add_tcase(s, mechanics_test());
     suite_add_tcase(s, joint_test());
+    suite_add_tcase(s, inline_test());
+#ifdef DYN2B_TEST_FLOAT
+    suite_add_tcase(s, float_test());
+#endif
 
     SRunner *sr = srunner_create(s);
 
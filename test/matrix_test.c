@@ -70,12 +70,134 @@ START_TEST(test_mad_mat)
 END_TEST
 
 
+START_TEST(test_ldl_fct_mat)
+{
+    // Embedded in a larger matrix to test the leading dimension
+    double a[4 * 3] = {
+        4.0,  2.0, -2.0, 9.0,
+        2.0, 10.0,  5.0, 9.0,
+       -2.0,  5.0, 11.0, 9.0
+    };
+    double fct[3 * 3];
+
+    // L = [1 0 0; 0.5 1 0; -0.5 0.6667 1], D = diag(4, 9, 6)
+    double res[3 * 3] = {
+        0.25, 0.5, -0.5,
+        0.0, 0.11111, 0.66667,
+        0.0, 0.0, 0.16667
+    };
+    dyn2b_ldl_fct_mat(3, a, 4, fct);
+    for (int i = 0; i < 3 * 3; i++) {
+        ck_assert_flt_eq(fct[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_ldl_slv_mat)
+{
+    // Symmetric, positive-definite matrices of all specialized sizes
+    for (int n = 1; n <= 7; n++) {
+        double a[7 * 7];
+        double fct[7 * 7];
+        double b[7 * 2];
+        double x[7 * 2];
+
+        for (int c = 0; c < n; c++) {
+            for (int r = 0; r < n; r++) {
+                a[(n * c) + r] = (r == c) ? n + 1.0 : 1.0 / (1.0 + r + c);
+            }
+            b[c] = c + 1.0;
+            b[n + c] = 1.0 - c;
+        }
+
+        dyn2b_ldl_fct_mat(n, a, n, fct);
+        dyn2b_ldl_slv_mat(n, 2, fct, b, n, x, n);
+
+        // A x = b
+        for (int k = 0; k < 2; k++) {
+            for (int r = 0; r < n; r++) {
+                double ax = 0.0;
+                for (int c = 0; c < n; c++) {
+                    ax += a[(n * c) + r] * x[(n * k) + c];
+                }
+                ck_assert_flt_eq(ax, b[(n * k) + r]);
+            }
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_ltdl_mat)
+{
+    // A forest with the branches {1, 3, 4} and {2, 5} and a second root 6
+#define N 8
+    const int parent[N] = { -1, 0, 0, 1, 1, 2, -1, 6 };
+
+    // A = L^T D L with L in the sparsity pattern of the tree
+    double l[N * N] = { 0.0 };
+    double d[N];
+    for (int i = 0; i < N; i++) {
+        l[(N * i) + i] = 1.0;
+        for (int j = parent[i]; j >= 0; j = parent[j]) {
+            l[(N * j) + i] = 0.1 * (i + 1) - 0.05 * j;
+        }
+        d[i] = 1.0 + 0.5 * i;
+    }
+
+    double a[N * N];
+    for (int c = 0; c < N; c++) {
+        for (int r = 0; r < N; r++) {
+            a[(N * c) + r] = 0.0;
+            for (int k = 0; k < N; k++) {
+                a[(N * c) + r] += l[(N * r) + k] * d[k] * l[(N * c) + k];
+            }
+        }
+    }
+
+    double fct[N * N];
+    dyn2b_ltdl_fct_mat(N, parent, a, N, fct);
+    for (int c = 0; c < N; c++) {
+        for (int r = 0; r < N; r++) {
+            double res = (r == c) ? 1.0 / d[r]
+                       : (r < c) ? l[(N * r) + c]
+                       : 0.0;
+            ck_assert_flt_eq(fct[(N * c) + r], res);
+        }
+    }
+
+    // A x = b
+    double b[N * 2];
+    double x[N * 2];
+    for (int i = 0; i < N; i++) {
+        b[i] = i + 1.0;
+        b[N + i] = 1.0 - i;
+    }
+    dyn2b_ltdl_slv_mat(N, 2, parent, fct, b, N, x, N);
+    for (int k = 0; k < 2; k++) {
+        for (int r = 0; r < N; r++) {
+            double ax = 0.0;
+            for (int c = 0; c < N; c++) {
+                ax += a[(N * c) + r] * x[(N * k) + c];
+            }
+            ck_assert_flt_eq(ax, b[(N * k) + r]);
+        }
+    }
+#undef N
+}
+END_TEST
+
+
 TCase *matrix_test()
 {
     TCase *tc = tcase_create("Matrix");
 
     tcase_add_test(tc, test_cpy_mat);
     tcase_add_test(tc, test_mad_mat);
+    tcase_add_test(tc, test_ldl_fct_mat);
+    tcase_add_test(tc, test_ldl_slv_mat);
+    tcase_add_test(tc, test_ltdl_mat);
 
     return tc;
 }
\ No newline at end of file
@@ -1,7 +1,11 @@
 // SPDX-License-Identifier: LGPL-3.0
 #include <dyn2b/functions/mechanics.h>
+#include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/joint.h>
 #include <dyn2b/types/mechanics.h>
 #include <dyn2b/types/screw.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/types/dual.h>
 #include <math.h>
 #include <check.h>
 
@@ -39,6 +43,43 @@ START_TEST(test_tf_dist_acc3)
 END_TEST
 
 
+START_TEST(test_tf_dist_acc3_composite)
+{
+    // Rotation about the axis (1, 1, 1) / sqrt(3) by 1 rad
+    const double c = cos(1.0);
+    const double s = sin(1.0);
+    const double t = (1.0 - c) / 3.0;
+    const double u = s / sqrt(3.0);
+    double tf[DYN2B_POSE3_SIZE] = {
+        c + t, t + u, t - u,
+        t - u, c + t, t + u,
+        t + u, t - u, c + t,
+        0.5, -1.5, 2.5
+    };
+    double v_abs[DYN2B_SCREW3_SIZE] = {
+        0.3, -1.2, 0.7, 2.1, -0.4, 1.1
+    };
+    double v_rel[DYN2B_SCREW3_SIZE] = {
+        -0.8, 0.5, 1.9, 0.6, 1.4, -2.2
+    };
+    double in[DYN2B_SCREW3_SIZE] = {
+        1.3, 0.2, -0.9, -1.7, 0.8, 2.4
+    };
+    double out[DYN2B_SCREW3_SIZE];
+
+    double tmp[DYN2B_SCREW3_SIZE];
+    double res[DYN2B_SCREW3_SIZE];
+    dyn2b_tf_dist_screw3(1, tf, in, tmp);
+    dyn2b_cad_screw3(tmp, v_abs, v_rel, res);
+
+    dyn2b_tf_dist_acc3(tf, v_abs, v_rel, in, out);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
 START_TEST(test_rbi_to_wrench3)
 {
     double m[DYN2B_RBI3_SIZE] = {
@@ -97,13 +138,312 @@ START_TEST(test_to_nrt_wrench3)
 END_TEST
 
 
+START_TEST(test_nrt_wrench3_dxd)
+{
+    double m[DYN2B_RBI3_SIZE] = {
+        3.0, 4.0, 5.0,
+        4.0, 6.0, 7.0,
+        5.0, 7.0, 8.0,
+        4.0, 6.0, 8.0,
+        2.0
+    };
+    double v[DYN2B_TWIST3_SIZE] = {
+        1.0, 2.0, 3.0, 3.0, 4.0, 5.0
+    };
+    double dv[DYN2B_TWIST3_SIZE * 2] = {
+        0.5, -1.0, 0.0, 2.0, 0.0, 1.0,
+        0.0, 0.0, 1.0, -1.0, 3.0, 0.5
+    };
+    double out[DYN2B_WRENCH3_SIZE * 2];
+
+    dyn2b_nrt_wrench3_dxd(2, m, v, dv, out);
+
+    // The bias force is quadratic in the velocity so that central differences
+    // are exact
+    for (int k = 0; k < 2; k++) {
+        double v_p[DYN2B_TWIST3_SIZE];
+        double v_m[DYN2B_TWIST3_SIZE];
+        double w_p[DYN2B_WRENCH3_SIZE];
+        double w_m[DYN2B_WRENCH3_SIZE];
+        for (int i = 0; i < DYN2B_TWIST3_SIZE; i++) {
+            v_p[i] = v[i] + dv[(DYN2B_TWIST3_SIZE * k) + i];
+            v_m[i] = v[i] - dv[(DYN2B_TWIST3_SIZE * k) + i];
+        }
+        dyn2b_nrt_wrench3(m, v_p, w_p);
+        dyn2b_nrt_wrench3(m, v_m, w_m);
+        for (int i = 0; i < DYN2B_WRENCH3_SIZE; i++) {
+            ck_assert_flt_eq(out[(DYN2B_WRENCH3_SIZE * k) + i],
+                    0.5 * (w_p[i] - w_m[i]));
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_eom_wrench3)
+{
+    double m[DYN2B_RBI3_SIZE] = {
+        // I
+        3.0, 4.0, 5.0,
+        4.0, 6.0, 7.0,
+        5.0, 7.0, 8.0,
+        // h
+        4.0, 6.0, 8.0,
+        // m
+        2.0
+    };
+    double v[DYN2B_SCREW3_SIZE] = {
+        1.0, 2.0, 3.0, 3.0, 4.0, 5.0
+    };
+    double a[DYN2B_SCREW3_SIZE] = {
+        2.0, 1.0, 0.0, 1.0, 0.0, 2.0
+    };
+    double out[DYN2B_SCREW3_SIZE];
+
+    // rbi_to_wrench3 + nrt_wrench3
+    double res[DYN2B_SCREW3_SIZE] = {
+        -10.0, -12.0, 16.0, -47.0, 41.0, 24.0
+    };
+    dyn2b_eom_wrench3(m, v, a, out);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_eom_wrench3_dual)
+{
+    const int mt = DYN2B_TWIST3_SIZE;
+    const double eps = 1e-5;
+    double m[DYN2B_RBI3_SIZE] = {
+        3.0, 4.0, 5.0,
+        4.0, 6.0, 7.0,
+        5.0, 7.0, 8.0,
+        4.0, 6.0, 8.0,
+        2.0
+    };
+    double x[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)] = {
+        0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0
+    };
+    double v[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)] = {
+        1.0, 2.0, 3.0, 3.0, 4.0, 5.0
+    };
+    double v_rel[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)] = {
+        0.0, 1.0, 0.0, 0.5, 0.0, 0.0
+    };
+    double a[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)] = {
+        2.0, 1.0, 0.0, 1.0, 0.0, 2.0
+    };
+    dual_seed(DYN2B_POSE3_SIZE, x);
+    dual_seed(mt, v);
+    dual_seed(mt, v_rel);
+    dual_seed(mt, a);
+    for (int i = 0; i < DYN2B_DUAL_TAN_SIZE(mt); i++) {
+        v_rel[DYN2B_DUAL_TAN_OFFSET(mt) + i] *= 0.5;
+        a[DYN2B_DUAL_TAN_OFFSET(mt) + i] *= -2.0;
+    }
+
+    double acc[DYN2B_DUAL_SIZE(DYN2B_TWIST3_SIZE)];
+    double eom[DYN2B_DUAL_SIZE(DYN2B_WRENCH3_SIZE)];
+    dyn2b_tf_dist_acc3_dual(x, v, v_rel, a, acc);
+    dyn2b_eom_wrench3_dual(m, v, a, eom);
+
+    // The values equal those of the plain operators
+    double res_acc[DYN2B_TWIST3_SIZE];
+    double res_eom[DYN2B_WRENCH3_SIZE];
+    dyn2b_tf_dist_acc3(x, v, v_rel, a, res_acc);
+    dyn2b_eom_wrench3(m, v, a, res_eom);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE; i++) {
+        ck_assert_flt_eq(acc[i], res_acc[i]);
+        ck_assert_flt_eq(eom[i], res_eom[i]);
+    }
+
+    // The tangents equal the directional derivatives
+    for (int k = 0; k < DYN2B_DUAL_K; k++) {
+        double x_p[DYN2B_POSE3_SIZE], x_m[DYN2B_POSE3_SIZE];
+        double v_p[DYN2B_TWIST3_SIZE], v_m[DYN2B_TWIST3_SIZE];
+        double r_p[DYN2B_TWIST3_SIZE], r_m[DYN2B_TWIST3_SIZE];
+        double a_p[DYN2B_TWIST3_SIZE], a_m[DYN2B_TWIST3_SIZE];
+        double out_p[DYN2B_SCREW3_SIZE], out_m[DYN2B_SCREW3_SIZE];
+        dual_at(DYN2B_POSE3_SIZE, x, k, eps, x_p);
+        dual_at(DYN2B_POSE3_SIZE, x, k, -eps, x_m);
+        dual_at(mt, v, k, eps, v_p);
+        dual_at(mt, v, k, -eps, v_m);
+        dual_at(mt, v_rel, k, eps, r_p);
+        dual_at(mt, v_rel, k, -eps, r_m);
+        dual_at(mt, a, k, eps, a_p);
+        dual_at(mt, a, k, -eps, a_m);
+
+        dyn2b_tf_dist_acc3(x_p, v_p, r_p, a_p, out_p);
+        dyn2b_tf_dist_acc3(x_m, v_m, r_m, a_m, out_m);
+        for (int i = 0; i < DYN2B_TWIST3_SIZE; i++) {
+            ck_assert_flt_eq(
+                    acc[DYN2B_DUAL_TAN_OFFSET(mt) + (i * DYN2B_DUAL_TAN_LD) + k],
+                    (out_p[i] - out_m[i]) / (2.0 * eps));
+        }
+
+        dyn2b_eom_wrench3(m, v_p, a_p, out_p);
+        dyn2b_eom_wrench3(m, v_m, a_m, out_m);
+        for (int i = 0; i < DYN2B_WRENCH3_SIZE; i++) {
+            ck_assert_flt_eq(
+                    eom[DYN2B_DUAL_TAN_OFFSET(mt) + (i * DYN2B_DUAL_TAN_LD) + k],
+                    (out_p[i] - out_m[i]) / (2.0 * eps));
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_tf_prox_rbi3)
+{
+    double tf[DYN2B_POSE3_SIZE] = {
+        0.0, 0.0, 1.0,
+        1.0, 0.0, 0.0,
+        0.0, 1.0, 0.0,
+        1.0, 2.0, 3.0
+    };
+    double m[DYN2B_RBI3_SIZE] = {
+        // I
+        3.0, 0.5, 0.2,
+        0.5, 4.0, 0.1,
+        0.2, 0.1, 5.0,
+        // h
+        0.4, 0.6, 0.8,
+        // m
+        2.0
+    };
+    double out[DYN2B_RBI3_SIZE];
+    double abi[DYN2B_ABI3_SIZE];
+    double abi_out[DYN2B_ABI3_SIZE];
+    double res[DYN2B_ABI3_SIZE];
+
+    // The mass is invariant and the first moment follows the center of mass
+    double res_h[DYN2B_RBI3_H_SIZE] = {
+        0.6 + 2.0 * 1.0, 0.8 + 2.0 * 2.0, 0.4 + 2.0 * 3.0
+    };
+
+    dyn2b_tf_prox_rbi3(tf, m, out);
+    ck_assert_flt_eq(out[DYN2B_RBI3_M_OFFSET], 2.0);
+    for (int i = 0; i < DYN2B_RBI3_H_SIZE; i++) {
+        ck_assert_flt_eq(out[DYN2B_RBI3_H_OFFSET + i], res_h[i]);
+    }
+
+    // Same as transforming the equivalent articulated-body inertia
+    dyn2b_to_abi3(m, abi);
+    dyn2b_tf_prox_abi3(tf, abi, res);
+    dyn2b_to_abi3(out, abi_out);
+    for (int i = 0; i < DYN2B_ABI3_SIZE; i++) {
+        ck_assert_flt_eq(abi_out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_pck_rbi3)
+{
+    double m[DYN2B_RBI3_SIZE] = {
+        // I
+        3.0, 4.0, 5.0,
+        4.0, 6.0, 7.0,
+        5.0, 7.0, 8.0,
+        // h
+        4.0, 6.0, 8.0,
+        // m
+        2.0
+    };
+    double packed[DYN2B_RBI3P_SIZE];
+    double out[DYN2B_RBI3_SIZE];
+
+    double res[DYN2B_RBI3P_SIZE] = {
+        // I
+        3.0, 4.0, 6.0, 5.0, 7.0, 8.0,
+        // h
+        4.0, 6.0, 8.0,
+        // m
+        2.0
+    };
+
+    dyn2b_pck_rbi3(m, packed);
+    for (int i = 0; i < DYN2B_RBI3P_SIZE; i++) {
+        ck_assert_flt_eq(packed[i], res[i]);
+    }
+
+    dyn2b_unp_rbi3(packed, out);
+    for (int i = 0; i < DYN2B_RBI3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], m[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_rbi_to_wrench3p)
+{
+    double m[DYN2B_RBI3P_SIZE] = {
+        // I
+        3.0, 4.0, 6.0, 5.0, 7.0, 8.0,
+        // h
+        4.0, 6.0, 8.0,
+        // m
+        2.0
+    };
+    double in[DYN2B_SCREW3_SIZE] = {
+        1.0, 2.0, 3.0, 3.0, 4.0, 5.0
+    };
+    double out[DYN2B_SCREW3_SIZE];
+
+    double res[DYN2B_SCREW3_SIZE] = {
+        4.0, 12.0, 8.0, 24.0, 41.0, 41.0
+    };
+    dyn2b_rbi_to_wrench3p(m, in, out);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_to_nrt_wrench3p)
+{
+    double m[DYN2B_RBI3P_SIZE] = {
+        // I
+        3.0, 4.0, 6.0, 5.0, 7.0, 8.0,
+        // h
+        4.0, 6.0, 8.0,
+        // m
+        2.0
+    };
+    double v[DYN2B_SCREW3_SIZE] = {
+        1.0, 2.0, 3.0, 3.0, 4.0, 5.0
+    };
+    double out[DYN2B_SCREW3_SIZE];
+
+    double res[DYN2B_SCREW3_SIZE] = {
+        -20.0, 4.0, 4.0, -69.0, 27.0, 13.0
+    };
+    dyn2b_nrt_wrench3p(m, v, out);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
 TCase *mechanics_test()
 {
     TCase *tc = tcase_create("Mechanics");
 
     tcase_add_test(tc, test_tf_dist_acc3);
+    tcase_add_test(tc, test_tf_dist_acc3_composite);
     tcase_add_test(tc, test_rbi_to_wrench3);
     tcase_add_test(tc, test_to_nrt_wrench3);
+    tcase_add_test(tc, test_nrt_wrench3_dxd);
+    tcase_add_test(tc, test_eom_wrench3);
+    tcase_add_test(tc, test_eom_wrench3_dual);
+    tcase_add_test(tc, test_tf_prox_rbi3);
+    tcase_add_test(tc, test_pck_rbi3);
+    tcase_add_test(tc, test_rbi_to_wrench3p);
+    tcase_add_test(tc, test_to_nrt_wrench3p);
 
     return tc;
 }
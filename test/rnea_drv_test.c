@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/rnea_drv.h>
+#include <dyn2b/solvers/rnea.h>
+#include <dyn2b/solvers/crba.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+#include <string.h>
+
+#include "common.h"
+#include "tree_model.h"
+
+
+START_TEST(test_rnea_drv_fd)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    const double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    double f_ext[DYN2B_WRENCH3_SIZE * NB];
+    for (int i = 0; i < DYN2B_WRENCH3_SIZE * NB; i++) {
+        f_ext[i] = 0.1 * (i % 7) - 0.3;
+    }
+
+    double tau[NB];
+    double dtau_dq[NB * NB];
+    double dtau_dqd[NB * NB];
+    double dtau_dqdd[NB * NB];
+    double ws[dyn2b_workspace_size_rnea_drv(NB)];
+    dyn2b_rnea_drv(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, qdd, f_ext, tau, dtau_dq, dtau_dqd, dtau_dqdd, ws);
+
+    double tau_rnea[NB];
+    double ws_rnea[dyn2b_workspace_size_rnea(NB)];
+    dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, qdd, f_ext, tau_rnea, ws_rnea);
+    for (int i = 0; i < NB; i++) {
+        ck_assert_flt_eq(tau[i], tau_rnea[i]);
+    }
+
+    // Central differences of the RNEA with respect to each joint's position,
+    // velocity and acceleration
+    const double eps = 1e-6;
+    const double *arg[3] = { q, qd, qdd };
+    const double *res[3] = { dtau_dq, dtau_dqd, dtau_dqdd };
+    for (int a = 0; a < 3; a++) {
+        for (int j = 0; j < NB; j++) {
+            double in[3][NB];
+            double tau_p[NB];
+            double tau_m[NB];
+            memcpy(in[0], q, sizeof(in[0]));
+            memcpy(in[1], qd, sizeof(in[1]));
+            memcpy(in[2], qdd, sizeof(in[2]));
+
+            in[a][j] = arg[a][j] + eps;
+            dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+                    in[0], in[1], in[2], f_ext, tau_p, ws_rnea);
+            in[a][j] = arg[a][j] - eps;
+            dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+                    in[0], in[1], in[2], f_ext, tau_m, ws_rnea);
+
+            for (int i = 0; i < NB; i++) {
+                ck_assert_flt_eq(res[a][(NB * j) + i],
+                        (tau_p[i] - tau_m[i]) / (2.0 * eps));
+            }
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_rnea_drv_crba)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    const double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    const double d[NB] = { 0.0 };
+
+    double tau[NB];
+    double dtau_dq[NB * NB];
+    double dtau_dqd[NB * NB];
+    double dtau_dqdd[NB * NB];
+    double ws[dyn2b_workspace_size_rnea_drv(NB)];
+    dyn2b_rnea_drv(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, qdd, NULL, tau, dtau_dq, dtau_dqd, dtau_dqdd, ws);
+
+    // The derivative with respect to the accelerations is the joint-space
+    // inertia matrix
+    double h[NB * NB];
+    double ws_crba[dyn2b_workspace_size_crba(NB)];
+    dyn2b_crba(NB, parent, jnt, axis, x_tree, rbi, d, q, h, ws_crba);
+    for (int i = 0; i < NB * NB; i++) {
+        ck_assert_flt_eq(dtau_dqdd[i], h[i]);
+    }
+
+    // Joints on different branches do not affect each other
+    ck_assert_flt_eq(dtau_dq[(NB * 2) + 3], 0.0);
+    ck_assert_flt_eq(dtau_dqd[(NB * 3) + 2], 0.0);
+}
+END_TEST
+
+
+TCase *rnea_drv_test()
+{
+    TCase *tc = tcase_create("RNEA derivatives");
+
+    tcase_add_test(tc, test_rnea_drv_fd);
+    tcase_add_test(tc, test_rnea_drv_crba);
+
+    return tc;
+}
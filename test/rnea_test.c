@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <dyn2b/solvers/rnea.h>
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+#include <dyn2b/types/joint.h>
+#include <check.h>
+#include <math.h>
+
+#include "common.h"
+#include "tree_model.h"
+
+
+START_TEST(test_rnea_pendulum)
+{
+    // Point mass m at (l, 0, 0) of a link that rotates about the z-axis
+    const double m = 2.0;
+    const double l = 0.5;
+    const double g = 9.81;
+    const int par[1] = { -1 };
+    double x[DYN2B_POSE3_SIZE] = {
+        1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  0.0, 0.0, 1.0,  0.0, 0.0, 1.0
+    };
+    double inertia[DYN2B_RBI3_SIZE] = {
+        0.0, 0.0, 0.0,  0.0, m * l * l, 0.0,  0.0, 0.0, m * l * l,
+        m * l, 0.0, 0.0,
+        m
+    };
+    // Gravity along the base's negative y-axis
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, g, 0.0 };
+    double dir[3] = { 0.0, 0.0, 2.0 };
+    double axis[DYN2B_AXIS3_SIZE];
+    dyn2b_to_axis3(dir, axis);
+
+    const int types[2] = { DYN2B_JNT_REV_Z, DYN2B_JNT_REV };
+    double ws[dyn2b_workspace_size_rnea(1)];
+    ck_assert_int_eq(dyn2b_workspace_size_rnea(1), 30);
+
+    for (int t = 0; t < 2; t++) {
+        // Trees without arbitrary-axis joints need no axes
+        const double *axis_t = (types[t] == DYN2B_JNT_REV) ? axis : NULL;
+        double tau;
+
+        // Static: hold the mass against gravity
+        double q0 = 0.0, qd0 = 0.0, qdd0 = 0.0;
+        dyn2b_rnea(1, par, &types[t], axis_t, x, inertia, xdd_base,
+                &q0, &qd0, &qdd0, NULL, &tau, ws);
+        ck_assert_flt_eq(tau, m * g * l);
+
+        // Additionally accelerate the link
+        double qdd1 = 1.0;
+        dyn2b_rnea(1, par, &types[t], axis_t, x, inertia, xdd_base,
+                &q0, &qd0, &qdd1, NULL, &tau, ws);
+        ck_assert_flt_eq(tau, m * l * l + m * g * l);
+
+        // The centripetal force does not contribute
+        double qd1 = 3.0;
+        dyn2b_rnea(1, par, &types[t], axis_t, x, inertia, xdd_base,
+                &q0, &qd1, &qdd0, NULL, &tau, ws);
+        ck_assert_flt_eq(tau, m * g * l);
+
+        // Upright: gravity does not contribute
+        double q1 = M_PI / 2.0;
+        dyn2b_rnea(1, par, &types[t], axis_t, x, inertia, xdd_base,
+                &q1, &qd0, &qdd0, NULL, &tau, ws);
+        ck_assert_flt_eq(tau, 0.0);
+
+        // External torque about the joint axis
+        double f_ext[DYN2B_WRENCH3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 5.0 };
+        dyn2b_rnea(1, par, &types[t], axis_t, x, inertia, xdd_base,
+                &q1, &qd0, &qdd0, f_ext, &tau, ws);
+        ck_assert_flt_eq(tau, -5.0);
+    }
+}
+END_TEST
+
+
+START_TEST(test_rnea_mass_matrix)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    double zero[DYN2B_TWIST3_SIZE] = { 0.0 };
+    double ws[dyn2b_workspace_size_rnea(NB)];
+
+    // Columns of the joint-space inertia matrix: M e_j
+    double mass[NB * NB];
+    for (int j = 0; j < NB; j++) {
+        double e[NB] = { 0.0 };
+        e[j] = 1.0;
+        dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, zero,
+                q, zero, e, NULL, &mass[NB * j], ws);
+    }
+
+    for (int i = 0; i < NB; i++) {
+        ck_assert(mass[(NB * i) + i] > 0.0);
+        for (int j = 0; j < NB; j++) {
+            ck_assert_flt_eq(mass[(NB * i) + j], mass[(NB * j) + i]);
+        }
+    }
+
+    // Bodies on different branches do not couple
+    ck_assert_flt_eq(mass[(NB * 2) + 1], 0.0);
+    ck_assert_flt_eq(mass[(NB * 2) + 3], 0.0);
+
+    // The joint forces are affine in the joint accelerations:
+    // tau(qdd) = M qdd + tau(0)
+    double xdd_base[DYN2B_TWIST3_SIZE] = { 0.0, 0.0, 0.0, 0.0, 0.0, 9.81 };
+    double tau[NB];
+    double tau0[NB];
+    dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, qdd, NULL, tau, ws);
+    dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, xdd_base,
+            q, qd, zero, NULL, tau0, ws);
+    for (int i = 0; i < NB; i++) {
+        double res = tau0[i];
+        for (int j = 0; j < NB; j++) {
+            res += mass[(NB * j) + i] * qdd[j];
+        }
+        ck_assert_flt_eq(tau[i], res);
+    }
+}
+END_TEST
+
+
+START_TEST(test_rnea_power)
+{
+    double axis[DYN2B_AXIS3_SIZE * NB];
+    tree_axis(axis);
+
+    double zero[DYN2B_TWIST3_SIZE] = { 0.0 };
+    double ws[dyn2b_workspace_size_rnea(NB)];
+
+    // Without gravity and with qdd = 0, the power of the joint forces equals
+    // the rate of change of the kinetic energy T = 1/2 qd^T M(q) qd along the
+    // motion: qd^T C qd = 1/2 qd^T dM/dt qd = dT/dt
+    double tau0[NB];
+    dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, zero,
+            q, qd, zero, NULL, tau0, ws);
+
+    const double h = 1e-6;
+    double ke[2];
+    for (int s = 0; s < 2; s++) {
+        double q_h[NB];
+        for (int i = 0; i < NB; i++) {
+            q_h[i] = q[i] + ((s == 0) ? -h : h) * qd[i];
+        }
+
+        // T = 1/2 qd^T M(q) qd = 1/2 qd^T tau(q, 0, qd)
+        double mqd[NB];
+        dyn2b_rnea(NB, parent, jnt, axis, x_tree, rbi, zero,
+                q_h, zero, qd, NULL, mqd, ws);
+        ke[s] = 0.0;
+        for (int i = 0; i < NB; i++) {
+            ke[s] += 0.5 * qd[i] * mqd[i];
+        }
+    }
+
+    double power = 0.0;
+    for (int i = 0; i < NB; i++) {
+        power += qd[i] * tau0[i];
+    }
+    ck_assert_flt_eq(power, (ke[1] - ke[0]) / (2.0 * h));
+}
+END_TEST
+
+
+TCase *rnea_test()
+{
+    TCase *tc = tcase_create("RNEA");
+
+    tcase_add_test(tc, test_rnea_pendulum);
+    tcase_add_test(tc, test_rnea_mass_matrix);
+    tcase_add_test(tc, test_rnea_power);
+
+    return tc;
+}
@@ -1,9 +1,13 @@
 // SPDX-License-Identifier: LGPL-3.0
 #include <dyn2b/functions/screw.h>
+#include <dyn2b/functions/joint.h>
 #include <dyn2b/types/screw.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/types/dual.h>
 #include <math.h>
 #include <check.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "common.h"
 
@@ -238,6 +242,37 @@ START_TEST(test_tf_dist_screw3)
 END_TEST
 
 
+START_TEST(test_tf_dist_screw3_ws)
+{
+    double tf[DYN2B_POSE3_SIZE] = {
+        0.0, 0.0, 1.0,
+        1.0, 0.0, 0.0,
+        0.0, 1.0, 0.0,
+        1.0, 2.0, 3.0
+    };
+    double in[DYN2B_SCREW3_SIZE * N] = {
+        1.0, 2.0, 3.0, 2.0, 3.0, 4.0,
+        3.0, 1.0, 2.0, 4.0, 2.0, 3.0
+    };
+    double out[DYN2B_SCREW3_SIZE * N];
+    double res[DYN2B_SCREW3_SIZE * N];
+
+    // The workspace's initial content must not matter
+    ck_assert_int_eq(dyn2b_workspace_size_tf_dist_screw3(N), 3 * N);
+    double ws[3 * N];
+    for (int i = 0; i < 3 * N; i++) {
+        ws[i] = NAN;
+    }
+
+    dyn2b_tf_dist_screw3(N, tf, in, res);
+    dyn2b_tf_dist_screw3_ws(N, tf, in, out, ws);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE * N; i++) {
+        ck_assert_flt_eq(out[i], res[i]);
+    }
+}
+END_TEST
+
+
 START_TEST(test_rot_prox_screw3)
 {
     double tf1[DYN2B_POSE3_SIZE] = {
@@ -330,6 +365,402 @@ START_TEST(test_tf_prox_screw3)
 END_TEST
 
 
+START_TEST(test_cmp_pose3_batch)
+{
+    // Two instances in structure-of-arrays layout with a padded row
+    const int ld = N + 1;
+    double a[DYN2B_POSE3_SIZE * N] = {
+        0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0,
+        0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 4.0, 5.0, 6.0
+    };
+    double b[DYN2B_POSE3_SIZE * N] = {
+        cos(M_PI_4), 0.0, -sin(M_PI_4), 0.0, 1.0, 0.0,
+        sin(M_PI_4), 0.0,  cos(M_PI_4), 3.0, 2.0, 1.0,
+        0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0
+    };
+    double a_soa[DYN2B_POSE3_SIZE * (N + 1)];
+    double b_soa[DYN2B_POSE3_SIZE * (N + 1)];
+    double out_soa[DYN2B_POSE3_SIZE * (N + 1)];
+    double res[DYN2B_POSE3_SIZE];
+
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < DYN2B_POSE3_SIZE; j++) {
+            a_soa[(j * ld) + i] = a[(i * DYN2B_POSE3_SIZE) + j];
+            b_soa[(j * ld) + i] = b[(i * DYN2B_POSE3_SIZE) + j];
+        }
+    }
+
+    dyn2b_cmp_pose3_batch(N, ld, a_soa, b_soa, out_soa);
+    for (int i = 0; i < N; i++) {
+        dyn2b_cmp_pose3(&a[i * DYN2B_POSE3_SIZE], &b[i * DYN2B_POSE3_SIZE],
+                res);
+        for (int j = 0; j < DYN2B_POSE3_SIZE; j++) {
+            ck_assert_flt_eq(out_soa[(j * ld) + i], res[j]);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_tf_screw3_batch)
+{
+    const int ld = N + 1;
+    double tf[DYN2B_POSE3_SIZE * N] = {
+        1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 2.0, 3.0, 4.0,
+        0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0
+    };
+    double in[DYN2B_SCREW3_SIZE * N] = {
+        1.0, 2.0, 3.0, 2.0, 3.0, 4.0,
+        5.0, 6.0, 7.0, 7.0, 8.0, 9.0
+    };
+    double tf_soa[DYN2B_POSE3_SIZE * (N + 1)];
+    double in_soa[DYN2B_SCREW3_SIZE * (N + 1)];
+    double out_soa[DYN2B_SCREW3_SIZE * (N + 1)];
+    double res[DYN2B_SCREW3_SIZE];
+
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < DYN2B_POSE3_SIZE; j++) {
+            tf_soa[(j * ld) + i] = tf[(i * DYN2B_POSE3_SIZE) + j];
+        }
+        for (int j = 0; j < DYN2B_SCREW3_SIZE; j++) {
+            in_soa[(j * ld) + i] = in[(i * DYN2B_SCREW3_SIZE) + j];
+        }
+    }
+
+    dyn2b_tf_dist_screw3_batch(N, ld, tf_soa, in_soa, out_soa);
+    for (int i = 0; i < N; i++) {
+        dyn2b_tf_dist_screw3(1, &tf[i * DYN2B_POSE3_SIZE],
+                &in[i * DYN2B_SCREW3_SIZE], res);
+        for (int j = 0; j < DYN2B_SCREW3_SIZE; j++) {
+            ck_assert_flt_eq(out_soa[(j * ld) + i], res[j]);
+        }
+    }
+
+    dyn2b_tf_prox_screw3_batch(N, ld, tf_soa, in_soa, out_soa);
+    for (int i = 0; i < N; i++) {
+        dyn2b_tf_prox_screw3(1, &tf[i * DYN2B_POSE3_SIZE],
+                &in[i * DYN2B_SCREW3_SIZE], res);
+        for (int j = 0; j < DYN2B_SCREW3_SIZE; j++) {
+            ck_assert_flt_eq(out_soa[(j * ld) + i], res[j]);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST(test_pose3q)
+{
+    // Identity and half turns about x, y and z (one of each of the conversion's
+    // cases), a permutation and a general rotation
+    double x[6][DYN2B_POSE3_SIZE] = {
+        { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0, 2.0, 3.0 },
+        { 1.0, 0.0, 0.0, 0.0, -1.0, 0.0, 0.0, 0.0, -1.0, 3.0, 2.0, 1.0 },
+        { -1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, -1.0, 0.0, 1.0, 0.0 },
+        { -1.0, 0.0, 0.0, 0.0, -1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0 },
+        { 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0 },
+        {
+            cos(M_PI_4), 0.0, -sin(M_PI_4),
+                0.0    , 1.0,      0.0    ,
+            sin(M_PI_4), 0.0,  cos(M_PI_4),
+                3.0    , 2.0,      1.0
+        }
+    };
+    double s[DYN2B_SCREW3_SIZE * N] = {
+        1.0, 2.0, 3.0, 2.0, 3.0, 4.0,
+        5.0, 6.0, 7.0, 7.0, 8.0, 9.0
+    };
+    double xq[6][DYN2B_POSE3Q_SIZE];
+    double out[DYN2B_POSE3_SIZE];
+    double outq[DYN2B_POSE3Q_SIZE];
+    double res[DYN2B_SCREW3_SIZE * N];
+    double resq[DYN2B_SCREW3_SIZE * N];
+
+    for (int i = 0; i < 6; i++) {
+        dyn2b_to_pose3q(x[i], xq[i]);
+        ck_assert(xq[i][DYN2B_POSE3Q_ANG_W] >= 0.0);
+
+        dyn2b_to_mat_pose3q(xq[i], out);
+        for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+            ck_assert_flt_eq(out[k], x[i][k]);
+        }
+    }
+
+    // -2 pi / 3 about (1, 1, 1)
+    double res_q[DYN2B_POSE3Q_SIZE] = { -0.5, -0.5, -0.5, 0.5, 1.0, 2.0, 3.0 };
+    for (int k = 0; k < DYN2B_POSE3Q_SIZE; k++) {
+        ck_assert_flt_eq(xq[4][k], res_q[k]);
+    }
+
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            double x_comp[DYN2B_POSE3_SIZE];
+            dyn2b_cmp_pose3(x[i], x[j], x_comp);
+            dyn2b_cmp_pose3q(xq[i], xq[j], outq);
+            dyn2b_to_mat_pose3q(outq, out);
+            for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+                ck_assert_flt_eq(out[k], x_comp[k]);
+            }
+        }
+
+        dyn2b_tf_dist_screw3(N, x[i], s, res);
+        dyn2b_tf_dist_screw3q(N, xq[i], s, resq);
+        for (int k = 0; k < DYN2B_SCREW3_SIZE * N; k++) {
+            ck_assert_flt_eq(resq[k], res[k]);
+        }
+
+        dyn2b_tf_prox_screw3(N, x[i], s, res);
+        dyn2b_tf_prox_screw3q(N, xq[i], s, resq);
+        for (int k = 0; k < DYN2B_SCREW3_SIZE * N; k++) {
+            ck_assert_flt_eq(resq[k], res[k]);
+        }
+    }
+
+    // A quaternion whose norm has drifted still converts to a rotation
+    double xq_drift[DYN2B_POSE3Q_SIZE];
+    for (int k = 0; k < DYN2B_POSE3Q_SIZE; k++) {
+        xq_drift[k] = (k < DYN2B_POSE3Q_ANG_SIZE) ? 1.001 * xq[5][k] : xq[5][k];
+    }
+    dyn2b_to_mat_pose3q(xq_drift, out);
+    for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+        ck_assert_flt_eq(out[k], x[5][k]);
+    }
+}
+END_TEST
+
+
+// Renormalizing keeps a long chain of compositions on the unit sphere and
+// equal to the chain of matrix poses
+START_TEST(test_nrm_pose3q)
+{
+    const int steps = 10000;
+
+    // Small rotation about (1, 2, 2) / 3 followed by a small translation
+    const double th = 0.01;
+    const double step_q[DYN2B_POSE3Q_SIZE] = {
+        sin(th / 2.0) / 3.0, 2.0 * sin(th / 2.0) / 3.0,
+        2.0 * sin(th / 2.0) / 3.0, cos(th / 2.0),
+        0.001, -0.002, 0.003
+    };
+    double step[DYN2B_POSE3_SIZE];
+    double x[DYN2B_POSE3_SIZE] = {
+        1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0
+    };
+    double xq[DYN2B_POSE3Q_SIZE] = { 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0 };
+    double tmp[DYN2B_POSE3_SIZE];
+    double tmpq[DYN2B_POSE3Q_SIZE];
+    double out[DYN2B_POSE3_SIZE];
+
+    dyn2b_to_mat_pose3q(step_q, step);
+    for (int i = 0; i < steps; i++) {
+        dyn2b_cmp_pose3(x, step, tmp);
+        memcpy(x, tmp, DYN2B_POSE3_SIZE * sizeof(double));
+        dyn2b_cmp_pose3q(xq, step_q, tmpq);
+        dyn2b_nrm_pose3q(tmpq);
+        memcpy(xq, tmpq, DYN2B_POSE3Q_SIZE * sizeof(double));
+    }
+
+    double n2 = 0.0;
+    for (int k = 0; k < DYN2B_POSE3Q_ANG_SIZE; k++) {
+        n2 += xq[k] * xq[k];
+    }
+    ck_assert_double_eq_tol(n2, 1.0, 1e-14);
+
+    dyn2b_to_mat_pose3q(xq, out);
+    for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+        ck_assert_flt_eq(out[k], x[k]);
+    }
+
+    // A drifted quaternion returns to the same rotation with unit norm
+    for (int k = 0; k < DYN2B_POSE3Q_ANG_SIZE; k++) {
+        xq[k] *= 1.001;
+    }
+    dyn2b_nrm_pose3q(xq);
+    n2 = 0.0;
+    for (int k = 0; k < DYN2B_POSE3Q_ANG_SIZE; k++) {
+        n2 += xq[k] * xq[k];
+    }
+    ck_assert_double_eq_tol(n2, 1.0, 1e-14);
+    dyn2b_to_mat_pose3q(xq, out);
+    for (int k = 0; k < DYN2B_POSE3_SIZE; k++) {
+        ck_assert_flt_eq(out[k], x[k]);
+    }
+}
+END_TEST
+
+
+START_TEST(test_tf_screw3_dq)
+{
+    // Revolute joint about an arbitrary axis behind a constant pose
+    const double tf[DYN2B_POSE3_SIZE] = {
+        0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0
+    };
+    const double dir[3] = { 1.0, 2.0, 2.0 };
+    const double q = 0.4;
+    const double eps = 1e-6;
+    const double one = 1.0;
+    double in[DYN2B_SCREW3_SIZE * N] = {
+        1.0, 2.0, 3.0, 2.0, 3.0, 4.0,
+        -1.0, 0.5, 2.0, 0.0, 1.0, -3.0
+    };
+    double axis[DYN2B_AXIS3_SIZE];
+    double s_jnt[DYN2B_SCREW3_SIZE];
+    dyn2b_to_axis3(dir, axis);
+    dyn2b_rev_to_twist3(axis, &one, s_jnt);
+
+    // Central differences of the transformations
+    double dist[2][DYN2B_SCREW3_SIZE * N];
+    double prox[2][DYN2B_SCREW3_SIZE * N];
+    for (int k = 0; k < 2; k++) {
+        double q_k = (k == 0) ? q + eps : q - eps;
+        double x_jnt[DYN2B_POSE3_SIZE];
+        double x[DYN2B_POSE3_SIZE];
+        dyn2b_rev_to_pose3(axis, &q_k, x_jnt);
+        dyn2b_cmp_pose3(tf, x_jnt, x);
+        dyn2b_tf_dist_screw3(N, x, in, dist[k]);
+        dyn2b_tf_prox_screw3(N, x, in, prox[k]);
+    }
+
+    double x_jnt[DYN2B_POSE3_SIZE];
+    double x[DYN2B_POSE3_SIZE];
+    double s_dist[DYN2B_SCREW3_SIZE * N];
+    double out[DYN2B_SCREW3_SIZE * N];
+    dyn2b_rev_to_pose3(axis, &q, x_jnt);
+    dyn2b_cmp_pose3(tf, x_jnt, x);
+    dyn2b_tf_dist_screw3(N, x, in, s_dist);
+
+    dyn2b_tf_dist_screw3_dq(N, s_jnt, s_dist, out);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE * N; i++) {
+        ck_assert_flt_eq(out[i], (dist[0][i] - dist[1][i]) / (2.0 * eps));
+    }
+
+    dyn2b_tf_prox_screw3_dq(N, x, s_jnt, in, out);
+    for (int i = 0; i < DYN2B_SCREW3_SIZE * N; i++) {
+        ck_assert_flt_eq(out[i], (prox[0][i] - prox[1][i]) / (2.0 * eps));
+    }
+}
+END_TEST
+
+
+START_TEST(test_screw3_dual)
+{
+    // Compare against central differences along each tangent direction
+    const int ms = DYN2B_SCREW3_SIZE * N;
+    const double eps = 1e-5;
+    double x1[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)] = {
+        0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 2.0, 3.0
+    };
+    double x2[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)] = {
+        cos(0.3), sin(0.3), 0.0, -sin(0.3), cos(0.3), 0.0, 0.0, 0.0, 1.0,
+        0.5, -1.0, 2.0
+    };
+    double s[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE * N)] = {
+        1.0, 2.0, 3.0, 2.0, 3.0, 4.0,
+        -1.0, 0.5, 2.0, 0.0, 1.0, -3.0
+    };
+    dual_seed(DYN2B_POSE3_SIZE, x1);
+    dual_seed(DYN2B_POSE3_SIZE, x2);
+    double c1[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE)] = {
+        1.0, 2.0, 3.0, 2.0, 3.0, 4.0
+    };
+    double c2[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE)] = {
+        -1.0, 0.5, 2.0, 0.0, 1.0, -3.0
+    };
+    dual_seed(ms, s);
+    dual_seed(DYN2B_SCREW3_SIZE, c1);
+    dual_seed(DYN2B_SCREW3_SIZE, c2);
+    for (int i = 0; i < DYN2B_DUAL_TAN_SIZE(DYN2B_POSE3_SIZE); i++) {
+        x2[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE) + i] *= -0.5;
+    }
+    for (int i = 0; i < DYN2B_DUAL_TAN_SIZE(DYN2B_SCREW3_SIZE); i++) {
+        c2[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE) + i] *= 2.0;
+    }
+
+    double x[DYN2B_DUAL_SIZE(DYN2B_POSE3_SIZE)];
+    double dist[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE * N)];
+    double prox[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE * N)];
+    double crs[DYN2B_DUAL_SIZE(DYN2B_SCREW3_SIZE)];
+    dyn2b_cmp_pose3_dual(x1, x2, x);
+    dyn2b_tf_dist_screw3_dual(N, x1, s, dist);
+    dyn2b_tf_prox_screw3_dual(N, x1, s, prox);
+    dyn2b_crs_screw3_dual(c1, c2, crs);
+
+    // The values equal those of the plain operators
+    double res_x[DYN2B_POSE3_SIZE];
+    double res_dist[DYN2B_SCREW3_SIZE * N];
+    double res_prox[DYN2B_SCREW3_SIZE * N];
+    double res_crs[DYN2B_SCREW3_SIZE];
+    dyn2b_cmp_pose3(x1, x2, res_x);
+    dyn2b_tf_dist_screw3(N, x1, s, res_dist);
+    dyn2b_tf_prox_screw3(N, x1, s, res_prox);
+    dyn2b_crs_screw3(c1, c2, res_crs);
+    for (int i = 0; i < DYN2B_POSE3_SIZE; i++) {
+        ck_assert_flt_eq(x[i], res_x[i]);
+    }
+    for (int i = 0; i < ms; i++) {
+        ck_assert_flt_eq(dist[i], res_dist[i]);
+        ck_assert_flt_eq(prox[i], res_prox[i]);
+    }
+    for (int i = 0; i < DYN2B_SCREW3_SIZE; i++) {
+        ck_assert_flt_eq(crs[i], res_crs[i]);
+    }
+
+    // The tangents equal the directional derivatives
+    for (int k = 0; k < DYN2B_DUAL_K; k++) {
+        double x1_p[DYN2B_POSE3_SIZE], x1_m[DYN2B_POSE3_SIZE];
+        double x2_p[DYN2B_POSE3_SIZE], x2_m[DYN2B_POSE3_SIZE];
+        double s_p[DYN2B_SCREW3_SIZE * N], s_m[DYN2B_SCREW3_SIZE * N];
+        double c1_p[DYN2B_SCREW3_SIZE], c1_m[DYN2B_SCREW3_SIZE];
+        double c2_p[DYN2B_SCREW3_SIZE], c2_m[DYN2B_SCREW3_SIZE];
+        double out_p[DYN2B_SCREW3_SIZE * N], out_m[DYN2B_SCREW3_SIZE * N];
+        dual_at(DYN2B_POSE3_SIZE, x1, k, eps, x1_p);
+        dual_at(DYN2B_POSE3_SIZE, x1, k, -eps, x1_m);
+        dual_at(DYN2B_POSE3_SIZE, x2, k, eps, x2_p);
+        dual_at(DYN2B_POSE3_SIZE, x2, k, -eps, x2_m);
+        dual_at(ms, s, k, eps, s_p);
+        dual_at(ms, s, k, -eps, s_m);
+
+        dyn2b_cmp_pose3(x1_p, x2_p, out_p);
+        dyn2b_cmp_pose3(x1_m, x2_m, out_m);
+        for (int i = 0; i < DYN2B_POSE3_SIZE; i++) {
+            ck_assert_flt_eq(
+                    x[DYN2B_DUAL_TAN_OFFSET(DYN2B_POSE3_SIZE)
+                            + (i * DYN2B_DUAL_TAN_LD) + k],
+                    (out_p[i] - out_m[i]) / (2.0 * eps));
+        }
+
+        dyn2b_tf_dist_screw3(N, x1_p, s_p, out_p);
+        dyn2b_tf_dist_screw3(N, x1_m, s_m, out_m);
+        for (int i = 0; i < ms; i++) {
+            ck_assert_flt_eq(
+                    dist[DYN2B_DUAL_TAN_OFFSET(ms) + (i * DYN2B_DUAL_TAN_LD) + k],
+                    (out_p[i] - out_m[i]) / (2.0 * eps));
+        }
+
+        dyn2b_tf_prox_screw3(N, x1_p, s_p, out_p);
+        dyn2b_tf_prox_screw3(N, x1_m, s_m, out_m);
+        for (int i = 0; i < ms; i++) {
+            ck_assert_flt_eq(
+                    prox[DYN2B_DUAL_TAN_OFFSET(ms) + (i * DYN2B_DUAL_TAN_LD) + k],
+                    (out_p[i] - out_m[i]) / (2.0 * eps));
+        }
+
+        dual_at(DYN2B_SCREW3_SIZE, c1, k, eps, c1_p);
+        dual_at(DYN2B_SCREW3_SIZE, c1, k, -eps, c1_m);
+        dual_at(DYN2B_SCREW3_SIZE, c2, k, eps, c2_p);
+        dual_at(DYN2B_SCREW3_SIZE, c2, k, -eps, c2_m);
+        dyn2b_crs_screw3(c1_p, c2_p, out_p);
+        dyn2b_crs_screw3(c1_m, c2_m, out_m);
+        for (int i = 0; i < DYN2B_SCREW3_SIZE; i++) {
+            ck_assert_flt_eq(
+                    crs[DYN2B_DUAL_TAN_OFFSET(DYN2B_SCREW3_SIZE)
+                            + (i * DYN2B_DUAL_TAN_LD) + k],
+                    (out_p[i] - out_m[i]) / (2.0 * eps));
+        }
+    }
+}
+END_TEST
+
+
 TCase *screw_test()
 {
     TCase *tc = tcase_create("Screw");
@@ -340,8 +771,15 @@ TCase *screw_test()
     tcase_add_test(tc, test_cad_screw3);
     tcase_add_test(tc, test_rot_dist_screw3);
     tcase_add_test(tc, test_tf_dist_screw3);
+    tcase_add_test(tc, test_tf_dist_screw3_ws);
     tcase_add_test(tc, test_rot_prox_screw3);
     tcase_add_test(tc, test_tf_prox_screw3);
+    tcase_add_test(tc, test_cmp_pose3_batch);
+    tcase_add_test(tc, test_tf_screw3_batch);
+    tcase_add_test(tc, test_pose3q);
+    tcase_add_test(tc, test_nrm_pose3q);
+    tcase_add_test(tc, test_tf_screw3_dq);
+    tcase_add_test(tc, test_screw3_dual);
 
     return tc;
 }
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: LGPL-3.0
+#include <check.h>
+
+extern TCase *fk_test();
+extern TCase *rnea_test();
+extern TCase *aba_test();
+extern TCase *achd_test();
+extern TCase *crba_test();
+extern TCase *rnea_drv_test();
+#ifdef DYN2B_TEST_FLOAT
+extern TCase *aba_mixed_test();
+#endif
+
+
+int main(void)
+{
+    Suite *s = suite_create("Solvers");
+    suite_add_tcase(s, fk_test());
+    suite_add_tcase(s, rnea_test());
+    suite_add_tcase(s, aba_test());
+    suite_add_tcase(s, achd_test());
+    suite_add_tcase(s, crba_test());
+    suite_add_tcase(s, rnea_drv_test());
+#ifdef DYN2B_TEST_FLOAT
+    suite_add_tcase(s, aba_mixed_test());
+#endif
+
+    SRunner *sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_ENV);
+    int nf = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return nf == 0 ? 0 : 1;
+}
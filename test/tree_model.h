@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: LGPL-3.0
+#ifndef DYN2B_TEST_TREE_MODEL_H
+#define DYN2B_TEST_TREE_MODEL_H
+
+#include <dyn2b/solvers/tree.h>
+#include <dyn2b/functions/joint.h>
+#include <dyn2b/types/joint.h>
+#include <dyn2b/types/screw.h>
+#include <dyn2b/types/mechanics.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// Test fixture of the solvers
+#define NB 4
+
+// Tree with two branches that start at body 0: {1, 3} and {2}
+static const int parent[NB] = { -1, 0, 0, 1 };
+static const int jnt[NB] = {
+    DYN2B_JNT_REV_Z, DYN2B_JNT_REV_Y, DYN2B_JNT_TRANS_X, DYN2B_JNT_REV
+};
+static const double x_tree[DYN2B_POSE3_SIZE * NB] = {
+    1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  0.0, 0.0, 1.0,  0.0, 0.0, 0.1,
+    1.0, 0.0, 0.0,  0.0, 0.0, 1.0,  0.0, -1.0, 0.0,  0.5, 0.0, 0.0,
+    0.0, 1.0, 0.0,  -1.0, 0.0, 0.0,  0.0, 0.0, 1.0,  0.0, 0.3, 0.0,
+    1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  0.0, 0.0, 1.0,  0.4, 0.0, 0.2
+};
+static const double rbi[DYN2B_RBI3_SIZE * NB] = {
+    0.5, 0.0, 0.0,  0.0, 0.6, 0.0,  0.0, 0.0, 0.7,  0.2, 0.1, 0.0,  2.0,
+    0.3, 0.1, 0.0,  0.1, 0.4, 0.0,  0.0, 0.0, 0.2,  0.0, 0.3, 0.1,  1.5,
+    0.2, 0.0, 0.0,  0.0, 0.2, 0.0,  0.0, 0.0, 0.2,  0.1, 0.0, 0.0,  1.0,
+    0.1, 0.0, 0.0,  0.0, 0.2, 0.1,  0.0, 0.1, 0.3,  0.1, 0.1, 0.2,  0.8
+};
+static const double q[NB] = { 0.3, -0.7, 0.2, 1.1 };
+static const double qd[NB] = { 1.0, -0.5, 0.4, 2.0 };
+static const double qdd[NB] = { 0.2, 1.3, -0.6, 0.9 };
+
+
+// Joint axes (only body 3 has an arbitrary axis)
+static inline void tree_axis(double *axis)
+{
+    double dir[3] = { 1.0, 1.0, 0.0 };
+    dyn2b_to_axis3(dir, &axis[DYN2B_AXIS3_SIZE * 3]);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif